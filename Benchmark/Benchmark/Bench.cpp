@@ -0,0 +1,135 @@
+/*!
+*      \file Bench.cpp
+*      \brief Implement CBenchRun class and the uv comparison
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <complex>
+#include <map>
+
+#include "Bench.h"
+#include "Probe.h"
+
+//CBenchRun constructor
+
+CBenchRun::CBenchRun( const std::string & root, const std::string & work ): m_root( root ), m_work( work )
+{
+	for( int k = 0; k < PHASE_COUNT; k ++ ) m_time[k] = 0;
+	m_iterations = -1;
+	m_tolerance  = 0;
+	m_deviation  = -1;
+	m_phase      = PHASE_COUNT;
+	m_start      = 0;
+}
+
+//end the current phase and start the next one
+
+void CBenchRun::phase( BENCH_PHASE phase )
+{
+	end();
+	m_phase = phase;
+	m_start = CProbe::now();
+}
+
+//end the current phase
+
+void CBenchRun::end()
+{
+	if( m_phase == PHASE_COUNT ) return;
+	m_time[m_phase] += CProbe::now() - m_start;
+	m_phase = PHASE_COUNT;
+}
+
+//the output to check after the stage
+
+void CBenchRun::reference( const std::string & output, const std::string & reference, double tolerance )
+{
+	m_output    = this->output( output );
+	m_reference = input( reference );
+	m_tolerance = tolerance;
+}
+
+//uv of the vertices of a .m file, by vertex id
+
+static bool _read_uv( const char * name, std::map<int, std::complex<double> > & uv )
+{
+	FILE * fp = fopen( name, "r" );
+	if( !fp ) return false;
+
+	char line[4096];
+	while( fgets( line, sizeof( line ), fp ) )
+	{
+		if( strncmp( line, "Vertex", 6 ) != 0 ) continue;
+
+		const char * p = strstr( line, "uv=(" );
+		if( !p ) continue;
+
+		int id = atoi( line + 6 );
+		double u, v;
+		if( sscanf( p + 4, "%lf %lf", &u, &v ) == 2 )
+		{
+			uv[id] = std::complex<double>( u, v );
+		}
+	}
+	fclose( fp );
+	return true;
+}
+
+//largest distance from the reference after the best similarity, z -> a z + b or a conj(z) + b
+
+double _uv_deviation( const char * output, const char * reference, int & matched )
+{
+	typedef std::complex<double> C;
+	std::map<int, C> out, ref;
+
+	matched = 0;
+	if( !_read_uv( output, out ) || !_read_uv( reference, ref ) ) return -1;
+
+	std::vector<C> z, w;
+	for( std::map<int, C>::iterator iter = out.begin(); iter != out.end(); iter ++ )
+	{
+		std::map<int, C>::iterator r = ref.find( iter->first );
+		if( r == ref.end() ) continue;
+		z.push_back( iter->second );
+		w.push_back( r->second );
+	}
+	matched = (int) z.size();
+	if( matched == 0 ) return -1;
+
+	double best = -1;
+	for( int reflect = 0; reflect < 2; reflect ++ )
+	{
+		C mz( 0, 0 ), mw( 0, 0 );
+		for( int i = 0; i < matched; i ++ )
+		{
+			mz += reflect ? std::conj( z[i] ) : z[i];
+			mw += w[i];
+		}
+		mz /= (double) matched;
+		mw /= (double) matched;
+
+		C      num( 0, 0 );
+		double den = 0;
+		for( int i = 0; i < matched; i ++ )
+		{
+			C dz = ( reflect ? std::conj( z[i] ) : z[i] ) - mz;
+			num += ( w[i] - mw ) * std::conj( dz );
+			den += std::norm( dz );
+		}
+		C a = ( den > 0 ) ? num / den : C( 1, 0 );
+
+		double deviation = 0;
+		for( int i = 0; i < matched; i ++ )
+		{
+			C dz = ( reflect ? std::conj( z[i] ) : z[i] ) - mz;
+			double d = std::abs( a * dz + mw - w[i] );
+			if( d > deviation ) deviation = d;
+		}
+		if( best < 0 || deviation < best ) best = deviation;
+	}
+	return best;
+}
@@ -0,0 +1,126 @@
+/*!
+*      \file Bench.h
+*      \brief Stages of the benchmark, each one a pipeline step of the tools split into phases
+*
+*		A stage loads its input from the repository, prepares the solver, solves and writes the
+*		result into the work directory, the same calls as the command of the tool. The phases are
+*		timed by the stage itself through CBenchRun, the runner measures the whole stage.
+*/
+
+#ifndef _BENCHMARK_BENCH_H_
+#define _BENCHMARK_BENCH_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+
+/*!	phases of a stage
+ */
+enum BENCH_PHASE { PHASE_LOAD, PHASE_PREPARE, PHASE_SOLVE, PHASE_WRITE, PHASE_COUNT };
+
+/*!
+ *	\brief CBenchRun class
+ *
+ *	One run of a stage, the phase timings, the iteration count of the solver and the reference
+ *	to check the output against
+ */
+class CBenchRun
+{
+public:
+	/*!	CBenchRun constructor
+	 *	\param root the repository, the inputs are relative to it
+	 *	\param work the directory of the outputs of the stage
+	 */
+	CBenchRun( const std::string & root, const std::string & work );
+
+	/*!	path of an input file, relative to the repository
+	 */
+	std::string input( const std::string & path ) { return m_root + "/" + path; };
+	/*!	path of an output file, in the work directory of the stage
+	 */
+	std::string output( const std::string & path ) { return m_work + "/" + path; };
+
+	/*!	end the current phase and start the next one, the phases may repeat
+	 */
+	void phase( BENCH_PHASE phase );
+	/*!	end the current phase
+	 */
+	void end();
+	/*!	add to the iteration count of the solver
+	 */
+	void iterations( int n ) { m_iterations += n; };
+	/*!	compare the uv of the output with the reference after the stage
+	 *	\param output output mesh, relative to the work directory
+	 *	\param reference reference mesh, relative to the repository
+	 *	\param tolerance largest distance of a vertex uv from the reference, after the best similarity
+	 */
+	void reference( const std::string & output, const std::string & reference, double tolerance );
+	/*!	record the deviation of a stage checked by itself, a kernel against its scalar version
+	 *	\param deviation largest error of the stage
+	 *	\param tolerance largest error accepted
+	 */
+	void check( double deviation, double tolerance ) { m_deviation = deviation; m_tolerance = tolerance; };
+
+	/*! milliseconds spent in each phase */
+	double      m_time[PHASE_COUNT];
+	/*! iteration count of the solver, -1 if the stage has no iterative solver */
+	int         m_iterations;
+	/*! the output mesh to check, empty if none */
+	std::string m_output;
+	/*! the reference mesh */
+	std::string m_reference;
+	/*! the tolerance of the check */
+	double      m_tolerance;
+	/*! deviation recorded by check, -1 if none */
+	double      m_deviation;
+
+protected:
+	std::string m_root;
+	std::string m_work;
+	/*! the current phase, PHASE_COUNT if none */
+	int         m_phase;
+	/*! start of the current phase */
+	double      m_start;
+};
+
+/*!
+ *	\brief CBenchStage
+ *
+ *	A named stage, the part of the name before the slash is the group, the stages of a group share
+ *	one work directory and run in order, a stage may read the outputs of the previous ones
+ */
+struct CBenchStage
+{
+	std::string                        name;
+	std::function<void( CBenchRun & )> run;
+};
+
+/*!	Largest distance of the vertex uv of the output from the uv of the same vertex in the reference,
+ *	after mapping the output by the similarity of the plane, possibly reflecting, that fits the reference
+ *	best in the least squares sense, conformal maps are only defined up to it.
+ *	\param output the output mesh
+ *	\param reference the reference mesh
+ *	\param matched the number of vertices with uv in both
+ *	\return the largest distance, or -1 if no vertex matched
+ */
+double _uv_deviation( const char * output, const char * reference, int & matched );
+
+/*!	stages of the harmonic mapper, HarmonicMapper/main.cpp
+ */
+void _harmonic_stages( std::vector<CBenchStage> & stages );
+/*!	stages of the Ricci flow extremal length, RicciFlowExtremalLength/main.cpp
+ */
+void _ricci_stages( std::vector<CBenchStage> & stages );
+/*!	stages of the Riemann mapper, RiemannMapping/RiemannMapper/API.cpp
+ */
+void _riemann_stages( std::vector<CBenchStage> & stages );
+/*!	read_m and write_m of every mesh under the data directory
+ *	\param root the repository
+ *	\param data the data directory, relative to the repository
+ */
+void _io_stages( std::vector<CBenchStage> & stages, const std::string & root, const std::string & data );
+/*!	batched kernels against their scalar versions, MeshLib/core/Geometry/HyperbolicBatch.h
+ */
+void _kernel_stages( std::vector<CBenchStage> & stages );
+
+#endif
@@ -0,0 +1,64 @@
+/*!
+*      \file HarmonicStages.cpp
+*      \brief Stages of the harmonic mapper, the -harmonic_map command of HarmonicMapper/main.cpp
+*
+*/
+
+#include "Bench.h"
+
+#include "Conformal/HarmonicMapper/HarmonicMapperMesh.h"
+#include "Conformal/HarmonicMapper/HarmonicMapper.h"
+
+using namespace MeshLib;
+
+//harmonic map of a topological disk to the unit disk
+
+static void _harmonic_map( CBenchRun & run, const char * _input, const char * _output )
+{
+	CHMMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.input( _input ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CHarmonicMapper mapper( & mesh );
+
+	run.phase( PHASE_SOLVE );
+	mapper._map();
+	run.iterations( mapper.iterations() );
+
+	run.phase( PHASE_WRITE );
+	mesh.write_m( run.output( _output ).c_str() );
+	run.end();
+}
+
+#define DATA "RiemannMapper/ReimannMapper/"
+
+void _harmonic_stages( std::vector<CBenchStage> & stages )
+{
+	stages.push_back( { "harmonic/disk_sophie", []( CBenchRun & run )
+	{
+		_harmonic_map( run, DATA "Disk/sophie/sophie.open.m", "disk_sophie.uv.m" );
+	} } );
+
+	stages.push_back( { "harmonic/quad_sophie", []( CBenchRun & run )
+	{
+		_harmonic_map( run, DATA "Quad/sophie/sophie.m", "quad_sophie.uv.m" );
+	} } );
+
+	stages.push_back( { "harmonic/quad_alex", []( CBenchRun & run )
+	{
+		_harmonic_map( run, DATA "Quad/Alex/Alex.m", "quad_alex.uv.m" );
+	} } );
+
+	stages.push_back( { "harmonic/remesh_sophie", []( CBenchRun & run )
+	{
+		_harmonic_map( run, DATA "Remesh/Sophie/Sophie.m", "remesh_sophie.uv.m" );
+		run.reference( "remesh_sophie.uv.m", DATA "Remesh/Sophie/Sophie.uv.m", 1e-5 );
+	} } );
+
+	stages.push_back( { "harmonic/maxplanck", []( CBenchRun & run )
+	{
+		_harmonic_map( run, DATA "Robust/MaxPlanck/MaxPlanck.m", "maxplanck.uv.m" );
+	} } );
+}
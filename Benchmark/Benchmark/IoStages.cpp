@@ -0,0 +1,66 @@
+/*!
+*      \file IoStages.cpp
+*      \brief read_m and write_m of every mesh of the data set
+*
+*/
+
+#include <filesystem>
+#include <algorithm>
+
+#include "Bench.h"
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/Vertex.h"
+#include "Mesh/Edge.h"
+#include "Mesh/Face.h"
+#include "Mesh/HalfEdge.h"
+
+using namespace MeshLib;
+
+typedef CBaseMesh<CVertex, CEdge, CFace, CHalfEdge> CIOMesh;
+
+//read the mesh and write it back, the attribute strings are kept
+
+static void _read_write( CBenchRun & run, const std::string & _input, const std::string & _output )
+{
+	CIOMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.input( _input ).c_str() );
+
+	run.phase( PHASE_WRITE );
+	mesh.write_m( run.output( _output ).c_str() );
+	run.end();
+}
+
+void _io_stages( std::vector<CBenchStage> & stages, const std::string & root, const std::string & data )
+{
+	namespace fs = std::filesystem;
+
+	std::error_code error;
+	fs::path base( root + "/" + data );
+	if( !fs::is_directory( base, error ) ) return;
+
+	std::vector<std::string> meshes;
+	for( fs::recursive_directory_iterator iter( base, error ), end; iter != end; iter.increment( error ) )
+	{
+		if( error ) break;
+		if( !iter->is_regular_file( error ) || iter->path().extension() != ".m" ) continue;
+		//empty placeholders in the data set
+		if( iter->file_size( error ) < 1024 ) continue;
+		meshes.push_back( fs::relative( iter->path(), base, error ).generic_string() );
+	}
+	std::sort( meshes.begin(), meshes.end() );
+
+	for( size_t i = 0; i < meshes.size(); i ++ )
+	{
+		std::string input  = data + "/" + meshes[i];
+		std::string output = meshes[i];
+		std::replace( output.begin(), output.end(), '/', '_' );
+
+		stages.push_back( { "io/" + meshes[i], [input, output]( CBenchRun & run )
+		{
+			_read_write( run, input, output );
+		} } );
+	}
+}
@@ -0,0 +1,154 @@
+/*!
+*      \file KernelStages.cpp
+*      \brief Batched hyperbolic kernels of MeshLib/core/Geometry/HyperbolicBatch.h against their scalar versions
+*
+*/
+
+#include <math.h>
+#include <random>
+#include <algorithm>
+
+#include "Bench.h"
+
+#include "Geometry/HyperbolicBatch.h"
+
+using namespace MeshLib;
+
+//pairs of points per stage, uniform in the disk of radius 0.999, the range the header gives the agreement for
+static const int    s_pairs     = 1 << 20;
+static const double s_radius    = 0.999;
+static const double s_tolerance = 1e-11;
+
+//the same points in every run
+
+static void _points( std::vector<double> & x, std::vector<double> & y, std::mt19937_64 & random )
+{
+	std::uniform_real_distribution<double> uniform( -s_radius, s_radius );
+
+	x.resize( s_pairs );
+	y.resize( s_pairs );
+	for( int i = 0; i < s_pairs; i ++ )
+	{
+		do
+		{
+			x[i] = uniform( random );
+			y[i] = uniform( random );
+		}
+		while( x[i] * x[i] + y[i] * y[i] >= s_radius * s_radius );
+	}
+}
+
+//relative error of the batched value b against the scalar value a
+
+static double _relative( double a, double b )
+{
+	return ( a == 0 )? fabs( b ): fabs( b - a ) / fabs( a );
+}
+
+//the phases are the points, the scalar versions and the batched kernels
+
+static void _distance( CBenchRun & run )
+{
+	std::mt19937_64 random( 1 );
+	std::vector<double> x0, y0, x1, y1;
+
+	run.phase( PHASE_LOAD );
+	_points( x0, y0, random );
+	_points( x1, y1, random );
+
+	run.phase( PHASE_PREPARE );
+	std::vector<double> reference( s_pairs );
+	for( int i = 0; i < s_pairs; i ++ )
+	{
+		reference[i] = _hyperbolic_distance( Complex( x0[i], y0[i] ), Complex( x1[i], y1[i] ) );
+	}
+
+	run.phase( PHASE_SOLVE );
+	std::vector<double> d( s_pairs );
+	_hyperbolic_distance( &x0[0], &y0[0], &x1[0], &y1[0], &d[0], s_pairs );
+	run.end();
+
+	double deviation = 0;
+	for( int i = 0; i < s_pairs; i ++ ) deviation = std::max( deviation, _relative( reference[i], d[i] ) );
+	run.check( deviation, s_tolerance );
+}
+
+static void _circle( CBenchRun & run )
+{
+	std::mt19937_64 random( 2 );
+	std::uniform_real_distribution<double> uniform( 0.01, 3.0 );
+	std::vector<double> cx, cy, r( s_pairs );
+
+	run.phase( PHASE_LOAD );
+	_points( cx, cy, random );
+	for( int i = 0; i < s_pairs; i ++ ) r[i] = uniform( random );
+
+	run.phase( PHASE_PREPARE );
+	std::vector<Complex> C( s_pairs );
+	std::vector<double>  R( s_pairs );
+	for( int i = 0; i < s_pairs; i ++ )
+	{
+		_hyperbolic_circle( Complex( cx[i], cy[i] ), r[i], C[i], R[i] );
+	}
+
+	run.phase( PHASE_SOLVE );
+	std::vector<double> Cx( s_pairs ), Cy( s_pairs ), Rb( s_pairs );
+	_hyperbolic_circle( &cx[0], &cy[0], &r[0], &Cx[0], &Cy[0], &Rb[0], s_pairs );
+	run.end();
+
+	double deviation = 0;
+	for( int i = 0; i < s_pairs; i ++ )
+	{
+		deviation = std::max( deviation, std::abs( C[i] - Complex( Cx[i], Cy[i] ) ) / std::abs( C[i] ) );
+		deviation = std::max( deviation, _relative( R[i], Rb[i] ) );
+	}
+	run.check( deviation, s_tolerance );
+}
+
+//a pair classified differently counts as a deviation of 1
+
+static void _geodesic( CBenchRun & run )
+{
+	std::mt19937_64 random( 3 );
+	std::vector<double> px, py, qx, qy;
+
+	run.phase( PHASE_LOAD );
+	_points( px, py, random );
+	_points( qx, qy, random );
+
+	run.phase( PHASE_PREPARE );
+	std::vector<Complex> C( s_pairs );
+	std::vector<double>  R( s_pairs );
+	std::vector<int>     type( s_pairs );
+	for( int i = 0; i < s_pairs; i ++ )
+	{
+		type[i] = _hyperbolic_geodesic( Complex( px[i], py[i] ), Complex( qx[i], qy[i] ), C[i], R[i] );
+	}
+
+	run.phase( PHASE_SOLVE );
+	std::vector<double> Cx( s_pairs ), Cy( s_pairs ), Rb( s_pairs );
+	std::vector<int>    tb( s_pairs );
+	_hyperbolic_geodesic( &px[0], &py[0], &qx[0], &qy[0], &Cx[0], &Cy[0], &Rb[0], &tb[0], s_pairs );
+	run.end();
+
+	double deviation = 0;
+	for( int i = 0; i < s_pairs; i ++ )
+	{
+		if( type[i] != tb[i] )
+		{
+			deviation = std::max( deviation, 1.0 );
+			continue;
+		}
+		if( !type[i] ) continue;
+		deviation = std::max( deviation, std::abs( C[i] - Complex( Cx[i], Cy[i] ) ) / std::abs( C[i] ) );
+		deviation = std::max( deviation, _relative( R[i], Rb[i] ) );
+	}
+	run.check( deviation, s_tolerance );
+}
+
+void _kernel_stages( std::vector<CBenchStage> & stages )
+{
+	stages.push_back( { "kernel/hyperbolic_distance", _distance } );
+	stages.push_back( { "kernel/hyperbolic_circle",   _circle } );
+	stages.push_back( { "kernel/hyperbolic_geodesic", _geodesic } );
+}
@@ -0,0 +1,190 @@
+/*!
+*      \file Probe.cpp
+*      \brief Implement CProbe class
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "Probe.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+//perf event of the calling thread, user space only so that perf_event_paranoid 2 allows it
+static int _perf_event_open( unsigned long long config )
+{
+	struct perf_event_attr attr;
+	memset( &attr, 0, sizeof( attr ) );
+	attr.size           = sizeof( attr );
+	attr.type           = PERF_TYPE_HARDWARE;
+	attr.config         = config;
+	attr.disabled       = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+	return (int) syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+}
+#endif
+
+static const char * g_counter_names[PROBE_COUNTERS] = { "cycles", "instructions", "cache_misses", "branch_misses" };
+
+//CProbe constructor, the counters are opened once
+
+CProbe::CProbe(): m_has_counters( false ), m_peak_rss( 0 )
+{
+	for( int k = 0; k < PROBE_COUNTERS; k ++ )
+	{
+		m_fd[k]      = -1;
+		m_counter[k] = 0;
+	}
+
+#ifdef __linux__
+	unsigned long long config[PROBE_COUNTERS] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+
+	m_has_counters = true;
+	for( int k = 0; k < PROBE_COUNTERS; k ++ )
+	{
+		m_fd[k] = _perf_event_open( config[k] );
+		if( m_fd[k] < 0 ) m_has_counters = false;
+	}
+#endif
+}
+
+//CProbe destructor
+
+CProbe::~CProbe()
+{
+#ifdef __linux__
+	for( int k = 0; k < PROBE_COUNTERS; k ++ )
+	{
+		if( m_fd[k] >= 0 ) close( m_fd[k] );
+	}
+#endif
+}
+
+//name of the k-th counter
+
+const char * CProbe::counter_name( int k )
+{
+	return g_counter_names[k];
+}
+
+//milliseconds of the steady clock
+
+double CProbe::now()
+{
+	return std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+//reset the peak resident set and start the counters
+
+void CProbe::start()
+{
+#ifdef __GLIBC__
+	//give the heap of the previous stages back, or it counts in the peak of this one
+	malloc_trim( 0 );
+#endif
+	_reset_peak_rss();
+
+#ifdef __linux__
+	if( m_has_counters )
+	{
+		for( int k = 0; k < PROBE_COUNTERS; k ++ )
+		{
+			ioctl( m_fd[k], PERF_EVENT_IOC_RESET, 0 );
+			ioctl( m_fd[k], PERF_EVENT_IOC_ENABLE, 0 );
+		}
+	}
+#endif
+}
+
+//stop the counters and read the peak resident set
+
+void CProbe::stop()
+{
+#ifdef __linux__
+	if( m_has_counters )
+	{
+		for( int k = 0; k < PROBE_COUNTERS; k ++ )
+		{
+			ioctl( m_fd[k], PERF_EVENT_IOC_DISABLE, 0 );
+			long long value = 0;
+			if( read( m_fd[k], &value, sizeof( value ) ) != sizeof( value ) ) value = 0;
+			m_counter[k] = value;
+		}
+	}
+#endif
+	m_peak_rss = _read_peak_rss();
+}
+
+//peak resident set in kB, the high water mark of /proc/self/status on Linux
+
+long CProbe::_read_peak_rss()
+{
+#if defined( __linux__ )
+	FILE * fp = fopen( "/proc/self/status", "r" );
+	if( fp )
+	{
+		char line[256];
+		long kb = 0;
+		while( fgets( line, sizeof( line ), fp ) )
+		{
+			if( strncmp( line, "VmHWM:", 6 ) == 0 )
+			{
+				sscanf( line + 6, "%ld", &kb );
+				break;
+			}
+		}
+		fclose( fp );
+		if( kb > 0 ) return kb;
+	}
+#endif
+
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS pmc;
+	if( GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof( pmc ) ) )
+	{
+		return (long)( pmc.PeakWorkingSetSize / 1024 );
+	}
+	return 0;
+#else
+	struct rusage usage;
+	getrusage( RUSAGE_SELF, &usage );
+#ifdef __APPLE__
+	return usage.ru_maxrss / 1024;
+#else
+	return usage.ru_maxrss;
+#endif
+#endif
+}
+
+//writing 5 to clear_refs resets the high water mark to the current resident set, Linux 4.0 on
+
+bool CProbe::_reset_peak_rss()
+{
+#ifdef __linux__
+	FILE * fp = fopen( "/proc/self/clear_refs", "w" );
+	if( !fp ) return false;
+	bool ok = fputs( "5", fp ) >= 0;
+	return ( fclose( fp ) == 0 ) && ok;
+#else
+	return false;
+#endif
+}
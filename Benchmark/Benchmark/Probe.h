@@ -0,0 +1,73 @@
+/*!
+*      \file Probe.h
+*      \brief Wall clock, peak resident set and hardware counters of the benchmark stages
+*
+*		The hardware counters are read through perf_event_open on Linux, they count the
+*		calling thread only, run with OMP_NUM_THREADS=1 to count the whole stage. They are
+*		not available elsewhere, or when the kernel refuses them (perf_event_paranoid).
+*/
+
+#ifndef _BENCHMARK_PROBE_H_
+#define _BENCHMARK_PROBE_H_
+
+/*! number of hardware counters, cycles, instructions, cache misses, branch misses */
+#define PROBE_COUNTERS 4
+
+/*!
+ *	\brief CProbe class
+ *
+ *	Measures one stage, between start and stop
+ */
+class CProbe
+{
+public:
+	/*!	CProbe constructor, opens the hardware counters
+	 */
+	CProbe();
+	/*!	CProbe destructor, closes the hardware counters
+	 */
+	~CProbe();
+
+	/*!	Reset the peak resident set and the counters, start the counters
+	 */
+	void start();
+	/*!	Stop the counters, read the peak resident set
+	 */
+	void stop();
+
+	/*!	Milliseconds since the epoch of the steady clock
+	 */
+	static double now();
+
+	/*!	Whether the hardware counters could be opened
+	 */
+	bool has_counters() { return m_has_counters; };
+	/*!	Value of the k-th hardware counter of the last stage
+	 */
+	long long counter( int k ) { return m_counter[k]; };
+	/*!	Name of the k-th hardware counter
+	 */
+	static const char * counter_name( int k );
+	/*!	Peak resident set of the last stage in kB, the peak of the process if it can not be reset
+	 */
+	long peak_rss() { return m_peak_rss; };
+
+protected:
+	/*!	read the peak resident set in kB
+	 */
+	long _read_peak_rss();
+	/*!	reset the peak resident set, returns false if the system can not
+	 */
+	bool _reset_peak_rss();
+
+	/*! perf event file descriptors */
+	int  m_fd[PROBE_COUNTERS];
+	/*! whether all the counters are open */
+	bool m_has_counters;
+	/*! counter values of the last stage */
+	long long m_counter[PROBE_COUNTERS];
+	/*! peak resident set of the last stage */
+	long m_peak_rss;
+};
+
+#endif
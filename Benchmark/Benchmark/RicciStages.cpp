@@ -0,0 +1,104 @@
+/*!
+*      \file RicciStages.cpp
+*      \brief Stages of the Ricci flow, the -tangent_ricci_extremal_length command of RicciFlowExtremalLength/main.cpp
+*
+*/
+
+#include <algorithm>
+
+#include "Bench.h"
+
+#include "Structure/Structure.h"
+#include "Riemannian/RicciFlow/TangentialRicciExtremalLength.h"
+#include "Riemannian/RicciFlow/EuclideanEmbed.h"
+
+using namespace MeshLib;
+
+unsigned int CRicciFlowVertex::traits = 0;
+
+//metric of the quadrilateral by tangential Ricci flow and its embedding in the plane,
+//the iterations are the Newton and the gradient flow steps
+
+static void _tangent_ricci_extremal_length( CBenchRun & run, const char * _input, const char * _output )
+{
+	CRicciFlowVertex::traits = CRicciFlowVertex::traits | TRAIT_UV;
+
+	CRFMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.input( _input ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CTangentialRicciFlowExtremalLength<CRicciFlowVertex,CRicciFlowEdge,CRicciFlowFace,CRicciFlowHalfEdge> mapper(&mesh);
+
+	run.phase( PHASE_SOLVE );
+	mapper._calculate_metric();
+	run.iterations( mapper.newton_steps() + mapper.flow_steps() );
+
+	CRFEmbed embed( &mesh );
+	embed._embed();
+
+	run.phase( PHASE_WRITE );
+	mesh.write_m( run.output( _output ).c_str() );
+	run.end();
+}
+
+//the embedding with the faces of each level in parallel, against the serial embedding of the same metric;
+//the faces of one level embed distinct vertices from the previous levels, so the uv should be identical
+
+static void _parallel_embed( CBenchRun & run, const char * _input )
+{
+	CRicciFlowVertex::traits = CRicciFlowVertex::traits | TRAIT_UV;
+
+	CRFMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.input( _input ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CTangentialRicciFlowExtremalLength<CRicciFlowVertex,CRicciFlowEdge,CRicciFlowFace,CRicciFlowHalfEdge> mapper(&mesh);
+	mapper._calculate_metric();
+
+	CRFEmbed serial( &mesh );
+	serial._embed();
+	std::vector<CPoint2> uv;
+	for( CRFMesh::MeshVertexIterator viter( &mesh ); !viter.end(); viter ++ ) uv.push_back( (*viter)->huv() );
+
+	run.phase( PHASE_SOLVE );
+	CRFEmbed embed( &mesh );
+	embed.parallel() = true;
+	embed._embed();
+	run.end();
+
+	double deviation = 0;
+	size_t k = 0;
+	for( CRFMesh::MeshVertexIterator viter( &mesh ); !viter.end(); viter ++, k ++ )
+		deviation = std::max( deviation, ( (*viter)->huv() - uv[k] ).norm() );
+	run.check( deviation, 1e-12 );
+}
+
+#define DATA "RiemannMapper/ReimannMapper/"
+
+void _ricci_stages( std::vector<CBenchStage> & stages )
+{
+	stages.push_back( { "ricci/quad_sophie", []( CBenchRun & run )
+	{
+		_tangent_ricci_extremal_length( run, DATA "Quad/sophie/sophie.m", "quad_sophie.uv.m" );
+	} } );
+
+	stages.push_back( { "ricci/quad_alex", []( CBenchRun & run )
+	{
+		_tangent_ricci_extremal_length( run, DATA "Quad/Alex/Alex.m", "quad_alex.uv.m" );
+	} } );
+
+	stages.push_back( { "ricci/demo_alex", []( CBenchRun & run )
+	{
+		_tangent_ricci_extremal_length( run, "RicciFlowExtremalLength/demo/Alex/Alex.remesh.m", "demo_alex.uv.m" );
+		run.reference( "demo_alex.uv.m", "RicciFlowExtremalLength/demo/Alex/Alex.remesh.uv.m", 1e-4 );
+	} } );
+
+	stages.push_back( { "ricci/embed_parallel", []( CBenchRun & run )
+	{
+		_parallel_embed( run, "RicciFlowExtremalLength/demo/Alex/Alex.remesh.m" );
+	} } );
+}
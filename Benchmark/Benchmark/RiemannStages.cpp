@@ -0,0 +1,319 @@
+/*!
+*      \file RiemannStages.cpp
+*      \brief Stages of the Riemann mapper, the steps of RiemannMapping/RiemannMapper/API.cpp
+*
+*		The Riemann mapping of Disk/sophie from the original mesh, each stage reads the outputs of
+*		the previous ones. The cut and the exact forms write their meshes themselves, so their write
+*		phase is part of the solve. The reference uv of the data set was computed by an older version
+*		of the code, only the hole filling of the reference circular uv still reproduces it.
+*/
+
+#include "Bench.h"
+#include "API.h"
+
+using namespace MeshLib;
+
+#define DISK "RiemannMapper/ReimannMapper/Disk/sophie/"
+
+//-puncture
+
+static void _puncture_stage( CBenchRun & run )
+{
+	CPMesh cmesh;
+
+	run.phase( PHASE_LOAD );
+	cmesh.read_m( run.input( DISK "sophie.origin.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CPuncture cut( & cmesh );
+
+	run.phase( PHASE_SOLVE );
+	cut._puncture();
+
+	run.phase( PHASE_WRITE );
+	cmesh.write_m( run.output( "sophie.m" ).c_str() );
+	run.end();
+}
+
+//-cut
+
+static void _cut_domain_stage( CBenchRun & run )
+{
+	CSPMesh spm;
+
+	run.phase( PHASE_LOAD );
+	spm.read_m( run.output( "sophie.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CShortestPath sp( & spm );
+
+	run.phase( PHASE_SOLVE );
+	sp._cut( run.output( "sophie" ).c_str() );
+	run.end();
+}
+
+//-slice
+
+static void _slice_stage( CBenchRun & run )
+{
+	CSMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.output( "sophie_0.cut.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CWMesh wmesh( & mesh );
+
+	run.phase( PHASE_SOLVE );
+	wmesh.Slice();
+
+	run.phase( PHASE_WRITE );
+	wmesh.wmesh()->write_m( run.output( "sophie.open.m" ).c_str() );
+	run.end();
+}
+
+//-exact_form
+
+static void _exact_form_stage( CBenchRun & run )
+{
+	CHarmonicMesh hm;
+
+	run.phase( PHASE_LOAD );
+	hm.read_m( run.output( "sophie.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CHarmonicExactForm exact_form( & hm );
+
+	run.phase( PHASE_SOLVE );
+	exact_form.calculate_harmonic_exact_form( run.output( "sophie" ).c_str() );
+	run.iterations( exact_form.iterations() );
+	run.end();
+}
+
+//-cohomology_one_form_domain
+
+static void _cohomology_one_form_domain_stage( CBenchRun & run )
+{
+	CCHMesh cmesh;
+	CCHMesh omesh;
+
+	run.phase( PHASE_LOAD );
+	cmesh.read_m( run.output( "sophie.m" ).c_str() );
+	omesh.read_m( run.output( "sophie.open.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CDomainCohomology closed_form( & cmesh, &omesh );
+
+	run.phase( PHASE_SOLVE );
+	closed_form.calculate_closed_form();
+
+	run.phase( PHASE_WRITE );
+	cmesh.write_m( run.output( "sophie_0.closed.m" ).c_str() );
+	omesh.write_m( run.output( "sophie_0.closed_uv.m" ).c_str() );
+	run.end();
+}
+
+//-diffuse
+
+static void _diffuse_stage( CBenchRun & run )
+{
+	CHCFMesh cmesh;
+	CHCFMesh omesh;
+
+	run.phase( PHASE_LOAD );
+	cmesh.read_m( run.output( "sophie_0.closed.m" ).c_str() );
+	omesh.read_m( run.output( "sophie.open.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CHeatFlow flow( & cmesh, &omesh );
+
+	run.phase( PHASE_SOLVE );
+	flow.calculate_harmonic_form();
+
+	run.phase( PHASE_WRITE );
+	cmesh.write_m( run.output( "sophie_0.dv.m" ).c_str() );
+	omesh.write_m( run.output( "sophie_0.dv_uv.m" ).c_str() );
+	run.end();
+}
+
+//-holomorphic_form, the exact form and the harmonic closed form
+
+static void _holomorphic_form_stage( CBenchRun & run )
+{
+	const char * inputs[]  = { "sophie_0.du.m", "sophie_0.dv.m" };
+	const char * outputs[] = { "holomorphic_form_0.m", "holomorphic_form_1.m" };
+	std::list<CHoloFormMesh*> meshes;
+
+	run.phase( PHASE_LOAD );
+	for( int i = 0; i < 2; i ++ )
+	{
+		CHoloFormMesh * pMesh = new CHoloFormMesh;
+		pMesh->read_m( run.output( inputs[i] ).c_str() );
+		meshes.push_back( pMesh );
+	}
+
+	run.phase( PHASE_PREPARE );
+	CHolomorphicForm form( meshes );
+
+	run.phase( PHASE_SOLVE );
+	form.conjugate();
+
+	run.phase( PHASE_WRITE );
+	int id = 0;
+	for( std::list<CHoloFormMesh*>::iterator miter = meshes.begin(); miter != meshes.end(); miter++ )
+	{
+		(*miter)->write_m( run.output( outputs[id++] ).c_str() );
+	}
+	run.end();
+
+	for( std::list<CHoloFormMesh*>::iterator miter = meshes.begin(); miter != meshes.end(); miter++ )
+	{
+		delete *miter;
+	}
+}
+
+//-integration
+
+static void _integration_stage( CBenchRun & run )
+{
+	CIMesh holo_mesh;
+	CIMesh fund_mesh;
+
+	run.phase( PHASE_LOAD );
+	holo_mesh.read_m( run.output( "holomorphic_form_0.m" ).c_str() );
+	fund_mesh.read_m( run.output( "sophie.open.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CIntegration integrator( & holo_mesh, & fund_mesh );
+
+	run.phase( PHASE_SOLVE );
+	integrator._integrate();
+
+	run.phase( PHASE_WRITE );
+	fund_mesh.write_m( run.output( "sophie.uv.m" ).c_str() );
+	run.end();
+}
+
+//-polar_map
+
+static void _polar_map_stage( CBenchRun & run )
+{
+	CPMMesh mesh;
+	CPMMesh open_mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.output( "sophie.m" ).c_str() );
+	open_mesh.read_m( run.output( "sophie.uv.m" ).c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CPolarMap map( &mesh, &open_mesh );
+
+	run.phase( PHASE_SOLVE );
+	map._exponential_map();
+
+	run.phase( PHASE_WRITE );
+	mesh.write_m( run.output( "sophie.circ_uv.m" ).c_str() );
+	run.end();
+}
+
+//-fill_hole
+
+static void _fill_hole_stage( CBenchRun & run, const std::string & _input, const char * _output )
+{
+	CPMesh cmesh;
+
+	run.phase( PHASE_LOAD );
+	cmesh.read_m( _input.c_str() );
+
+	run.phase( PHASE_PREPARE );
+	CPuncture cut( & cmesh );
+
+	run.phase( PHASE_SOLVE );
+	cut._fill_hole();
+
+	run.phase( PHASE_WRITE );
+	cmesh.write_m( run.output( _output ).c_str() );
+	run.end();
+}
+
+//-distortion of the reference uv
+
+static void _distortion_stage( CBenchRun & run )
+{
+	typedef CDistortion<CDMesh, CVertex, CDistortionFace> CDistortionMeasure;
+
+	CDMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	std::string input = run.input( DISK "sophie.final_uv.m" );
+	mesh.read_m( input.c_str() );
+	_read_vertex_uv<CDMesh, CVertex, CEdge, CDistortionFace, CHalfEdge>( &mesh );
+
+	run.phase( PHASE_PREPARE );
+	CDistortionMeasure distortion( &mesh );
+
+	run.phase( PHASE_SOLVE );
+	distortion._measure();
+
+	run.phase( PHASE_WRITE );
+	distortion._write_report( run.output( "distortion.json" ).c_str(), input.c_str() );
+	run.end();
+}
+
+//vertex color channel of the geometry image
+static void _geometry_image_rgb( CGeometryImageVertex * v, double * value )
+{
+	for( int j = 0; j < 3; j ++ ) value[j] = v->rgb()[j];
+}
+
+//-geometry_image of the reference uv
+
+static void _geometry_image_stage( CBenchRun & run )
+{
+	CGIMesh mesh;
+
+	run.phase( PHASE_LOAD );
+	mesh.read_m( run.input( DISK "sophie.final_uv.m" ).c_str() );
+	_read_vertex_uv<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+	_read_vertex_normal<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+	_read_vertex_rgb<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+
+	run.phase( PHASE_PREPARE );
+	CGeometryImage<CGIMesh, CGeometryImageVertex, CFace> image( &mesh, 256 );
+	image.add_channel( "rgb", 3, _geometry_image_rgb );
+
+	run.phase( PHASE_SOLVE );
+	image._rasterize();
+
+	run.phase( PHASE_WRITE );
+	image._write_raw( run.output( "sophie_gi" ).c_str() );
+	image._write_preview( run.output( "sophie_gi" ).c_str() );
+	run.end();
+}
+
+void _riemann_stages( std::vector<CBenchStage> & stages )
+{
+	stages.push_back( { "riemann/puncture",         _puncture_stage } );
+	stages.push_back( { "riemann/cut",              _cut_domain_stage } );
+	stages.push_back( { "riemann/slice",            _slice_stage } );
+	stages.push_back( { "riemann/exact_form",       _exact_form_stage } );
+	stages.push_back( { "riemann/cohomology",       _cohomology_one_form_domain_stage } );
+	stages.push_back( { "riemann/diffuse",          _diffuse_stage } );
+	stages.push_back( { "riemann/holomorphic_form", _holomorphic_form_stage } );
+	stages.push_back( { "riemann/integration",      _integration_stage } );
+	stages.push_back( { "riemann/polar_map",        _polar_map_stage } );
+
+	stages.push_back( { "riemann/fill_hole", []( CBenchRun & run )
+	{
+		_fill_hole_stage( run, run.output( "sophie.circ_uv.m" ), "sophie.final_uv.m" );
+	} } );
+
+	stages.push_back( { "riemann/fill_hole_reference", []( CBenchRun & run )
+	{
+		_fill_hole_stage( run, run.input( DISK "sophie.circ_uv.m" ), "reference.final_uv.m" );
+		run.reference( "reference.final_uv.m", DISK "sophie.final_uv.m", 1e-9 );
+	} } );
+
+	stages.push_back( { "riemann/distortion",       _distortion_stage } );
+	stages.push_back( { "riemann/geometry_image",   _geometry_image_stage } );
+}
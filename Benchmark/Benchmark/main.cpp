@@ -0,0 +1,325 @@
+/*!
+*      \file main.cpp
+*      \brief Benchmark of the pipelines of HarmonicMapper, RicciFlowExtremalLength and RiemannMapper
+*
+*		The code performs the following tasks
+*
+*       1. Runs every stage on the sample meshes, timing the load, prepare, solve and write phases,
+*          with the peak resident set, the solver iterations and the hardware counters if available.
+*       2. Checks the uv of the stages with a reference against it, within a tolerance, and the
+*          batched kernels against their scalar versions.
+*       3. Compares the results with a stored baseline, a stage regresses if its total or solve time
+*          its peak resident set or its iterations grow by more than the threshold.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+
+#include "Bench.h"
+#include "Probe.h"
+
+/*!	\brief Helper function to remind the users of the usage of the commands
+ *
+ */
+
+void help( char * exe )
+{
+	printf("Usage:\n");
+	printf("%s [-root repository] [-work directory] [-stage prefix ...] [-repeat n]\n", exe );
+	printf("%*s [-baseline file [-save] [-threshold fraction]] [-list]\n", (int) strlen( exe ), "" );
+	printf("  -root      the repository with the sample meshes, default .\n");
+	printf("  -work      directory of the outputs and of results.txt, default benchmark\n");
+	printf("  -stage     run the stages whose name starts with the prefix, the stages of a group\n");
+	printf("             read the outputs of the previous ones, run the whole group once first\n");
+	printf("  -repeat    run each stage n times and keep the fastest, default 1\n");
+	printf("  -baseline  compare with the baseline, with -save record the results as the baseline\n");
+	printf("  -threshold relative growth counted as a regression, default 0.10\n");
+}
+
+/*!	results of a stage
+ */
+struct CBenchResult
+{
+	std::string name;
+	double      time[PHASE_COUNT];
+	double      total;
+	long        peak_rss;
+	int         iterations;
+	long long   counter[PROBE_COUNTERS];
+	/*! largest uv distance from the reference, -1 without reference */
+	double      deviation;
+	double      tolerance;
+	bool        failed;
+};
+
+//one stage, the fastest of the repeats
+
+static CBenchResult _run( CBenchStage & stage, CProbe & probe, const std::string & root, const std::string & work, int repeat )
+{
+	CBenchResult best;
+	best.name  = stage.name;
+	best.total = -1;
+
+	std::string group = stage.name.substr( 0, stage.name.find( '/' ) );
+	std::string dir   = work + "/" + group;
+	std::error_code error;
+	std::filesystem::create_directories( dir, error );
+
+	for( int r = 0; r < repeat; r ++ )
+	{
+		CBenchRun run( root, dir );
+
+		probe.start();
+		double start = CProbe::now();
+		stage.run( run );
+		double total = CProbe::now() - start;
+		probe.stop();
+
+		if( best.total >= 0 && total >= best.total ) continue;
+
+		for( int k = 0; k < PHASE_COUNT; k ++ ) best.time[k] = run.m_time[k];
+		best.total      = total;
+		best.peak_rss   = probe.peak_rss();
+		best.iterations = run.m_iterations;
+		for( int k = 0; k < PROBE_COUNTERS; k ++ ) best.counter[k] = probe.has_counters() ? probe.counter( k ) : -1;
+
+		best.deviation = run.m_deviation;
+		best.tolerance = run.m_tolerance;
+		best.failed    = ( run.m_deviation >= 0 ) && !( run.m_deviation <= run.m_tolerance );
+		if( !run.m_output.empty() )
+		{
+			int matched = 0;
+			best.deviation = _uv_deviation( run.m_output.c_str(), run.m_reference.c_str(), matched );
+			best.failed    = ( matched == 0 ) || !( best.deviation <= run.m_tolerance );
+		}
+	}
+	return best;
+}
+
+//results file, one line per stage, the baseline has the same format
+
+static void _write_results( const char * name, std::vector<CBenchResult> & results )
+{
+	FILE * fp = fopen( name, "w" );
+	if( !fp )
+	{
+		fprintf( stderr, "Error is opening file %s\n", name );
+		return;
+	}
+
+	fprintf( fp, "# stage load prepare solve write total peak_rss_kb iterations" );
+	for( int k = 0; k < PROBE_COUNTERS; k ++ ) fprintf( fp, " %s", CProbe::counter_name( k ) );
+	fprintf( fp, " deviation\n" );
+
+	for( size_t i = 0; i < results.size(); i ++ )
+	{
+		CBenchResult & r = results[i];
+		fprintf( fp, "%s", r.name.c_str() );
+		for( int k = 0; k < PHASE_COUNT; k ++ ) fprintf( fp, " %.3f", r.time[k] );
+		fprintf( fp, " %.3f %ld %d", r.total, r.peak_rss, r.iterations );
+		for( int k = 0; k < PROBE_COUNTERS; k ++ ) fprintf( fp, " %lld", r.counter[k] );
+		fprintf( fp, " %g\n", r.deviation );
+	}
+	fclose( fp );
+}
+
+static bool _read_results( const char * name, std::map<std::string, CBenchResult> & results )
+{
+	std::ifstream is( name );
+	if( !is.good() ) return false;
+
+	std::string line;
+	while( std::getline( is, line ) )
+	{
+		if( line.empty() || line[0] == '#' ) continue;
+
+		std::istringstream iss( line );
+		CBenchResult r;
+		iss >> r.name;
+		for( int k = 0; k < PHASE_COUNT; k ++ ) iss >> r.time[k];
+		iss >> r.total >> r.peak_rss >> r.iterations;
+		for( int k = 0; k < PROBE_COUNTERS; k ++ ) iss >> r.counter[k];
+		iss >> r.deviation;
+		if( !iss.fail() ) results[r.name] = r;
+	}
+	return true;
+}
+
+//relative growth over the threshold, and over an absolute floor against noise
+
+static bool _regressed( double current, double base, double threshold, double floor )
+{
+	return current > base * ( 1 + threshold ) && current - base > floor;
+}
+
+//compare a stage with the baseline, the regressions are appended to the note
+
+static bool _compare( CBenchResult & r, CBenchResult & base, double threshold, std::string & note )
+{
+	char buffer[256];
+	bool regressed = false;
+
+	if( _regressed( r.total, base.total, threshold, 2.0 ) )
+	{
+		snprintf( buffer, sizeof( buffer ), " total %+.0f%%", 100 * ( r.total / base.total - 1 ) );
+		note += buffer;
+		regressed = true;
+	}
+	if( _regressed( r.time[PHASE_SOLVE], base.time[PHASE_SOLVE], threshold, 2.0 ) )
+	{
+		snprintf( buffer, sizeof( buffer ), " solve %+.0f%%", 100 * ( r.time[PHASE_SOLVE] / base.time[PHASE_SOLVE] - 1 ) );
+		note += buffer;
+		regressed = true;
+	}
+	if( _regressed( (double) r.peak_rss, (double) base.peak_rss, threshold, 1024 ) )
+	{
+		snprintf( buffer, sizeof( buffer ), " rss %+.0f%%", 100 * ( (double) r.peak_rss / base.peak_rss - 1 ) );
+		note += buffer;
+		regressed = true;
+	}
+	//the boundary loops start at the lowest halfedge address, the solvers take a few iterations more or less from run to run
+	if( base.iterations >= 0 && _regressed( r.iterations, base.iterations, threshold, 0 ) )
+	{
+		snprintf( buffer, sizeof( buffer ), " iterations %d -> %d", base.iterations, r.iterations );
+		note += buffer;
+		regressed = true;
+	}
+	return regressed;
+}
+
+/*!	\brief main function to run the benchmark
+ *
+ */
+
+int main( int argc, char * argv[] )
+{
+	std::string root = ".";
+	std::string work = "benchmark";
+	std::string baseline;
+	std::vector<std::string> prefixes;
+	double threshold = 0.10;
+	int    repeat    = 1;
+	bool   save      = false;
+	bool   list      = false;
+
+	for( int i = 1; i < argc; i ++ )
+	{
+		if( strcmp( argv[i], "-root" ) == 0 && i + 1 < argc )           root      = argv[++i];
+		else if( strcmp( argv[i], "-work" ) == 0 && i + 1 < argc )      work      = argv[++i];
+		else if( strcmp( argv[i], "-stage" ) == 0 && i + 1 < argc )     prefixes.push_back( argv[++i] );
+		else if( strcmp( argv[i], "-repeat" ) == 0 && i + 1 < argc )    repeat    = atoi( argv[++i] );
+		else if( strcmp( argv[i], "-baseline" ) == 0 && i + 1 < argc )  baseline  = argv[++i];
+		else if( strcmp( argv[i], "-threshold" ) == 0 && i + 1 < argc ) threshold = atof( argv[++i] );
+		else if( strcmp( argv[i], "-save" ) == 0 )                      save      = true;
+		else if( strcmp( argv[i], "-list" ) == 0 )                      list      = true;
+		else
+		{
+			help( argv[0] );
+			return 0;
+		}
+	}
+	if( repeat < 1 ) repeat = 1;
+
+	std::vector<CBenchStage> all, stages;
+	_harmonic_stages( all );
+	_ricci_stages( all );
+	_riemann_stages( all );
+	_io_stages( all, root, "RiemannMapper/ReimannMapper" );
+	_kernel_stages( all );
+
+	for( size_t i = 0; i < all.size(); i ++ )
+	{
+		bool selected = prefixes.empty();
+		for( size_t j = 0; j < prefixes.size(); j ++ )
+		{
+			if( all[i].name.compare( 0, prefixes[j].size(), prefixes[j] ) == 0 ) selected = true;
+		}
+		if( selected ) stages.push_back( all[i] );
+	}
+
+	if( list )
+	{
+		for( size_t i = 0; i < stages.size(); i ++ ) printf( "%s\n", stages[i].name.c_str() );
+		return 0;
+	}
+
+	CProbe probe;
+	std::vector<CBenchResult> results;
+	for( size_t i = 0; i < stages.size(); i ++ )
+	{
+		fprintf( stderr, "[%d/%d] %s\n", (int) i + 1, (int) stages.size(), stages[i].name.c_str() );
+		results.push_back( _run( stages[i], probe, root, work, repeat ) );
+	}
+
+	std::map<std::string, CBenchResult> base;
+	bool compare = !baseline.empty() && !save && _read_results( baseline.c_str(), base );
+	if( !baseline.empty() && !save && !compare )
+	{
+		printf( "no baseline %s, record one with -save\n", baseline.c_str() );
+	}
+
+	printf( "\n%-44s %9s %9s %9s %9s %9s %8s %6s", "stage", "load ms", "prepare", "solve", "write", "total", "rss MB", "iters" );
+	if( probe.has_counters() ) printf( " %6s %9s", "IPC", "miss/kin" );
+	printf( "  check\n" );
+
+	int failures = 0;
+	for( size_t i = 0; i < results.size(); i ++ )
+	{
+		CBenchResult & r = results[i];
+		printf( "%-44s", r.name.c_str() );
+		for( int k = 0; k < PHASE_COUNT; k ++ ) printf( " %9.1f", r.time[k] );
+		printf( " %9.1f %8.1f", r.total, r.peak_rss / 1024.0 );
+		if( r.iterations >= 0 ) printf( " %6d", r.iterations ); else printf( " %6s", "-" );
+		if( probe.has_counters() )
+		{
+			double ipc  = ( r.counter[0] > 0 ) ? (double) r.counter[1] / r.counter[0] : 0;
+			double miss = ( r.counter[1] > 0 ) ? 1000.0 * r.counter[2] / r.counter[1] : 0;
+			printf( " %6.2f %9.2f", ipc, miss );
+		}
+
+		std::string note;
+		if( r.deviation >= 0 || r.failed )
+		{
+			char buffer[128];
+			snprintf( buffer, sizeof( buffer ), " %s %s %.2g", ( r.name.compare( 0, 7, "kernel/" ) == 0 )? "kernel": "uv",
+				r.failed ? "FAILED" : "ok", r.deviation );
+			note += buffer;
+			if( r.failed ) failures ++;
+		}
+		if( compare )
+		{
+			std::map<std::string, CBenchResult>::iterator b = base.find( r.name );
+			if( b == base.end() ) note += " new";
+			else if( _compare( r, b->second, threshold, note ) )
+			{
+				note = " REGRESSED" + note;
+				failures ++;
+			}
+		}
+		printf( " %s\n", note.c_str() );
+	}
+
+	if( !probe.has_counters() ) printf( "hardware counters are not available\n" );
+
+	std::string output = work + "/results.txt";
+	_write_results( output.c_str(), results );
+	if( save && !baseline.empty() )
+	{
+		_write_results( baseline.c_str(), results );
+		printf( "baseline recorded in %s\n", baseline.c_str() );
+	}
+
+	if( failures > 0 )
+	{
+		printf( "%d stage(s) failed the check or regressed\n", failures );
+		return 1;
+	}
+	return 0;
+}
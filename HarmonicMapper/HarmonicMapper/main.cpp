@@ -11,6 +11,8 @@
 
 /*!	Harmonic Mapping
  */
+#include <string.h>
+
 #include "Conformal/HarmonicMapper/HarmonicMapperMesh.h" //Harmonic Mapping
 #include "Conformal/HarmonicMapper/HarmonicMapper.h" //Harmonic Mapping
 
@@ -1,4 +1,5 @@
 #include "HeatFlow.h"
+#include "Trace/Trace.h"
 
 using namespace MeshLib;
 
@@ -17,6 +18,7 @@ CBaseHeatFlow::~CBaseHeatFlow()
 
 void CBaseHeatFlow::_harmonic_1_form()
 {
+	TRACE_SCOPE( "CBaseHeatFlow::_harmonic_1_form" );
     
     int vid = 0;
 
@@ -75,7 +77,7 @@ void CBaseHeatFlow::_harmonic_1_form()
 
 	  b(id) = sum_b;
 	  if( fabs( sum_b)  > 0.25 )
-      printf("(%d %f) ",  id, sum_b );
+      TRACE_GAUGE( "CBaseHeatFlow::_harmonic_1_form large divergence", sum_b );
   }
 
   
@@ -85,16 +87,22 @@ void CBaseHeatFlow::_harmonic_1_form()
 
 
 	Eigen::ConjugateGradient<Eigen::SparseMatrix<double>> solver;
-	std::cerr << "Eigen Decomposition" << std::endl;
-	solver.compute(A);
-	std::cerr << "Eigen Decomposition Finished" << std::endl;
+	{
+		TRACE_SCOPE( "CBaseHeatFlow::_harmonic_1_form compute" );
+		solver.compute(A);
+	}
 	
 	if( solver.info() != Eigen::Success )
 	{
 		std::cerr << "Waring: Eigen decomposition failed" << std::endl;
 	}
 
-	Eigen::VectorXd x = solver.solve(b);
+	Eigen::VectorXd x;
+	{
+		TRACE_SCOPE( "CBaseHeatFlow::_harmonic_1_form solve" );
+		x = solver.solve(b);
+	}
+	TRACE_COUNTER( "CBaseHeatFlow::_harmonic_1_form iterations", solver.iterations() );
 	if( solver.info() != Eigen::Success )
 	{
 		std::cerr << "Waring: Eigen decomposition failed" << std::endl;
@@ -131,7 +139,7 @@ void CBaseHeatFlow::_harmonic_1_form()
 			  CHCFEdge * e = m_pMesh->halfedgeEdge( h );
 			  sum += (m_pMesh->edgeHalfedge(e,0) == h )? e->du():-e->du();
 		  }
-		  printf("Loop Integration %f\n", sum );
+		  TRACE_GAUGE( "CBaseHeatFlow::_harmonic_1_form loop integration", sum );
 	}
 
 }
@@ -58,4 +58,4 @@ namespace MeshLib
 
   };
 }
-#endif _BASE_HEAT_FLOW_
\ No newline at end of file
+#endif //_BASE_HEAT_FLOW_
\ No newline at end of file
@@ -18,8 +18,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -236,23 +236,23 @@ template<typename V, typename E, typename F, typename H>
 class CHarmonicClosedFormMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H>  CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshFaceIterator<V,E,F,H> MeshFaceIterator;
-	typedef FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
-	typedef VertexOutHalfedgeIterator<V,E,F,H> VertexOutHalfedgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H>  CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H> MeshFaceIterator;
+	typedef MeshLib::FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::VertexOutHalfedgeIterator<V,E,F,H> VertexOutHalfedgeIterator;
 public:
 };
 
 
 typedef CHarmonicClosedFormMesh<CHCFVertex, CHCFEdge, CFace, CHCFHalfEdge> CHCFMesh;
 
-unsigned long long CHCFMesh::m_input_traits  = VERTEX_FATHER| EDGE_DU;
-unsigned long long CHCFMesh::m_output_traits = VERTEX_UV| EDGE_DU;
+template<> inline unsigned long long CBaseMesh<CHCFVertex, CHCFEdge, CFace, CHCFHalfEdge>::m_input_traits  = VERTEX_FATHER| EDGE_DU;
+template<> inline unsigned long long CBaseMesh<CHCFVertex, CHCFEdge, CFace, CHCFHalfEdge>::m_output_traits = VERTEX_UV| EDGE_DU;
 
 };
-#endif  _HARMONIC_CLOSED_FORM_MESH_H_
\ No newline at end of file
+#endif  //_HARMONIC_CLOSED_FORM_MESH_H_
\ No newline at end of file
@@ -0,0 +1,473 @@
+/*!
+*      \file Distortion.h
+*      \brief Angle and area distortion of a parameterization
+*
+*		Per face quasi-conformal distortion, corner angle error, area ratio and flips of the map
+*		from the surface point() to the parameter uv(), their histograms and global aggregates.
+*/
+/*******************************************************************************
+*      Distortion
+*
+*    Purpose:
+*
+*       Measure the quality of the uv produced by the harmonic map, the slit map, the exponential
+*       map or the Ricci flow embedding, without looking at it in the viewer
+*
+*	Input
+*       A mesh with vertex uv
+*	Output
+*       Per face measures, a json report and optionally the face colors
+*
+*******************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------------------
+
+#include "Distortion/DistortionMesh.h"
+#include "Distortion/Distortion.h"
+
+using namespace MeshLib;
+
+	CDMesh mesh;
+	mesh.read_m( "sophie.uv.m" );
+	_read_vertex_uv<CDMesh, CVertex, CEdge, CDistortionFace, CHalfEdge>( &mesh );
+
+	CDistortion<CDMesh, CVertex, CDistortionFace> distortion( & mesh );
+	distortion._measure();
+	distortion._write_report( "sophie.json", "sophie.uv.m" );
+	distortion._color( CDistortion<CDMesh, CVertex, CDistortionFace>::MU );
+
+--------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _DISTORTION_H_
+#define _DISTORTION_H_
+
+#include <vector>
+#include <stdio.h>
+#include <math.h>
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/iterators.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef PI
+#define PI 3.14159265358979323846
+#endif
+
+/*! faces per block of the reduction, the blocks are merged in order */
+#define DISTORTION_BLOCK 4096
+
+namespace MeshLib
+{
+/*! \brief CDistortionHistogram class
+*
+*	Weighted histogram of a measure over [lo,hi) with equal bins, the values out of the range
+*	are kept in the first or the last bin. Two histograms over the same range are merged by
+*	adding the bins and the moments.
+*/
+class CDistortionHistogram
+{
+public:
+	/*! CDistortionHistogram constructor */
+	CDistortionHistogram( double lo = 0, double hi = 1, int bins = 1 ) { _init( lo, hi, bins ); };
+
+	/*! empty histogram of bins bins over [lo,hi) */
+	void _init( double lo, double hi, int bins )
+	{
+		m_lo = lo; m_hi = hi;
+		m_bin.assign( bins, 0.0 );
+		m_weight = m_sum = m_sum2 = 0;
+		m_min = 1e+300; m_max = -1e+300;
+		m_count = 0;
+	};
+	/*! add the value x with weight w */
+	void add( double x, double w )
+	{
+		int n = (int) m_bin.size();
+		int k = (int) floor( ( x - m_lo ) / ( m_hi - m_lo ) * n );
+		k = ( k < 0 )? 0: ( ( k >= n )? n - 1: k );
+		m_bin[k] += w;
+		m_weight += w;
+		m_sum    += w * x;
+		m_sum2   += w * x * x;
+		m_min = ( x < m_min )? x: m_min;
+		m_max = ( x > m_max )? x: m_max;
+		m_count ++;
+	};
+	/*! add the other histogram, over the same range */
+	void merge( const CDistortionHistogram & h )
+	{
+		for( size_t k = 0; k < m_bin.size(); k ++ ) m_bin[k] += h.m_bin[k];
+		m_weight += h.m_weight;
+		m_sum    += h.m_sum;
+		m_sum2   += h.m_sum2;
+		m_min = ( h.m_min < m_min )? h.m_min: m_min;
+		m_max = ( h.m_max > m_max )? h.m_max: m_max;
+		m_count += h.m_count;
+	};
+
+	/*! weighted mean */
+	double mean() { return ( m_weight > 0 )? m_sum / m_weight: 0; };
+	/*! weighted standard deviation */
+	double deviation()
+	{
+		if( m_weight <= 0 ) return 0;
+		double m = mean();
+		double v = m_sum2 / m_weight - m * m;
+		return ( v > 0 )? sqrt( v ): 0;
+	};
+	/*! the value below which the fraction q of the weight lies, interpolated in the bins */
+	double quantile( double q )
+	{
+		if( m_weight <= 0 ) return 0;
+		double target = q * m_weight, acc = 0;
+		double width  = ( m_hi - m_lo ) / m_bin.size();
+		for( size_t k = 0; k < m_bin.size(); k ++ )
+		{
+			if( acc + m_bin[k] >= target && m_bin[k] > 0 )
+			{
+				double x = m_lo + width * ( k + ( target - acc ) / m_bin[k] );
+				return ( x < m_min )? m_min: ( ( x > m_max )? m_max: x );
+			}
+			acc += m_bin[k];
+		}
+		return m_max;
+	};
+
+	double m_lo, m_hi;
+	/*! weight in each bin */
+	std::vector<double> m_bin;
+	/*! total weight and the weighted first and second moments */
+	double m_weight, m_sum, m_sum2;
+	/*! extreme values */
+	double m_min, m_max;
+	/*! number of values */
+	int    m_count;
+};
+
+/*! \brief CDistortion class
+*
+*	Distortion of the piecewise linear map from point() to uv(). On every face with the
+*	Jacobian J, in an orthonormal frame of the surface triangle,
+*	-	the Beltrami coefficient \f$ \mu = f_{\bar z} / f_z \f$ and the dilatation
+*		\f$ K = \sigma_1 / \sigma_2 = ( 1 + |\mu| ) / ( 1 - |\mu| ) \f$,
+*	-	the angle error, the largest difference of a corner angle, in degrees,
+*	-	the area ratio, uv area over surface area with both normalized by their totals, as log2,
+*	-	flips, the faces with \f$ \det J \le 0 \f$; if the total uv area is negative the whole map
+*		reverses the orientation, and v is negated first.
+*	The faces are swept in parallel, the histograms are reduced over blocks of DISTORTION_BLOCK
+*	faces merged in the block order, so the report does not depend on the number of threads.
+*	The histograms are weighted by the surface area, flipped faces are only counted.
+*
+*   \tparam M mesh class, which defines MeshFaceIterator and FaceVertexIterator
+*   \tparam V vertex class, with point() and uv()
+*   \tparam F face class, with rgb() for _color
+*/
+template<typename M, typename V, typename F>
+class CDistortion
+{
+public:
+	/*! measures, the histograms in the same order */
+	enum { MU, DILATATION, ANGLE, AREA, MEASURES };
+
+	/*! CDistortion constructor
+	 * \param pMesh the input mesh with uv
+	 */
+	CDistortion( M * pMesh ) { m_pMesh = pMesh; m_flips = 0; m_degenerate = 0; m_area = m_uv_area = 0; };
+	/*! CDistortion destructor */
+	~CDistortion(){};
+
+	/*! compute the measures of all faces and the histograms */
+	void _measure();
+	/*! write the report as json
+	 * \param name output file
+	 * \param input name of the measured mesh, written to the report
+	 * \return whether the file is written
+	 */
+	bool _write_report( const char * name, const char * input );
+	/*! color the faces by a measure, blue for none, white for moderate and red for large
+	 *  distortion; for AREA white is no change, blue shrunk and red enlarged by 16 times or
+	 *  more; flipped faces are green, degenerate ones black
+	 * \param measure MU, DILATATION, ANGLE or AREA
+	 */
+	void _color( int measure );
+
+	/*! number of faces with det J <= 0 */
+	int flips() { return m_flips; };
+	/*! number of faces with zero surface area */
+	int degenerate() { return m_degenerate; };
+	/*! histogram of a measure */
+	CDistortionHistogram & histogram( int measure ) { return m_histogram[measure]; };
+	/*! measure of the k-th face in the face order */
+	double value( int measure, int k ) { return m_value[ MEASURES * k + measure ]; };
+
+protected:
+	/*! collect the corners, fix the orientation and the totals */
+	void _gather();
+	/*! measures of face k
+	 * \return 0 if measured, 1 if flipped, 2 if degenerate
+	 */
+	int  _face( int k, double * value );
+	/*! empty histograms */
+	void _init( CDistortionHistogram * h );
+	/*! write one measure to the report */
+	void _write_measure( FILE * fp, const char * key, int measure, bool last );
+	/*! write a json string, with the quotes, backslashes and control characters escaped */
+	static void _write_string( FILE * fp, const char * s );
+
+	/*! input mesh */
+	M * m_pMesh;
+	/*! faces in the face order */
+	std::vector<F*>      m_faces;
+	/*! surface points and uv of the corners, 3 per face */
+	std::vector<CPoint>  m_point;
+	std::vector<CPoint2> m_uv;
+	/*! total surface and uv area */
+	double m_area, m_uv_area;
+
+	/*! measures, MEASURES per face */
+	std::vector<double> m_value;
+	/*! 0 measured, 1 flipped, 2 degenerate, per face */
+	std::vector<char>   m_state;
+	CDistortionHistogram m_histogram[MEASURES];
+	int m_flips;
+	int m_degenerate;
+};
+
+//collect the corners and the totals
+template<typename M, typename V, typename F>
+void CDistortion<M,V,F>::_gather()
+{
+	m_faces.clear();
+	m_point.clear();
+	m_uv.clear();
+	for( typename M::MeshFaceIterator fiter( m_pMesh ); !fiter.end(); ++ fiter )
+	{
+		F * f = *fiter;
+		m_faces.push_back( f );
+		for( typename M::FaceVertexIterator fviter( f ); !fviter.end(); ++ fviter )
+		{
+			V * v = *fviter;
+			m_point.push_back( v->point() );
+			m_uv.push_back( v->uv() );
+		}
+	}
+
+	int nf = (int) m_faces.size();
+	double area = 0, uv_area = 0;
+	for( int k = 0; k < nf; k ++ )
+	{
+		CPoint  * p = &m_point[3*k];
+		CPoint2 * q = &m_uv[3*k];
+		area    += ( ( p[1] - p[0] ) ^ ( p[2] - p[0] ) ).norm() / 2;
+		uv_area += ( ( q[1][0] - q[0][0] ) * ( q[2][1] - q[0][1] ) - ( q[1][1] - q[0][1] ) * ( q[2][0] - q[0][0] ) ) / 2;
+	}
+
+	//an orientation reversing map is measured by its mirror image
+	if( uv_area < 0 )
+	{
+		for( size_t i = 0; i < m_uv.size(); i ++ ) m_uv[i][1] = -m_uv[i][1];
+		uv_area = -uv_area;
+	}
+	m_area    = area;
+	m_uv_area = uv_area;
+};
+
+//measures of face k
+template<typename M, typename V, typename F>
+int CDistortion<M,V,F>::_face( int k, double * value )
+{
+	CPoint  * p = &m_point[3*k];
+	CPoint2 * q = &m_uv[3*k];
+
+	CPoint  e1 = p[1] - p[0], e2 = p[2] - p[0];
+	double  l1 = e1.norm();
+	double  a2 = ( e1 ^ e2 ).norm();
+	if( l1 <= 0 || a2 <= 0 ) return 2;
+
+	//frame of the triangle: p1 - p0 = ( l1, 0 ), p2 - p0 = ( s, h )
+	double s = ( e1 * e2 ) / l1;
+	double h = a2 / l1;
+	double w1x = q[1][0] - q[0][0], w1y = q[1][1] - q[0][1];
+	double w2x = q[2][0] - q[0][0], w2y = q[2][1] - q[0][1];
+
+	//J = [ w1 w2 ] [ ( l1, 0 ) ( s, h ) ]^{-1}
+	double a = w1x / l1, b = ( w2x * l1 - w1x * s ) / ( l1 * h );
+	double c = w1y / l1, d = ( w2y * l1 - w1y * s ) / ( l1 * h );
+	double det = a * d - b * c;
+
+	//f_z = ( ( a + d ) + i ( c - b ) ) / 2, f_zbar = ( ( a - d ) + i ( c + b ) ) / 2
+	double fz  = sqrt( ( a + d ) * ( a + d ) + ( c - b ) * ( c - b ) ) / 2;
+	double fzb = sqrt( ( a - d ) * ( a - d ) + ( c + b ) * ( c + b ) ) / 2;
+	value[MU]         = ( fz > 0 )? fzb / fz: 1;
+	value[DILATATION] = ( fz > fzb )? ( fz + fzb ) / ( fz - fzb ): 0;
+
+	//largest corner angle difference
+	double err = 0;
+	for( int i = 0; i < 3; i ++ )
+	{
+		CPoint  u = p[(i+1)%3] - p[i], v = p[(i+2)%3] - p[i];
+		double  x0 = q[(i+1)%3][0] - q[i][0], y0 = q[(i+1)%3][1] - q[i][1];
+		double  x1 = q[(i+2)%3][0] - q[i][0], y1 = q[(i+2)%3][1] - q[i][1];
+		double  alpha = atan2( ( u ^ v ).norm(), u * v );
+		double  beta  = atan2( fabs( x0 * y1 - y0 * x1 ), x0 * x1 + y0 * y1 );
+		err = ( fabs( alpha - beta ) > err )? fabs( alpha - beta ): err;
+	}
+	value[ANGLE] = err * 180.0 / PI;
+
+	double ratio = ( fabs( det ) * m_area ) / m_uv_area;
+	value[AREA] = ( ratio > 0 )? log( ratio ) / log( 2.0 ): -1e+300;
+
+	return ( det > 0 )? 0: 1;
+};
+
+//empty histograms
+template<typename M, typename V, typename F>
+void CDistortion<M,V,F>::_init( CDistortionHistogram * h )
+{
+	h[MU]._init( 0, 1, 50 );
+	h[DILATATION]._init( 1, 5, 40 );
+	h[ANGLE]._init( 0, 90, 45 );
+	h[AREA]._init( -4, 4, 32 );
+};
+
+//sweep the faces in parallel, reduce the blocks in order
+template<typename M, typename V, typename F>
+void CDistortion<M,V,F>::_measure()
+{
+	_gather();
+
+	int nf = (int) m_faces.size();
+	int nb = ( nf + DISTORTION_BLOCK - 1 ) / DISTORTION_BLOCK;
+	m_value.assign( MEASURES * nf, 0.0 );
+	m_state.assign( nf, 0 );
+
+	std::vector<CDistortionHistogram> blocks( MEASURES * nb );
+	std::vector<int> flips( nb, 0 ), degenerate( nb, 0 );
+
+#pragma omp parallel for schedule(dynamic)
+	for( int b = 0; b < nb; b ++ )
+	{
+		CDistortionHistogram * h = &blocks[ MEASURES * b ];
+		_init( h );
+		int end = ( b + 1 ) * DISTORTION_BLOCK;
+		end = ( end < nf )? end: nf;
+		for( int k = b * DISTORTION_BLOCK; k < end; k ++ )
+		{
+			double * value = &m_value[ MEASURES * k ];
+			int state = _face( k, value );
+			m_state[k] = (char) state;
+			if( state == 1 ) flips[b] ++;
+			if( state == 2 ) degenerate[b] ++;
+			if( state != 0 ) continue;
+
+			CPoint * p = &m_point[3*k];
+			double w = ( ( p[1] - p[0] ) ^ ( p[2] - p[0] ) ).norm() / 2 / m_area;
+			for( int m = 0; m < MEASURES; m ++ ) h[m].add( value[m], w );
+		}
+	}
+
+	_init( m_histogram );
+	m_flips = m_degenerate = 0;
+	for( int b = 0; b < nb; b ++ )
+	{
+		for( int m = 0; m < MEASURES; m ++ ) m_histogram[m].merge( blocks[ MEASURES * b + m ] );
+		m_flips      += flips[b];
+		m_degenerate += degenerate[b];
+	}
+};
+
+//one measure of the report
+template<typename M, typename V, typename F>
+void CDistortion<M,V,F>::_write_measure( FILE * fp, const char * key, int measure, bool last )
+{
+	CDistortionHistogram & h = m_histogram[measure];
+	bool empty = ( h.m_count == 0 );
+	fprintf( fp, "  \"%s\": { \"mean\": %.6g, \"std\": %.6g, \"min\": %.6g, \"max\": %.6g, \"p50\": %.6g, \"p90\": %.6g, \"p99\": %.6g,\n",
+		key, h.mean(), h.deviation(), empty? 0: h.m_min, empty? 0: h.m_max, h.quantile( 0.5 ), h.quantile( 0.9 ), h.quantile( 0.99 ) );
+	fprintf( fp, "    \"histogram\": { \"lo\": %g, \"hi\": %g, \"weights\": [", h.m_lo, h.m_hi );
+	for( size_t k = 0; k < h.m_bin.size(); k ++ )
+		fprintf( fp, "%s%.6g", k? ", ": "", h.m_bin[k] );
+	fprintf( fp, "] } }%s\n", last? "": "," );
+};
+
+//json string, a windows path has backslashes
+template<typename M, typename V, typename F>
+void CDistortion<M,V,F>::_write_string( FILE * fp, const char * s )
+{
+	fputc( '"', fp );
+	for( ; *s; s ++ )
+	{
+		if( *s == '"' || *s == '\\' ) fputc( '\\', fp );
+		if( (unsigned char) *s < 0x20 ) fprintf( fp, "\\u%04x", (unsigned char) *s );
+		else fputc( *s, fp );
+	}
+	fputc( '"', fp );
+};
+
+//json report
+template<typename M, typename V, typename F>
+bool CDistortion<M,V,F>::_write_report( const char * name, const char * input )
+{
+	FILE * fp = fopen( name, "w" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Unable to open file: %s\n", name );
+		return false;
+	}
+
+	int nf = (int) m_faces.size();
+	fprintf( fp, "{\n" );
+	fprintf( fp, "  \"mesh\": " );
+	_write_string( fp, input );
+	fprintf( fp, ",\n" );
+	fprintf( fp, "  \"faces\": %d,\n", nf );
+	fprintf( fp, "  \"flips\": %d,\n", m_flips );
+	fprintf( fp, "  \"degenerate\": %d,\n", m_degenerate );
+	fprintf( fp, "  \"area\": %.10g,\n", m_area );
+	fprintf( fp, "  \"uv_area\": %.10g,\n", m_uv_area );
+	fprintf( fp, "  \"measured_area\": %.6g,\n", m_histogram[MU].m_weight );
+	_write_measure( fp, "mu",           MU,         false );
+	_write_measure( fp, "dilatation",   DILATATION, false );
+	_write_measure( fp, "angle_error",  ANGLE,      false );
+	_write_measure( fp, "log2_area_ratio", AREA,    true  );
+	fprintf( fp, "}\n" );
+
+	fclose( fp );
+	return true;
+};
+
+//face colors
+template<typename M, typename V, typename F>
+void CDistortion<M,V,F>::_color( int measure )
+{
+	int nf = (int) m_faces.size();
+
+#pragma omp parallel for
+	for( int k = 0; k < nf; k ++ )
+	{
+		F * f = m_faces[k];
+		if( m_state[k] == 1 ) { f->rgb() = CPoint( 0, 1, 0 ); continue; }
+		if( m_state[k] == 2 ) { f->rgb() = CPoint( 0, 0, 0 ); continue; }
+
+		//t in [0,1], 0 for no distortion
+		double x = m_value[ MEASURES * k + measure ], t = 0;
+		switch( measure )
+		{
+		case MU:         t = x;                break;
+		case DILATATION: t = ( x - 1 ) / 4;    break;
+		case ANGLE:      t = x / 45;           break;
+		case AREA:       t = 0.5 + x / 8;      break;
+		}
+		t = ( t < 0 )? 0: ( ( t > 1 )? 1: t );
+
+		//blue, white, red
+		if( t < 0.5 ) f->rgb() = CPoint( 2 * t, 2 * t, 1 );
+		else          f->rgb() = CPoint( 1, 2 - 2 * t, 2 - 2 * t );
+	}
+};
+
+}
+#endif  //_DISTORTION_H_
@@ -0,0 +1,67 @@
+/*!
+*      \file DistortionMesh.h
+*      \brief Mesh for measuring the distortion of a parameterization
+*
+*/
+/*******************************************************************************
+*      Distortion Mesh
+*
+*    Purpose:
+*
+*       Mesh with vertex uv, read from the vertex strings, and face color, written to the face strings
+*
+*******************************************************************************/
+
+#ifndef  _DISTORTION_MESH_H_
+#define  _DISTORTION_MESH_H_
+
+#include "Mesh/Vertex.h"
+#include "Mesh/Edge.h"
+#include "Mesh/Face.h"
+#include "Mesh/HalfEdge.h"
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/iterators.h"
+
+namespace MeshLib
+{
+/*! \brief CDistortionFace class
+*
+*	Face class for the distortion measures
+*   traits: face color m_rgb
+*/
+class CDistortionFace : public  CFace
+{
+public:
+	/*! CDistortionFace constructor */
+	CDistortionFace() { m_rgb = CPoint(1,1,1); };
+	/*! face color */
+	CPoint & rgb() { return m_rgb; };
+protected:
+	/*! face color */
+	CPoint m_rgb;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------------------------
+
+	Distortion Mesh
+
+----------------------------------------------------------------------------------------------------------------------------------------*/
+/*!	\brief CDistortionMesh class
+*
+*	Mesh class for the distortion measures
+*/
+template<typename V, typename E, typename F, typename H>
+class CDistortionMesh : public CBaseMesh<V,E,F,H>
+{
+public:
+	typedef MeshLib::MeshFaceIterator<V,E,F,H>   MeshFaceIterator;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H>   MeshEdgeIterator;
+	typedef MeshLib::FaceVertexIterator<V,E,F,H> FaceVertexIterator;
+};
+
+typedef CDistortionMesh<CVertex, CEdge, CDistortionFace, CHalfEdge> CDMesh;
+
+};
+#endif  //_DISTORTION_MESH_H_
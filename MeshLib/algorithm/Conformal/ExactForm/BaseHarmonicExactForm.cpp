@@ -9,13 +9,14 @@
 */
 
 #include "BaseHarmonicExactForm.h"
+#include "Trace/Trace.h"
 
 using namespace MeshLib;
 
 
 //CBaseHarmonicExactForm constructor
 // pMesh is the input mesh
-CBaseHarmonicExactForm::CBaseHarmonicExactForm( CHarmonicMesh * pMesh ):m_pMesh( pMesh ), m_boundary( m_pMesh )
+CBaseHarmonicExactForm::CBaseHarmonicExactForm( CHarmonicMesh * pMesh ):m_pMesh( pMesh ), m_boundary( m_pMesh ), m_iterations( 0 )
 {
 
 	int vid  = 0;
@@ -52,6 +53,7 @@ CBaseHarmonicExactForm::~CBaseHarmonicExactForm()
 
 void CBaseHarmonicExactForm::_harmonic_exact_form( CHarmonicMesh::CHLoop * pL )
 {
+	TRACE_SCOPE( "CBaseHarmonicExactForm::_harmonic_exact_form" );
 	for( CHarmonicMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
 	{
 		CHVertex * pV = *viter;
@@ -109,9 +111,10 @@ void CBaseHarmonicExactForm::_harmonic_exact_form( CHarmonicMesh::CHLoop * pL )
 
 
 	Eigen::ConjugateGradient<Eigen::SparseMatrix<double>> solver;
-	std::cerr << "Eigen Decomposition" << std::endl;
-	solver.compute(A);
-	std::cerr << "Eigen Decomposition Finished" << std::endl;
+	{
+		TRACE_SCOPE( "CBaseHarmonicExactForm::_harmonic_exact_form compute" );
+		solver.compute(A);
+	}
 	
 	if( solver.info() != Eigen::Success )
 	{
@@ -129,11 +132,17 @@ void CBaseHarmonicExactForm::_harmonic_exact_form( CHarmonicMesh::CHLoop * pL )
 	}
 
 	Eigen::VectorXd c = B * b;
-	Eigen::VectorXd x = solver.solve(c);
+	Eigen::VectorXd x;
+	{
+		TRACE_SCOPE( "CBaseHarmonicExactForm::_harmonic_exact_form solve" );
+		x = solver.solve(c);
+	}
 	if( solver.info() != Eigen::Success )
 	{
 		std::cerr << "Waring: Eigen decomposition failed" << std::endl;
 	}
+	m_iterations += (int) solver.iterations();
+	TRACE_COUNTER( "CBaseHarmonicExactForm::_harmonic_exact_form iterations", solver.iterations() );
 	
 	for( CHarmonicMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
 	{
@@ -167,9 +176,10 @@ void CBaseHarmonicExactForm::calculate_harmonic_exact_form(const char * prefix )
 
 	std::vector<CHarmonicMesh::CHLoop*>& loops = m_boundary.loops();
 
+	m_iterations = 0;
 	for( size_t k = 1; k < loops.size(); k ++ )
 	{
-		printf("%f \n", loops[k]->length());
+		TRACE_GAUGE( "CBaseHarmonicExactForm::calculate_harmonic_exact_form loop length", loops[k]->length() );
 	}
 
 	for( size_t k = 1; k < loops.size(); k ++ )
@@ -177,7 +187,7 @@ void CBaseHarmonicExactForm::calculate_harmonic_exact_form(const char * prefix )
 	  _harmonic_exact_form( loops[k] );
 
 	  std::stringstream iss;
-	  iss << prefix << "_" << k-1 << ".du.m ";
+	  iss << prefix << "_" << k-1 << ".du.m";
 	  m_pMesh->write_m( iss.str().c_str() );
 	}
 }
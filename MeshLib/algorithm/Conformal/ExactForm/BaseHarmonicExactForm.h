@@ -79,6 +79,9 @@ namespace MeshLib
 	*   \param prefix the prefix of output mesh file
 	*/
     void calculate_harmonic_exact_form( const char * prefix);
+	/*!	Number of conjugate gradient steps of the last calculate_harmonic_exact_form, over all the boundaries
+	*/
+	int iterations() { return m_iterations; };
 
   protected:
 	  /*! the input mesh */
@@ -99,7 +102,9 @@ namespace MeshLib
 	int  m_interior_vertices;
 	/*! number of boundary vertices */
 	int  m_boundary_vertices;
+	/*! number of conjugate gradient steps */
+	int  m_iterations;
 	
   };
 }
-#endif _SLIT_MAP_BASE_HARMONIC_EXACT_FORM_H_
\ No newline at end of file
+#endif //_SLIT_MAP_BASE_HARMONIC_EXACT_FORM_H_
\ No newline at end of file
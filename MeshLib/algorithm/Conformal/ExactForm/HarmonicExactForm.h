@@ -88,4 +88,4 @@ namespace MeshLib
 	
   };
 }
-#endif _SLIT_MAP_HARMONIC_EXACT_FORM_H_
\ No newline at end of file
+#endif //_SLIT_MAP_HARMONIC_EXACT_FORM_H_
\ No newline at end of file
@@ -18,8 +18,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -190,10 +190,10 @@ class CHMesh : public CBaseMesh<V,E,F,H>
 public:
 	typedef CBoundary<V,E,F,H>  HBoundary;
 	typedef CLoop<V,E,F,H> CHLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H>   MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef MeshFaceIterator<V,E,F,H>     MeshFaceIterator;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H>   MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H>     MeshFaceIterator;
 	
 public:
 };
@@ -201,7 +201,7 @@ public:
 
 typedef CHMesh<CHVertex, CHEdge, CFace, CHHalfEdge> CHarmonicMesh;
 
-unsigned long long CHarmonicMesh::m_input_traits  = 0;
-unsigned long long CHarmonicMesh::m_output_traits = VERTEX_UV;
+template<> inline unsigned long long CBaseMesh<CHVertex, CHEdge, CFace, CHHalfEdge>::m_input_traits  = 0;
+template<> inline unsigned long long CBaseMesh<CHVertex, CHEdge, CFace, CHHalfEdge>::m_output_traits = VERTEX_UV;
 };
-#endif  _HARMONIC_MESH_H_
\ No newline at end of file
+#endif  //_HARMONIC_MESH_H_
\ No newline at end of file
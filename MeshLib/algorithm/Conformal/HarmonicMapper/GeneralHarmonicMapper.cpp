@@ -12,6 +12,7 @@
 #include "GeneralHarmonicMapper.h"
 #include "Structure/Structure.h"
 #include "Mesh/iterators.h"
+#include "Trace/Trace.h"
 
 using namespace MeshLib;
 using std::vector;
@@ -96,7 +97,7 @@ void CGeneralHarmonicMapper::_set_boundary()
 		hedges.push_back( ph );
 	}
 
-	printf("Number of corners is %d\n", corners.size());
+	printf("Number of corners is %d\n", (int) corners.size());
 	
 	int k = 1;
 	for( std::list<CHarmonicVertex*>::iterator viter = corners.begin(); viter != corners.end(); viter ++ )
@@ -139,7 +140,7 @@ void CGeneralHarmonicMapper::_set_boundary()
 		pSeg->push_back( ph );
 	}
 
-	printf("Number of segments is %d\n", boundaries.size());
+	printf("Number of segments is %d\n", (int) boundaries.size());
 
 	
 	for( size_t i = 0; i < boundaries.size(); i ++ )
@@ -176,6 +177,7 @@ void CGeneralHarmonicMapper::_set_boundary()
 */
 void CGeneralHarmonicMapper::_map()
 {
+	TRACE_SCOPE( "CGeneralHarmonicMapper::_map" );
 	//fix the boundary
 	_set_boundary();
 
@@ -223,9 +225,10 @@ void CGeneralHarmonicMapper::_map()
 
 
 	Eigen::ConjugateGradient<Eigen::SparseMatrix<double>> solver;
-	std::cerr << "Eigen Decomposition" << std::endl;
-	solver.compute(A);
-	std::cerr << "Eigen Decomposition Finished" << std::endl;
+	{
+		TRACE_SCOPE( "CGeneralHarmonicMapper::_map compute" );
+		solver.compute(A);
+	}
 	
 	if( solver.info() != Eigen::Success )
 	{
@@ -248,7 +251,12 @@ void CGeneralHarmonicMapper::_map()
 		
 		Eigen::VectorXd c = B * b;
 
-		Eigen::VectorXd x = solver.solve(c);
+		Eigen::VectorXd x;
+		{
+			TRACE_SCOPE( "CGeneralHarmonicMapper::_map solve" );
+			x = solver.solve(c);
+		}
+		TRACE_COUNTER( "CGeneralHarmonicMapper::_map iterations", solver.iterations() );
 		
 		if( solver.info() != Eigen::Success )
 		{
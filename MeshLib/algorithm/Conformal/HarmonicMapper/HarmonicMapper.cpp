@@ -13,6 +13,7 @@
 #include "HarmonicMapper.h"
 #include "Structure/Structure.h"
 #include "Mesh/iterators.h"
+#include "Trace/Trace.h"
 #include "Eigen/Sparse"
 
 using namespace MeshLib;
@@ -27,7 +28,7 @@ using std::vector;
 *	Count the number of interior vertices, boundary vertices and the edge weight
 *
 */
-CHarmonicMapper::CHarmonicMapper( CHMMesh* pMesh ): m_pMesh( pMesh ), m_boundary( m_pMesh )
+CHarmonicMapper::CHarmonicMapper( CHMMesh* pMesh ): m_pMesh( pMesh ), m_boundary( m_pMesh ), m_iterations( 0 )
 {
 
 	int vid  = 0; //interior vertex ID 
@@ -113,6 +114,7 @@ void CHarmonicMapper::_set_boundary()
 */
 void CHarmonicMapper::_map()
 {
+	TRACE_SCOPE( "CHarmonicMapper::_map" );
 	//fix the boundary
 	_set_boundary();
 
@@ -163,9 +165,10 @@ void CHarmonicMapper::_map()
 
 
 	Eigen::ConjugateGradient<Eigen::SparseMatrix<double>> solver;
-	std::cerr << "Eigen Decomposition" << std::endl;
-	solver.compute(A);
-	std::cerr << "Eigen Decomposition Finished" << std::endl;
+	{
+		TRACE_SCOPE( "CHarmonicMapper::_map compute" );
+		solver.compute(A);
+	}
 	
 	if( solver.info() != Eigen::Success )
 	{
@@ -173,6 +176,7 @@ void CHarmonicMapper::_map()
 	}
 
 
+	m_iterations = 0;
 	for( int k = 0; k < 2; k ++ )
 	{
 		Eigen::VectorXd b(m_boundary_vertices);
@@ -188,11 +192,17 @@ void CHarmonicMapper::_map()
 		Eigen::VectorXd c(m_interior_vertices);
 		c = B * b;
 
-		Eigen::VectorXd x = solver.solve(c);
+		Eigen::VectorXd x;
+		{
+			TRACE_SCOPE( "CHarmonicMapper::_map solve" );
+			x = solver.solve(c);
+		}
 		if( solver.info() != Eigen::Success )
 		{
 			std::cerr << "Waring: Eigen decomposition failed" << std::endl;
 		}
+		m_iterations += (int) solver.iterations();
+		TRACE_COUNTER( "CHarmonicMapper::_map iterations", solver.iterations() );
 
 		//set the images of the harmonic map to interior vertices
 		for( CHMMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
@@ -212,6 +222,7 @@ void CHarmonicMapper::_map()
 */
 void CHarmonicMapper::_iterative_map( double epsilon )
 {
+	TRACE_SCOPE( "CHarmonicMapper::_iterative_map" );
 	//fix the boundary
 	_set_boundary();
 
@@ -224,8 +235,10 @@ void CHarmonicMapper::_iterative_map( double epsilon )
 		pV->huv() = CPoint2(0,0);
 	}
 	
+	m_iterations = 0;
 	while( true )
 	{
+		m_iterations ++;
 		double error = -1e+10;
 		//move interior each vertex to its center of neighbors
 		for( CHMMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
@@ -248,9 +261,7 @@ void CHarmonicMapper::_iterative_map( double epsilon )
 			error = (verror > error )?verror:error; 
 			pV->huv() = suv;
 		}
-#ifdef _HARMONIC_MAP_DEBUG_
-		printf("Current max error is %f\n", error );
-#endif
+		TRACE_GAUGE( "CHarmonicMapper::_iterative_map error", error );
 		if( error < epsilon ) break;
 	}	
 }
@@ -52,6 +52,10 @@ namespace MeshLib
 		 *	\param epsilon error threshould
 		 */	
 		void _iterative_map( double threshould = 5e-4 );
+		/*!	Number of iterations of the last map, conjugate gradient steps of both coordinates
+		 *	for _map, sweeps for _iterative_map
+		 */
+		int iterations() { return m_iterations; };
 
 	protected:
 		/*!	fix the boundary vertices to the unit circle
@@ -71,6 +75,9 @@ namespace MeshLib
 		/*! number of boundary vertices
 		*/
 		int m_boundary_vertices;
+		/*!	number of iterations of the last map
+		 */
+		int m_iterations;
 	};
 }
 
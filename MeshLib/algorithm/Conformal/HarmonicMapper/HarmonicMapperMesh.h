@@ -17,8 +17,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -212,16 +212,16 @@ template<typename V, typename E, typename F, typename H>
 class CHarmonicMapperMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H> CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
-	typedef MeshFaceIterator<V,E,F,H> MeshFaceIterator;
-	typedef FaceVertexIterator<V,E,F,H> FaceVertexIterator;
-	typedef VertexFaceIterator<V,E,F,H> VertexFaceIterator;
-	typedef FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H> CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H> MeshFaceIterator;
+	typedef MeshLib::FaceVertexIterator<V,E,F,H> FaceVertexIterator;
+	typedef MeshLib::VertexFaceIterator<V,E,F,H> VertexFaceIterator;
+	typedef MeshLib::FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
 };
 
 /*! Mesh class for CHarmonicMapper class, Abbreviated as 'CHMMesh'
@@ -229,7 +229,7 @@ public:
 typedef CHarmonicMapperMesh<CHarmonicVertex, CHarmonicEdge, CHarmonicFace, CHarmonicHalfEdge> CHMMesh;	
 /*! CHMMesh has no input traits, and has VERTEX_UV output traits
  */
-unsigned long long CHMMesh::m_input_traits = 0;
-unsigned long long CHMMesh::m_output_traits = VERTEX_UV;
+template<> inline unsigned long long CBaseMesh<CHarmonicVertex, CHarmonicEdge, CHarmonicFace, CHarmonicHalfEdge>::m_input_traits = 0;
+template<> inline unsigned long long CBaseMesh<CHarmonicVertex, CHarmonicEdge, CHarmonicFace, CHarmonicHalfEdge>::m_output_traits = VERTEX_UV;
 };
-#endif  _HARMONIC_MAPPER_MESH_H_
\ No newline at end of file
+#endif  //_HARMONIC_MAPPER_MESH_H_
\ No newline at end of file
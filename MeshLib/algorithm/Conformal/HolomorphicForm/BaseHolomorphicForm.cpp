@@ -0,0 +1,454 @@
+/*! \file BaseHolomorphicForm.cpp
+*   \brief Implementation of BaseHolomorphicForm class
+*
+*   Computing Hodge Star operator and holomorphic 1-form basis on the mesh.
+*   
+*/
+#include "BaseHolomorphicForm.h"
+#include "Trace/Trace.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace MeshLib;
+
+
+//-----------------------------------------------------------------------------
+//Wedge product
+
+double CWedgeOperator::wedge_product()
+{
+
+	double p = 0;
+	for( CHoloFormMesh::MeshFaceIterator fiter( m_pMesh[0] ); !fiter.end(); ++ fiter )
+	{
+		CHoloFormFace * f0 = *fiter;
+		CHoloFormFace * f1 = m_pMesh[1]->idFace( f0->id() );
+		
+		std::vector<CHoloFormHalfEdge*> h0,h1;
+		for( CHoloFormMesh::FaceHalfedgeIterator fhiter( f0 ); !fhiter.end(); ++fhiter )
+		{
+			CHoloFormHalfEdge * h = *fhiter;
+			h0.push_back( h );
+		}
+
+		for( CHoloFormMesh::FaceHalfedgeIterator fhiter( f1 ); !fhiter.end(); ++fhiter )
+		{
+			CHoloFormHalfEdge * h = *fhiter;
+			h1.push_back( h );
+		}
+
+		CVertex *  s0 = m_pMesh[0]->halfedgeSource( h0.front() );
+		for( size_t i = 0; i < 3; i ++ )
+		{
+			CHoloFormHalfEdge * h = h1.front();
+			CVertex *   s = m_pMesh[1]->halfedgeSource( h );
+			if( s->id() != s0->id() )
+			{
+				h1.erase( h1.begin() );
+				h1.push_back( h );
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		std::vector<double> du0,du1;
+		for( size_t i = 0; i < 3; i ++ )
+		{
+			CHoloFormHalfEdge * h = h0[i];
+			CHoloFormEdge * e = m_pMesh[0]->halfedgeEdge( h );
+			double du = ( h == m_pMesh[0]->edgeHalfedge( e, 0 )  )? e->du():-e->du();
+			du0.push_back( du );	
+		}
+
+		for( size_t i = 0; i < 3; i ++ )
+		{
+			CHoloFormHalfEdge * h = h1[i];
+			CHoloFormEdge * e = m_pMesh[1]->halfedgeEdge( h );
+			double du = ( h == m_pMesh[1]->edgeHalfedge( e, 0 )  )? e->du():-e->du();
+			du1.push_back( du );	
+		}
+
+
+		
+		//	 |du0[0] du0[1] du0[2]|
+		//	 |du1[0] du1[1] du1[2]| /6
+		//	 |1      1      1     |
+		 
+		p += ( du0[1] * du1[2] - du0[2] * du1[1] ) /2.0;
+	}
+	return p;
+};
+
+//Hodge Star operator
+
+double CWedgeOperator::wedge_star_product()
+{
+
+	double p = 0;
+	for( CHoloFormMesh::MeshFaceIterator fiter( m_pMesh[0] ); !fiter.end(); ++ fiter )
+	{
+		CHoloFormFace * f0 = *fiter;
+		CHoloFormFace * f1 = m_pMesh[1]->idFace( f0->id() );
+
+		std::vector<CHoloFormHalfEdge*> h0,h1;
+		for( CHoloFormMesh::FaceHalfedgeIterator fhiter( f0 ); !fhiter.end(); ++fhiter )
+		{
+			CHoloFormHalfEdge * h = *fhiter;
+			h0.push_back( h );
+		}
+
+		for( CHoloFormMesh::FaceHalfedgeIterator fhiter( f1 ); !fhiter.end(); ++fhiter )
+		{
+			CHoloFormHalfEdge * h = *fhiter;
+			h1.push_back( h );
+		}
+
+		CVertex *  s0 = m_pMesh[0]->halfedgeSource( h0.front() );
+		for( size_t i = 0; i < 3; i ++ )
+		{
+			CHoloFormHalfEdge * h = h1.front();
+			CVertex *   s = m_pMesh[1]->halfedgeSource( h );
+			if( s->id() != s0->id() )
+			{
+				h1.erase( h1.begin() );
+				h1.push_back( h );
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		std::vector<double> du0,du1,theta;
+		for( size_t i = 0; i < 3; i ++ )
+		{
+			CHoloFormHalfEdge * h = h0[i];
+			CHoloFormEdge * e = m_pMesh[0]->halfedgeEdge( h );
+			double du = ( h == m_pMesh[0]->edgeHalfedge( e, 0 )  )? e->du():-e->du();
+			du0.push_back( du );	
+			theta.push_back( h0[(i+1)%3]->angle() );
+		}
+
+		for( size_t i = 0; i < 3; i ++ )
+		{
+			CHoloFormHalfEdge * h = h1[i];
+			CHoloFormEdge * e = m_pMesh[1]->halfedgeEdge( h );
+			double du = ( h == m_pMesh[1]->edgeHalfedge( e, 0 )  )? e->du():-e->du();
+			du1.push_back( du );	
+		}
+	
+
+		p += 0.5 * du0[0] * du1[0] * cos( theta[0] )/sin( theta[0] );
+		p += 0.5 * du0[1] * du1[1] * cos( theta[1] )/sin( theta[1] );
+		p += 0.5 * du0[2] * du1[2] * cos( theta[2] )/sin( theta[2] );
+	}
+	return p;
+};
+
+//CWedgeOperator constructor
+//\param mesh0, mesh1 two input harmonic 1-forms
+
+CWedgeOperator::CWedgeOperator(CHoloFormMesh * mesh0, CHoloFormMesh * mesh1)
+{
+	m_pMesh[0] = mesh0;
+	m_pMesh[1] = mesh1;
+};
+
+//CWedgeOperator destructor
+
+CWedgeOperator::~CWedgeOperator()
+{
+
+};
+
+//CWedgeGram constructor
+//\param meshes the harmonic 1-forms, sharing the same connectivity and geometry
+
+CWedgeGram::CWedgeGram( std::vector<CHoloFormMesh*> & meshes ): m_meshes( meshes )
+{
+	assert( m_meshes.size() > 0 );
+	_gather();
+};
+
+//CWedgeGram destructor
+
+CWedgeGram::~CWedgeGram()
+{
+};
+
+//Gather all the 1-forms into face x 3 arrays, the halfedges of each face are aligned with
+//the halfedges of the same face in the first mesh
+
+void CWedgeGram::_gather()
+{
+	CHoloFormMesh * pM0 = m_meshes[0];
+	int nf = pM0->numFaces();
+	int n  = m_meshes.size();
+
+	for( int c = 0; c < 3; c ++ )
+	{
+		m_du[c] = Eigen::MatrixXd::Zero( nf, n );
+	}
+	m_cot = Eigen::MatrixXd::Zero( nf, 3 );
+
+	std::vector<CHoloFormFace*> faces;
+	faces.reserve( nf );
+	for( CHoloFormMesh::MeshFaceIterator fiter( pM0 ); !fiter.end(); ++ fiter )
+	{
+		faces.push_back( *fiter );
+	}
+
+	for( int f = 0; f < nf; f ++ )
+	{
+		CHoloFormHalfEdge * h = pM0->faceHalfedge( faces[f] );
+		for( int c = 0; c < 3; c ++ )
+		{
+			double theta = pM0->halfedgeNext( h )->angle();
+			m_cot( f, c ) = cos( theta )/sin( theta );
+			h = pM0->halfedgeNext( h );
+		}
+	}
+
+	//each basis only touches its own mesh and its own column
+#pragma omp parallel for schedule(dynamic)
+	for( int k = 0; k < n; k ++ )
+	{
+		CHoloFormMesh * pM = m_meshes[k];
+
+		for( int f = 0; f < nf; f ++ )
+		{
+			CHoloFormHalfEdge * h0 = pM0->faceHalfedge( faces[f] );
+			int s0 = pM0->halfedgeSource( h0 )->id();
+
+			CHoloFormHalfEdge * h = pM->faceHalfedge( pM->idFace( faces[f]->id() ) );
+			for( int c = 0; c < 3; c ++ )
+			{
+				if( pM->halfedgeSource( h )->id() == s0 ) break;
+				h = pM->halfedgeNext( h );
+			}
+
+			for( int c = 0; c < 3; c ++ )
+			{
+				CHoloFormEdge * e = pM->halfedgeEdge( h );
+				m_du[c]( f, k ) = ( h == pM->edgeHalfedge( e, 0 ) )? e->du():-e->du();
+				h = pM->halfedgeNext( h );
+			}
+		}
+	}
+};
+
+//the faces are split into blocks, each thread accumulates the products of its blocks into its own
+//partial matrix, the partial matrices are summed in the order of the threads, such that the result
+//does not depend on which thread finishes first
+
+static int _gram_threads()
+{
+#ifdef _OPENMP
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+};
+
+static int _gram_thread()
+{
+#ifdef _OPENMP
+	return omp_get_thread_num();
+#else
+	return 0;
+#endif
+};
+
+//P = X^T Y
+
+void CWedgeGram::_block_product( const Eigen::MatrixXd & X, const Eigen::MatrixXd & Y, Eigen::MatrixXd & P )
+{
+	int nf = X.rows();
+	int n  = X.cols();
+	int nb = ( nf + WEDGE_GRAM_BLOCK - 1 ) / WEDGE_GRAM_BLOCK;
+	int nt = _gram_threads();
+
+	std::vector<Eigen::MatrixXd> partial( nt, Eigen::MatrixXd::Zero( n, n ) );
+
+#pragma omp parallel num_threads( nt )
+	{
+		Eigen::MatrixXd & Q = partial[ _gram_thread() ];
+
+#pragma omp for schedule(static)
+		for( int b = 0; b < nb; b ++ )
+		{
+			int r = b * WEDGE_GRAM_BLOCK;
+			int m = ( nf - r < WEDGE_GRAM_BLOCK )? nf - r : WEDGE_GRAM_BLOCK;
+
+			Q.noalias() += X.middleRows( r, m ).transpose() * Y.middleRows( r, m );
+		}
+	}
+
+	P = Eigen::MatrixXd::Zero( n, n );
+	for( int t = 0; t < nt; t ++ )
+	{
+		P += partial[t];
+	}
+};
+
+//P = X^T diag( w ) X, the rows are scaled by sqrt|w| and added to the lower triangle by rank updates,
+//the rows of negative weights, the obtuse corners, are subtracted
+
+void CWedgeGram::_block_gram( const Eigen::MatrixXd & X, const Eigen::VectorXd & w, Eigen::MatrixXd & P )
+{
+	int nf = X.rows();
+	int n  = X.cols();
+	int nb = ( nf + WEDGE_GRAM_BLOCK - 1 ) / WEDGE_GRAM_BLOCK;
+	int nt = _gram_threads();
+
+	std::vector<Eigen::MatrixXd> partial( nt, Eigen::MatrixXd::Zero( n, n ) );
+
+#pragma omp parallel num_threads( nt )
+	{
+		Eigen::MatrixXd & Q = partial[ _gram_thread() ];
+		Eigen::MatrixXd U( WEDGE_GRAM_BLOCK, n );
+		Eigen::MatrixXd V( WEDGE_GRAM_BLOCK, n );
+
+#pragma omp for schedule(static)
+		for( int b = 0; b < nb; b ++ )
+		{
+			int r = b * WEDGE_GRAM_BLOCK;
+			int m = ( nf - r < WEDGE_GRAM_BLOCK )? nf - r : WEDGE_GRAM_BLOCK;
+
+			int nu = 0;
+			int nv = 0;
+			for( int i = r; i < r + m; i ++ )
+			{
+				if( w[i] >= 0 ) U.row( nu ++ ) = sqrt(  w[i] ) * X.row( i );
+				else            V.row( nv ++ ) = sqrt( -w[i] ) * X.row( i );
+			}
+
+			Q.selfadjointView<Eigen::Lower>().rankUpdate( U.topRows( nu ).transpose() );
+			if( nv > 0 ) Q.selfadjointView<Eigen::Lower>().rankUpdate( V.topRows( nv ).transpose(), -1.0 );
+		}
+	}
+
+	P = Eigen::MatrixXd::Zero( n, n );
+	for( int t = 0; t < nt; t ++ )
+	{
+		P.triangularView<Eigen::Lower>() += partial[t];
+	}
+	P.triangularView<Eigen::StrictlyUpper>() = P.transpose();
+};
+
+//Wedge product matrix
+//	 |du_i[0] du_i[1] du_i[2]|
+//	 |du_j[0] du_j[1] du_j[2]| /6
+//	 |1       1       1      |
+//summed over all faces, W = ( D1^T D2 - D2^T D1 )/2
+
+void CWedgeGram::wedge_product( Eigen::MatrixXd & W )
+{
+	Eigen::MatrixXd P;
+	_block_product( m_du[1], m_du[2], P );
+	W = ( P - P.transpose() ) * 0.5;
+};
+
+//Wedge star product matrix
+//S = \sum_c D_c^T diag( cot_c ) D_c / 2, which is symmetric
+
+void CWedgeGram::wedge_star_product( Eigen::MatrixXd & S )
+{
+	int n = m_meshes.size();
+	S = Eigen::MatrixXd::Zero( n, n );
+
+	for( int c = 0; c < 3; c ++ )
+	{
+		Eigen::MatrixXd P;
+		_block_gram( m_du[c], m_cot.col(c), P );
+		S += P;
+	}
+	S *= 0.5;
+};
+
+//CBaseHolomorphicForm constructor
+//\param meshes are the basis of harmonic 1-form group
+
+CBaseHolomorphicForm::CBaseHolomorphicForm( std::list<CHoloFormMesh*> & meshes )
+{
+	for( std::list<CHoloFormMesh*>::iterator miter = meshes.begin(); miter != meshes.end(); miter ++ )
+	{
+		CHoloFormMesh * pM = *miter;
+		m_meshes.push_back( pM );
+	}
+};
+
+//CBaseHolomorphicForm destructor
+
+CBaseHolomorphicForm::~CBaseHolomorphicForm()
+{
+};
+
+
+// Compute the conjugate harmonic 1-forms for the base harmonic 1-forms
+
+void CBaseHolomorphicForm::conjugate()
+{
+	TRACE_SCOPE( "CBaseHolomorphicForm::conjugate" );
+
+	_angle_structure();
+
+	int n = m_meshes.size();
+
+
+	Eigen::MatrixXd A;
+	Eigen::MatrixXd S;
+	{
+		TRACE_SCOPE( "CBaseHolomorphicForm::conjugate wedge products" );
+		CWedgeGram gram( m_meshes );
+		gram.wedge_product( A );
+		gram.wedge_star_product( S );
+	}
+
+	//the right hand side of the i-th system is the i-th row of S, S is symmetric, all the systems
+	//share the decomposition of A
+	Eigen::MatrixXd X;
+	{
+		TRACE_SCOPE( "CBaseHolomorphicForm::conjugate solve" );
+		Eigen::JacobiSVD<Eigen::MatrixXd> svd( A, Eigen::ComputeThinU | Eigen::ComputeThinV );
+		X = svd.solve( S );
+	}
+
+	for(int i = 0; i < n ; i ++ )
+	{
+		Eigen::VectorXd x = X.col(i);
+
+		for( int j = 0; j < n ; j ++ )
+		{
+			TRACE_GAUGE( "CBaseHolomorphicForm::conjugate hodge star coefficient", x(j) );
+		}
+
+		for( CHoloFormMesh::MeshEdgeIterator eiter( m_meshes[i] ); !eiter.end(); ++ eiter )
+		{
+			CHoloFormEdge * e = *eiter;
+			e->duv()[0] = e->du();
+			e->duv()[1] = 0;
+		
+			int id1 = m_meshes[i]->edgeVertex1(e)->id();
+			int id2 = m_meshes[i]->edgeVertex2(e)->id();
+
+			for( int k = 0; k < n ; k ++ )
+			{
+				CHoloFormVertex * w1 = m_meshes[k]->idVertex( id1 );
+				CHoloFormVertex * w2 = m_meshes[k]->idVertex( id2 );
+
+				CHoloFormEdge * edge = m_meshes[k]->vertexEdge( w1, w2 );
+				e->duv()[1] += edge->du() * x(k);
+			}
+
+		}
+
+	}
+
+};
+
+
@@ -83,6 +83,9 @@ int main( int argc, char * argv[] )
 #include <Eigen/Sparse>
 
 
+/*! number of faces in one block of the Gram matrix reduction */
+#define WEDGE_GRAM_BLOCK 1024
+
 namespace MeshLib
 {
 
@@ -121,6 +124,50 @@ private:
 	CHoloFormMesh * m_pMesh[2];
 };
 
+/*! \brief CWedgeGram class
+ *
+ *	Wedge and Wedge Star products of all pairs of harmonic 1-forms in a basis.
+ *  Each 1-form is gathered once into a face x 3 array of oriented du values, aligned with
+ *  the halfedges of the first mesh, the cotangents of the corner angles are computed once,
+ *  the Gram matrices are then dense matrix products over all the faces.
+ *  With OpenMP, the face blocks are reduced in parallel, each thread fills its own
+ *  partial matrix and the partial matrices are summed in a fixed order, the symmetric
+ *  matrix is accumulated in its lower triangle by rank updates.
+ */
+class CWedgeGram
+{
+public:
+	/*! CWedgeGram constructor
+	 * \param meshes harmonic 1-forms \f$\omega_0,\omega_1,\cdots,\omega_{n-1}\f$, sharing the same
+	 *  connectivity and geometry, the corner angles of meshes[0] are used
+	 */
+	CWedgeGram( std::vector<CHoloFormMesh*> & meshes );
+	/*! CWedgeGram destructor
+	*/
+	~CWedgeGram();
+	/*! wedge product matrix
+	 *	\param W \f$ W_{ij} = \int \omega_i \wedge \omega_j \f$
+	 */
+	void wedge_product( Eigen::MatrixXd & W );
+	/*! wedge star product matrix
+	 *	\param S \f$ S_{ij} = \int \omega_i \wedge {}^*\omega_j \f$
+	 */
+	void wedge_star_product( Eigen::MatrixXd & S );
+protected:
+	/*! gather the oriented du values and the corner cotangents */
+	void _gather();
+	/*! \f$ P = X^T Y \f$, reduced over blocks of faces */
+	void _block_product( const Eigen::MatrixXd & X, const Eigen::MatrixXd & Y, Eigen::MatrixXd & P );
+	/*! \f$ P = X^T diag(w) X \f$, reduced over blocks of faces, only the lower triangle is computed, then mirrored */
+	void _block_gram( const Eigen::MatrixXd & X, const Eigen::VectorXd & w, Eigen::MatrixXd & P );
+	/*! harmonic 1-forms */
+	std::vector<CHoloFormMesh*> & m_meshes;
+	/*! m_du[c](f,k) is the du of \f$\omega_k\f$ on the c-th halfedge of the f-th face */
+	Eigen::MatrixXd m_du[3];
+	/*! m_cot(f,c) is the cotangent of the corner angle against the c-th halfedge of the f-th face */
+	Eigen::MatrixXd m_cot;
+};
+
 /*! \brief CHolomorphicForm class
  *
  *	Compute holomorphic forms on a mesh
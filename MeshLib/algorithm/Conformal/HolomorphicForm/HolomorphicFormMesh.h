@@ -16,8 +16,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -207,21 +207,21 @@ template<typename V, typename E, typename F, typename H>
 class CHolomorphicFormMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H>            CBoundary;
-	typedef CLoop<V,E,F,H>                CLoop;
-	typedef MeshVertexIterator<V,E,F,H>   MeshVertexIterator;
-	typedef MeshFaceIterator<V,E,F,H>	  MeshFaceIterator;
-	typedef MeshEdgeIterator<V,E,F,H>     MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
-	typedef FaceVertexIterator<V,E,F,H>   FaceVertexIterator;
+	typedef MeshLib::CBoundary<V,E,F,H>            CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H>                CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H>   MeshVertexIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H>	  MeshFaceIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H>     MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
+	typedef MeshLib::FaceVertexIterator<V,E,F,H>   FaceVertexIterator;
 };
 
 
 typedef CHolomorphicFormMesh<CHoloFormVertex, CHoloFormEdge, CHoloFormFace, CHoloFormHalfEdge> CHoloFormMesh;
 
-unsigned long long CHoloFormMesh::m_input_traits  = EDGE_DU;
-unsigned long long CHoloFormMesh::m_output_traits = EDGE_DUV;
+template<> inline unsigned long long CBaseMesh<CHoloFormVertex, CHoloFormEdge, CHoloFormFace, CHoloFormHalfEdge>::m_input_traits  = EDGE_DU;
+template<> inline unsigned long long CBaseMesh<CHoloFormVertex, CHoloFormEdge, CHoloFormFace, CHoloFormHalfEdge>::m_output_traits = EDGE_DUV;
 
 };
-#endif  _HOLOMORPHIC_FORM_MESH_H_
\ No newline at end of file
+#endif  //_HOLOMORPHIC_FORM_MESH_H_
\ No newline at end of file
@@ -9,6 +9,7 @@
 */
 
 #include "PolarMap.h"
+#include "Trace/Trace.h"
 
 
 
@@ -48,7 +49,7 @@ void CPolarMap::_exponential_map()
 		 x_max = (x_max > p[0])?x_max:p[0];
 	}
 
-	printf("X max is %f\n", x_max );
+	TRACE_GAUGE( "CPolarMap::_exponential_map x max", x_max );
 
 	for( CPMMesh::MeshVertexIterator viter( m_pOpenMesh ); !viter.end(); viter ++ )
 	 {
@@ -138,19 +138,19 @@ template<typename V, typename E, typename F, typename H>
 class CPolarMapMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
 public:
 };
 
 
 typedef CPolarMapMesh<CPolarMapVertex, CEdge, CFace, CHalfEdge> CPMMesh;
 
-unsigned long long CPMMesh::m_input_traits  = VERTEX_FATHER | VERTEX_UV;
-unsigned long long CPMMesh::m_output_traits = VERTEX_UV;
+template<> inline unsigned long long CBaseMesh<CPolarMapVertex, CEdge, CFace, CHalfEdge>::m_input_traits  = VERTEX_FATHER | VERTEX_UV;
+template<> inline unsigned long long CBaseMesh<CPolarMapVertex, CEdge, CFace, CHalfEdge>::m_output_traits = VERTEX_UV;
 
 };
 
-#endif  _POLAR_MAP_MESH_H_
\ No newline at end of file
+#endif  //_POLAR_MAP_MESH_H_
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*! \file SlitMap.cpp
+*  \brief Implementation  of CSlitMap class. Algorithm for computing slit mapping
+*  \author David Gu
+*  \date Documented on 10/12/2010
+*
+*	Compute slit maps
+*	
+*	The inputs are holomorphic basis for the mesh \f$\{\omega_1,\omega_2,\cdots, \omega_{n}\}\f$.
+*	Suppose the boundary components are \f$\{\gamma_0,\gamma_1,\gamma_2,\cdots, \gamma_n\}\f$.
+*	Find a new holomorphic 1-form \f$\omega = \sum_k \lambda_k \omega_k\f$, such that
+*  \f[
+*		Img \int_{\gamma_0} \omega = 2\pi, 		Img \int_{\gamma_k} \omega = -2\pi,	Img \int_{\gamma_i} \omega = 0.
+*
+*  \f]
+*/
+
+#include "SlitMap.h"
+#include "Trace/Trace.h"
+
+using namespace MeshLib;
+
+//CSlitMap constructor
+//\param meshes the input holomorphic 1-form basis
+
+CSlitMap::CSlitMap( std::vector<CSMMesh*> & meshes ): m_meshes( meshes ),m_pMesh( meshes[0]), m_boundary( m_pMesh )
+{
+	assert( m_meshes.size() > 0 );
+}
+
+//CSlitMap destructor
+CSlitMap::~CSlitMap()
+{
+}
+
+//Gather the holomorphic 1-form basis into edge indexed matrices, each basis edge is looked up only once
+
+void CSlitMap::_gather_basis()
+{
+	int num = m_meshes.size();
+	int eid = 0;
+
+	for( CSMMesh::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); ++ eiter )
+	{
+		CSlitMapEdge * e = *eiter;
+		e->idx() = eid ++;
+	}
+
+	m_du = Eigen::MatrixXd::Zero( eid, num );
+	m_dv = Eigen::MatrixXd::Zero( eid, num );
+
+	for( int k = 0; k < num; k ++ )
+	{
+		CSMMesh * pM = m_meshes[k];
+
+		for( CSMMesh::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); ++ eiter )
+		{
+			CSlitMapEdge * e = *eiter;
+			CVertex * w1 = pM->idVertex( m_pMesh->edgeVertex1( e )->id() );
+			CVertex * w2 = pM->idVertex( m_pMesh->edgeVertex2( e )->id() );
+			//the meshes share the connectivity, so an edge has the same orientation in all of them, interior
+			//edges go from the smaller vertex id to the larger one, boundary edges follow their halfedge
+			CSlitMapEdge * we = pM->vertexEdge( w1, w2 );
+			m_du( e->idx(), k ) = we->duv()[0];
+			m_dv( e->idx(), k ) = we->duv()[1];
+		}
+	}
+}
+
+//Sparse incidence matrix of the boundary loops, the integration of all the basis along
+//all the loops is the product of the incidence matrix with the gathered basis
+
+void CSlitMap::_loop_incidence( std::vector<CSMMesh::CLoop*> & loops, int num, Eigen::SparseMatrix<double> & L )
+{
+	std::vector<Eigen::Triplet<double> > L_coefficients;
+
+	for( int i = 0; i < num; i ++ )
+	{
+		CSMMesh::CLoop * pL = loops[i];
+
+		for( std::list<CHalfEdge*>::iterator hiter = pL->halfedges().begin();hiter != pL->halfedges().end(); hiter ++ )
+		{
+			CHalfEdge * he = *hiter;
+			CSlitMapEdge * e = m_pMesh->halfedgeEdge( he );
+
+			double s = ( m_pMesh->edgeVertex1( e ) == he->source() )? 1.0:-1.0;
+			L_coefficients.push_back( Eigen::Triplet<double>( i, e->idx(), s ) );
+		}
+	}
+
+	L.resize( num, m_du.rows() );
+	L.setFromTriplets( L_coefficients.begin(), L_coefficients.end() );
+}
+
+//Compute the slit map, by finding a holomorphic 1-form, the integration along c1 loop is 2PI, the integration
+//along c2 is -2PI
+
+void CSlitMap::_slit_map(int c1,int c2 ) 
+{
+	TRACE_SCOPE( "CSlitMap::_slit_map" );
+
+	std::vector<CSMMesh::CLoop*> & loops = m_boundary.loops();
+
+	int num = m_meshes.size();
+
+	if( c1 < 0 || c2 < 0 || (size_t) c1 > loops.size()  || (size_t) c2 > loops.size() )
+	{
+		printf( "The loop Id should between [0..%d]\n", (int) loops.size() );
+		return;
+	}
+
+	_gather_basis();
+
+	Eigen::SparseMatrix<double> L;
+	_loop_incidence( loops, num, L );
+
+	//A(i,j) is the imaginary part of the integration of m_meshes[j] along loops[i]
+	Eigen::MatrixXd A = L * m_dv;
+	Eigen::VectorXd b( num );
+	b.setZero();
+
+	b(c1) = 1;
+	if( num > 1 )
+	{
+		b(c2) = -1;
+	}
+
+	//Eigen::VectorXd x = solver.solve(b);
+	Eigen::VectorXd x = A.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(b);
+
+	//linear combination of the basis for all edges at once
+	Eigen::VectorXd du = m_du * x;
+	Eigen::VectorXd dv = m_dv * x;
+
+	for( CSMMesh::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); ++ eiter )
+	{
+		CSlitMapEdge * e = *eiter;
+		e->duv() = CPoint2( du( e->idx() ), dv( e->idx() ) );
+	}
+}
@@ -111,16 +111,24 @@ namespace MeshLib
 	  std::vector<CSMMesh*> & m_meshes;
 	  /*! base mesh */
 	  CSMMesh * m_pMesh;
-	  /*! integrate a holomorphic 1-form along a boundary loop pL
-	   * \param pMesh holomorphic 1-form
-	   * \param pL    the boundary loop
-	   * \return the integration of the holomorphic 1-form along the boundary loop
+	  /*! gather all the holomorphic 1-form basis into the edge indexed matrices m_du, m_dv,
+	   *  row k is the edge with idx() k in the base mesh, column j is the basis m_meshes[j]
 	   */
-	  double _integrate( CSMMesh * pMesh, CSMMesh::CLoop * pL );
+	  void _gather_basis();
+	  /*! sparse incidence matrix of the boundary loops, entry (i,k) is +1 or -1 if the loop i
+	   *  passes through edge k along or against its orientation
+	   * \param loops the boundary loops
+	   * \param num   number of loops to be used
+	   */
+	  void _loop_incidence( std::vector<CSMMesh::CLoop*> & loops, int num, Eigen::SparseMatrix<double> & L );
 	  /*! the boundary of the input mesh */
 	  CSMMesh::CBoundary m_boundary;
+	  /*! real part of the holomorphic 1-form basis, number of edges x number of basis */
+	  Eigen::MatrixXd m_du;
+	  /*! imaginary part of the holomorphic 1-form basis, number of edges x number of basis */
+	  Eigen::MatrixXd m_dv;
 	  
 
   };
 }
-#endif _SLIT_MAP_H_
\ No newline at end of file
+#endif //_SLIT_MAP_H_
\ No newline at end of file
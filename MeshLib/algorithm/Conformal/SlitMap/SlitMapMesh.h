@@ -42,6 +42,7 @@ namespace MeshLib
 *	Edge class for computing Slit maps
 *   Triat:
 *   holomorphic 1-form m_duv
+*   edge index m_index
 */
 
 class CSlitMapEdge : public  CEdge
@@ -49,13 +50,17 @@ class CSlitMapEdge : public  CEdge
   protected:
 	/*!   holomorphic 1-form defined on edge */
 	CPoint2  m_duv;
+	/*!   edge index, row of the edge in the gathered basis matrix */
+	int      m_index;
   public:
 	/*!   holomorphic 1-form defined on edge */
 	  CPoint2 & duv() { return m_duv; };
+	/*!   edge index */
+	  int     & idx() { return m_index; };
 
   public:
 	  /*! CSlitMapEdge constructor */
-    CSlitMapEdge() {};
+    CSlitMapEdge() { m_index = 0; };
 	  /*! CSlitMapEdge destructor */
     ~CSlitMapEdge(){};
 
@@ -111,20 +116,20 @@ template<typename V, typename E, typename F, typename H>
 class CSlitMapMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H> CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H> CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
 public:
 };
 
 
 typedef CSlitMapMesh<CVertex, CSlitMapEdge, CFace, CHalfEdge> CSMMesh;
 
-unsigned long long CSMMesh::m_input_traits  = EDGE_DUV;
-unsigned long long CSMMesh::m_output_traits = EDGE_DUV;
+template<> inline unsigned long long CBaseMesh<CVertex, CSlitMapEdge, CFace, CHalfEdge>::m_input_traits  = EDGE_DUV;
+template<> inline unsigned long long CBaseMesh<CVertex, CSlitMapEdge, CFace, CHalfEdge>::m_output_traits = EDGE_DUV;
 
 };
-#endif  _SLIT_MAP_MESH_H_
\ No newline at end of file
+#endif  //_SLIT_MAP_MESH_H_
\ No newline at end of file
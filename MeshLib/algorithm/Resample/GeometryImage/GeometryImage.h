@@ -0,0 +1,560 @@
+/*!
+*      \file GeometryImage.h
+*      \brief Resample a parameterized surface to a geometry image
+*
+*		The uv triangles are scan converted to a regular N x N grid, the positions, the normals and
+*		any other vertex traits are interpolated by barycentric coordinates.
+*/
+/*******************************************************************************
+*      Geometry Image
+*
+*    Purpose:
+*
+*       Rasterize the uv domain of a mesh, produced by the harmonic map, the slit map, the polar map
+*       or the Ricci flow embedding, to dense images of the 3D positions, normals and vertex traits
+*
+*	Input
+*       A mesh with vertex uv, the image size, optionally the uv domain and extra trait channels
+*	Output
+*       Float images, one per channel, the coverage mask, the raw files and bmp previews
+*
+*******************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------------------
+
+#include "GeometryImage/GeometryImage.h"
+
+using namespace MeshLib;
+
+	static void _rgb( CGeometryImageVertex * v, double * value ) { ... }
+
+	CGeometryImage<CGIMesh, CGeometryImageVertex, CFace> image( & mesh, 512 );
+	image.add_channel( "rgb", 3, _rgb );
+	image._rasterize();
+	image._write_raw( "bunny" );		//bunny_point.raw, bunny_normal.raw, bunny_rgb.raw, bunny_mask.raw, bunny.txt
+	image._write_preview( "bunny" );	//bunny_point.bmp, bunny_normal.bmp, bunny_rgb.bmp
+
+--------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _GEOMETRY_IMAGE_H_
+#define _GEOMETRY_IMAGE_H_
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <stdio.h>
+#include <math.h>
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/iterators.h"
+#include "bmp/RgbImage.h"
+#include "Geometry/NormalKernel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*! tile size in pixels, each tile is rasterized by one thread */
+#define GEOMETRY_IMAGE_TILE 32
+
+namespace MeshLib
+{
+/*! \brief CGeometryImageChannel class
+*
+*	One interpolated quantity, the corner values of all faces and the float image
+*/
+struct CGeometryImageChannel
+{
+	/*! channel name, used in the file names */
+	std::string          m_name;
+	/*! number of components */
+	int                  m_dim;
+	/*! corner values, m_corner[ ( 3 * f + k ) * m_dim + j ] */
+	std::vector<double>  m_corner;
+	/*! image, m_image[ ( row * N + col ) * m_dim + j ] */
+	std::vector<float>   m_image;
+};
+
+/*! \brief CGeometryImage class
+*
+*	Geometry image rasterizer. The pixel ( row, col ) samples the uv point at its center,
+*   row 0 is at the bottom of the domain, such that the bmp previews are upright. The image
+*   is split into tiles of GEOMETRY_IMAGE_TILE pixels, the faces are binned to the tiles
+*   they overlap in the face order, and the tiles are rasterized in parallel. A pixel
+*   covered by several faces takes the first one, the result does not depend on the number
+*   of threads.
+*
+*   Channel 0 is the position, channel 1 is the normal. The vertex normal is used if it is
+*   set, otherwise the area weighted average of the face normals.
+*
+*   \tparam M mesh class, which defines MeshFaceIterator, MeshVertexIterator and FaceVertexIterator
+*   \tparam V vertex class, with point(), normal() and uv()
+*   \tparam F face class
+*/
+template<typename M, typename V, typename F>
+class CGeometryImage
+{
+public:
+	/*! fetch the value of a vertex trait */
+	typedef void (*CFetch)( V * v, double * value );
+
+	/*! CGeometryImage constructor
+	 * \param pMesh the input mesh with uv
+	 * \param size  the image resolution N
+	 */
+	CGeometryImage( M * pMesh, int size );
+	/*! CGeometryImage destructor */
+	~CGeometryImage(){};
+
+	/*! set the uv domain, the default is the bounding box of the uv coordinates
+	 * \param lo lower left corner
+	 * \param hi upper right corner
+	 */
+	void domain( CPoint2 lo, CPoint2 hi ) { m_lo = lo; m_hi = hi; m_domain = true; };
+	/*! add a vertex trait channel
+	 * \param name  channel name
+	 * \param dim   number of components
+	 * \param fetch function which writes the dim components of the trait of a vertex
+	 * \return the channel index
+	 */
+	int  add_channel( const char * name, int dim, CFetch fetch );
+
+	/*! rasterize all the channels */
+	void _rasterize();
+	/*! write the channels as float32 row major raw files, the mask as bytes and a text header
+	 * \param prefix output file prefix
+	 * \return whether all the files are written
+	 */
+	bool _write_raw( const char * prefix );
+	/*! write bmp previews of the channels
+	 * \param prefix output file prefix
+	 * \return whether all the files are written
+	 */
+	bool _write_preview( const char * prefix );
+
+	/*! image resolution */
+	int size() { return m_size; };
+	/*! number of channels */
+	int channels() { return (int) m_channels.size(); };
+	/*! the k-th channel */
+	CGeometryImageChannel & channel( int k ) { return m_channels[k]; };
+	/*! face index of each pixel, -1 if the pixel is not covered */
+	std::vector<int> & face() { return m_face; };
+
+protected:
+	/*! collect the face corners, the uv and the values of the built-in channels */
+	void _gather();
+	/*! bin the faces to the tiles */
+	void _bin();
+	/*! rasterize the faces in one tile
+	 * \param t tile index
+	 */
+	void _rasterize_tile( int t );
+
+	/*! input mesh */
+	M * m_pMesh;
+	/*! image resolution */
+	int m_size;
+	/*! number of tiles per row */
+	int m_tiles;
+	/*! whether the domain is set by the user */
+	bool m_domain;
+	/*! uv domain */
+	CPoint2 m_lo, m_hi;
+
+	/*! vertices of the faces, 3 per face */
+	std::vector<V*>      m_corners;
+	/*! uv of the face corners */
+	std::vector<CPoint2> m_uv;
+	/*! channels */
+	std::vector<CGeometryImageChannel> m_channels;
+	/*! trait fetch functions, NULL for the built-in channels */
+	std::vector<CFetch>  m_fetch;
+
+	/*! faces in tile t are m_bin[ m_bin_offset[t] .. m_bin_offset[t+1] ) */
+	std::vector<int>     m_bin_offset;
+	/*! binned faces */
+	std::vector<int>     m_bin;
+	/*! face index of each pixel */
+	std::vector<int>     m_face;
+};
+
+//CGeometryImage constructor
+template<typename M, typename V, typename F>
+CGeometryImage<M,V,F>::CGeometryImage( M * pMesh, int size )
+{
+	m_pMesh  = pMesh;
+	m_size   = size;
+	m_tiles  = ( size + GEOMETRY_IMAGE_TILE - 1 ) / GEOMETRY_IMAGE_TILE;
+	m_domain = false;
+
+	add_channel( "point",  3, NULL );
+	add_channel( "normal", 3, NULL );
+};
+
+//add a vertex trait channel
+template<typename M, typename V, typename F>
+int CGeometryImage<M,V,F>::add_channel( const char * name, int dim, CFetch fetch )
+{
+	CGeometryImageChannel c;
+	c.m_name = name;
+	c.m_dim  = dim;
+	m_channels.push_back( c );
+	m_fetch.push_back( fetch );
+	return (int) m_channels.size() - 1;
+};
+
+//collect the face corners, the uv and the corner values
+template<typename M, typename V, typename F>
+void CGeometryImage<M,V,F>::_gather()
+{
+	m_corners.clear();
+	m_uv.clear();
+
+	for( typename M::MeshFaceIterator fiter( m_pMesh ); !fiter.end(); ++ fiter )
+	{
+		F * f = *fiter;
+		for( typename M::FaceVertexIterator fviter( f ); !fviter.end(); ++ fviter )
+		{
+			V * v = *fviter;
+			m_corners.push_back( v );
+			m_uv.push_back( v->uv() );
+		}
+	}
+
+	//area weighted normals by the normal kernel, for the vertices without normals; the corners
+	//are numbered by the distinct vertices, found in the sorted corner pointers
+	std::vector<V*> verts( m_corners );
+	std::sort( verts.begin(), verts.end() );
+	verts.erase( std::unique( verts.begin(), verts.end() ), verts.end() );
+
+	CNormalKernel kernel;
+	kernel.resize( (int) verts.size(), (int) m_corners.size() / 3 );
+	for( size_t i = 0; i < verts.size(); i ++ ) kernel.set_point( (int) i, verts[i]->point() );
+	std::vector<int> corner( m_corners.size() );
+	for( size_t i = 0; i < m_corners.size(); i ++ )
+	{
+		corner[i] = (int)( std::lower_bound( verts.begin(), verts.end(), m_corners[i] ) - verts.begin() );
+		kernel.corners()[i] = corner[i];
+	}
+	kernel._topology();
+	kernel._compute();
+
+	for( size_t c = 0; c < m_channels.size(); c ++ )
+	{
+		CGeometryImageChannel & ch = m_channels[c];
+		ch.m_corner.resize( m_corners.size() * ch.m_dim );
+
+		for( size_t i = 0; i < m_corners.size(); i ++ )
+		{
+			V * v = m_corners[i];
+			double * value = & ch.m_corner[ i * ch.m_dim ];
+
+			if( m_fetch[c] != NULL )
+			{
+				m_fetch[c]( v, value );
+				continue;
+			}
+
+			CPoint p = v->point();
+			if( c == 1 )
+			{
+				p = v->normal();
+				if( p.norm() == 0 ) p = kernel.vertex_normal( corner[i] );
+				if( p.norm() > 0 )  p /= p.norm();
+			}
+			for( int j = 0; j < 3; j ++ ) value[j] = p[j];
+		}
+	}
+
+	if( m_domain ) return;
+
+	m_lo = CPoint2(  1e+30,  1e+30 );
+	m_hi = CPoint2( -1e+30, -1e+30 );
+	for( size_t i = 0; i < m_uv.size(); i ++ )
+	{
+		for( int j = 0; j < 2; j ++ )
+		{
+			if( m_uv[i][j] < m_lo[j] ) m_lo[j] = m_uv[i][j];
+			if( m_uv[i][j] > m_hi[j] ) m_hi[j] = m_uv[i][j];
+		}
+	}
+};
+
+//bin the faces to the tiles overlapped by their pixel bounding boxes, counting pass and filling pass
+template<typename M, typename V, typename F>
+void CGeometryImage<M,V,F>::_bin()
+{
+	int nf = (int) m_corners.size() / 3;
+	std::vector<int> range( 4 * nf );
+
+	double du = ( m_hi[0] - m_lo[0] ) / m_size;
+	double dv = ( m_hi[1] - m_lo[1] ) / m_size;
+
+	m_bin_offset.assign( m_tiles * m_tiles + 1, 0 );
+
+	for( int f = 0; f < nf; f ++ )
+	{
+		double lo[2] = {  1e+30,  1e+30 };
+		double hi[2] = { -1e+30, -1e+30 };
+		for( int k = 0; k < 3; k ++ )
+		for( int j = 0; j < 2; j ++ )
+		{
+			if( m_uv[3*f+k][j] < lo[j] ) lo[j] = m_uv[3*f+k][j];
+			if( m_uv[3*f+k][j] > hi[j] ) hi[j] = m_uv[3*f+k][j];
+		}
+		//pixels whose centers lie in the bounding box
+		int c0 = (int) ceil(  ( lo[0] - m_lo[0] ) / du - 0.5 );
+		int c1 = (int) floor( ( hi[0] - m_lo[0] ) / du - 0.5 );
+		int r0 = (int) ceil(  ( lo[1] - m_lo[1] ) / dv - 0.5 );
+		int r1 = (int) floor( ( hi[1] - m_lo[1] ) / dv - 0.5 );
+		if( c0 < 0 ) c0 = 0;
+		if( c1 > m_size - 1 ) c1 = m_size - 1;
+		if( r0 < 0 ) r0 = 0;
+		if( r1 > m_size - 1 ) r1 = m_size - 1;
+
+		int * t = & range[4*f];
+		if( c0 > c1 || r0 > r1 )
+		{
+			t[0] = 0; t[1] = -1; t[2] = 0; t[3] = -1;
+			continue;
+		}
+		t[0] = c0 / GEOMETRY_IMAGE_TILE; t[1] = c1 / GEOMETRY_IMAGE_TILE;
+		t[2] = r0 / GEOMETRY_IMAGE_TILE; t[3] = r1 / GEOMETRY_IMAGE_TILE;
+
+		for( int i = t[2]; i <= t[3]; i ++ )
+		for( int j = t[0]; j <= t[1]; j ++ )
+			m_bin_offset[ i * m_tiles + j + 1 ] ++;
+	}
+
+	for( int t = 0; t < m_tiles * m_tiles; t ++ )
+		m_bin_offset[t+1] += m_bin_offset[t];
+
+	m_bin.resize( m_bin_offset.back() );
+	std::vector<int> cursor( m_bin_offset.begin(), m_bin_offset.end() - 1 );
+
+	for( int f = 0; f < nf; f ++ )
+	{
+		int * t = & range[4*f];
+		for( int i = t[2]; i <= t[3]; i ++ )
+		for( int j = t[0]; j <= t[1]; j ++ )
+			m_bin[ cursor[ i * m_tiles + j ] ++ ] = f;
+	}
+};
+
+//rasterize all the channels
+template<typename M, typename V, typename F>
+void CGeometryImage<M,V,F>::_rasterize()
+{
+	_gather();
+
+	if( !( m_hi[0] > m_lo[0] && m_hi[1] > m_lo[1] ) )
+	{
+		fprintf( stderr, "CGeometryImage: empty uv domain\n" );
+		return;
+	}
+
+	_bin();
+
+	int np = m_size * m_size;
+	m_face.assign( np, -1 );
+	for( size_t c = 0; c < m_channels.size(); c ++ )
+		m_channels[c].m_image.assign( np * m_channels[c].m_dim, 0.0f );
+
+	int nt = m_tiles * m_tiles;
+#pragma omp parallel for schedule(dynamic)
+	for( int t = 0; t < nt; t ++ )
+		_rasterize_tile( t );
+};
+
+//rasterize the faces binned to one tile, each pixel takes the first face covering its center
+template<typename M, typename V, typename F>
+void CGeometryImage<M,V,F>::_rasterize_tile( int t )
+{
+	const double eps = 1e-9;
+
+	int tc0 = ( t % m_tiles ) * GEOMETRY_IMAGE_TILE;
+	int tr0 = ( t / m_tiles ) * GEOMETRY_IMAGE_TILE;
+	int tc1 = tc0 + GEOMETRY_IMAGE_TILE - 1; if( tc1 > m_size - 1 ) tc1 = m_size - 1;
+	int tr1 = tr0 + GEOMETRY_IMAGE_TILE - 1; if( tr1 > m_size - 1 ) tr1 = m_size - 1;
+
+	double du = ( m_hi[0] - m_lo[0] ) / m_size;
+	double dv = ( m_hi[1] - m_lo[1] ) / m_size;
+
+	for( int b = m_bin_offset[t]; b < m_bin_offset[t+1]; b ++ )
+	{
+		int f = m_bin[b];
+		CPoint2 & a = m_uv[3*f+0];
+		CPoint2 & p = m_uv[3*f+1];
+		CPoint2 & q = m_uv[3*f+2];
+
+		double area = ( p - a ) ^ ( q - a );
+		if( fabs( area ) < 1e-300 ) continue;
+
+		double lo[2] = { a[0], a[1] }, hi[2] = { a[0], a[1] };
+		for( int j = 0; j < 2; j ++ )
+		{
+			lo[j] = std::min( lo[j], std::min( p[j], q[j] ) );
+			hi[j] = std::max( hi[j], std::max( p[j], q[j] ) );
+		}
+		int c0 = (int) ceil(  ( lo[0] - m_lo[0] ) / du - 0.5 ); if( c0 < tc0 ) c0 = tc0;
+		int c1 = (int) floor( ( hi[0] - m_lo[0] ) / du - 0.5 ); if( c1 > tc1 ) c1 = tc1;
+		int r0 = (int) ceil(  ( lo[1] - m_lo[1] ) / dv - 0.5 ); if( r0 < tr0 ) r0 = tr0;
+		int r1 = (int) floor( ( hi[1] - m_lo[1] ) / dv - 0.5 ); if( r1 > tr1 ) r1 = tr1;
+
+		//barycentric coordinates are affine in (u,v), w_k = ( A_k u + B_k v + C_k ) / area
+		double A[3], B[3], C[3];
+		CPoint2 * c[3] = { &a, &p, &q };
+		for( int k = 0; k < 3; k ++ )
+		{
+			CPoint2 & s = *c[(k+1)%3];
+			CPoint2 & e = *c[(k+2)%3];
+			A[k] = -( e[1] - s[1] ) / area;
+			B[k] =  ( e[0] - s[0] ) / area;
+			C[k] = ( ( e[1] - s[1] ) * s[0] - ( e[0] - s[0] ) * s[1] ) / area;
+		}
+
+		for( int row = r0; row <= r1; row ++ )
+		{
+			double v = m_lo[1] + ( row + 0.5 ) * dv;
+			for( int col = c0; col <= c1; col ++ )
+			{
+				int pix = row * m_size + col;
+				if( m_face[pix] >= 0 ) continue;
+
+				double u = m_lo[0] + ( col + 0.5 ) * du;
+				double w[3];
+				for( int k = 0; k < 3; k ++ ) w[k] = A[k] * u + B[k] * v + C[k];
+				if( w[0] < -eps || w[1] < -eps || w[2] < -eps ) continue;
+
+				m_face[pix] = f;
+				for( size_t ci = 0; ci < m_channels.size(); ci ++ )
+				{
+					CGeometryImageChannel & ch = m_channels[ci];
+					int d = ch.m_dim;
+					const double * v0 = & ch.m_corner[ ( 3 * f + 0 ) * d ];
+					const double * v1 = & ch.m_corner[ ( 3 * f + 1 ) * d ];
+					const double * v2 = & ch.m_corner[ ( 3 * f + 2 ) * d ];
+					float * out = & ch.m_image[ pix * d ];
+					for( int j = 0; j < d; j ++ )
+						out[j] = (float)( w[0] * v0[j] + w[1] * v1[j] + w[2] * v2[j] );
+				}
+				//renormalize the interpolated normal
+				float * n = & m_channels[1].m_image[ pix * 3 ];
+				double len = sqrt( (double) n[0] * n[0] + (double) n[1] * n[1] + (double) n[2] * n[2] );
+				if( len > 0 ) for( int j = 0; j < 3; j ++ ) n[j] = (float)( n[j] / len );
+			}
+		}
+	}
+};
+
+//write the channels as float32 row major raw files, the mask as bytes and a text header
+template<typename M, typename V, typename F>
+bool CGeometryImage<M,V,F>::_write_raw( const char * prefix )
+{
+	std::string name = std::string( prefix ) + ".txt";
+	FILE * fp = fopen( name.c_str(), "w" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Error: can not open %s\n", name.c_str() );
+		return false;
+	}
+	fprintf( fp, "size %d %d\n", m_size, m_size );
+	fprintf( fp, "domain %.17g %.17g %.17g %.17g\n", m_lo[0], m_lo[1], m_hi[0], m_hi[1] );
+	fprintf( fp, "mask %s_mask.raw uint8\n", prefix );
+	for( size_t c = 0; c < m_channels.size(); c ++ )
+		fprintf( fp, "channel %s %d %s_%s.raw float32\n", m_channels[c].m_name.c_str(), m_channels[c].m_dim, prefix, m_channels[c].m_name.c_str() );
+	fclose( fp );
+
+	bool success = true;
+	for( size_t c = 0; c < m_channels.size(); c ++ )
+	{
+		name = std::string( prefix ) + "_" + m_channels[c].m_name + ".raw";
+		fp = fopen( name.c_str(), "wb" );
+		if( fp == NULL )
+		{
+			fprintf( stderr, "Error: can not open %s\n", name.c_str() );
+			success = false;
+			continue;
+		}
+		std::vector<float> & image = m_channels[c].m_image;
+		if( !image.empty() && fwrite( &image[0], sizeof(float), image.size(), fp ) != image.size() ) success = false;
+		fclose( fp );
+	}
+
+	name = std::string( prefix ) + "_mask.raw";
+	fp = fopen( name.c_str(), "wb" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Error: can not open %s\n", name.c_str() );
+		return false;
+	}
+	std::vector<unsigned char> mask( m_face.size() );
+	for( size_t i = 0; i < m_face.size(); i ++ ) mask[i] = ( m_face[i] >= 0 )? 255: 0;
+	if( !mask.empty() && fwrite( &mask[0], 1, mask.size(), fp ) != mask.size() ) success = false;
+	fclose( fp );
+
+	return success;
+};
+
+//write bmp previews, the normal is mapped by n/2+1/2, the other channels by their ranges over the covered pixels
+template<typename M, typename V, typename F>
+bool CGeometryImage<M,V,F>::_write_preview( const char * prefix )
+{
+	if( m_face.empty() ) return false;
+
+	bool success = true;
+	for( size_t c = 0; c < m_channels.size(); c ++ )
+	{
+		CGeometryImageChannel & ch = m_channels[c];
+		int d = ch.m_dim;
+		int n = ( d < 3 )? d: 3;
+
+		double lo[3] = { 0, 0, 0 }, scale[3] = { 1, 1, 1 };
+		if( c == 1 )
+		{
+			for( int j = 0; j < 3; j ++ ) { lo[j] = -1; scale[j] = 0.5; }
+		}
+		else
+		{
+			double hi[3] = { -1e+30, -1e+30, -1e+30 };
+			for( int j = 0; j < n; j ++ ) lo[j] = 1e+30;
+			for( size_t i = 0; i < m_face.size(); i ++ )
+			{
+				if( m_face[i] < 0 ) continue;
+				for( int j = 0; j < n; j ++ )
+				{
+					double x = ch.m_image[ i * d + j ];
+					if( x < lo[j] ) lo[j] = x;
+					if( x > hi[j] ) hi[j] = x;
+				}
+			}
+			for( int j = 0; j < n; j ++ )
+				scale[j] = ( hi[j] > lo[j] )? 1.0 / ( hi[j] - lo[j] ): 0;
+		}
+
+		RgbImage image( m_size, m_size );
+		for( int row = 0; row < m_size; row ++ )
+		for( int col = 0; col < m_size; col ++ )
+		{
+			int pix = row * m_size + col;
+			if( m_face[pix] < 0 )
+			{
+				image.SetRgbPixelf( row, col, 0, 0, 0 );
+				continue;
+			}
+			double rgb[3] = { 0, 0, 0 };
+			for( int j = 0; j < n; j ++ ) rgb[j] = ( ch.m_image[ pix * d + j ] - lo[j] ) * scale[j];
+			if( n == 1 ) rgb[1] = rgb[2] = rgb[0];
+			image.SetRgbPixelf( row, col, rgb[0], rgb[1], rgb[2] );
+		}
+
+		std::string name = std::string( prefix ) + "_" + ch.m_name + ".bmp";
+		if( !image.WriteBmpFile( name.c_str() ) ) success = false;
+	}
+	return success;
+};
+
+}
+#endif  //_GEOMETRY_IMAGE_H_
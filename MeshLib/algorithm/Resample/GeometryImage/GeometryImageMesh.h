@@ -0,0 +1,67 @@
+/*!
+*      \file GeometryImageMesh.h
+*      \brief Mesh for resampling a parameterized surface to a geometry image
+*
+*/
+/*******************************************************************************
+*      Geometry Image Mesh
+*
+*    Purpose:
+*
+*       Mesh with vertex uv, normal and rgb, read from the vertex strings
+*
+*******************************************************************************/
+
+#ifndef  _GEOMETRY_IMAGE_MESH_H_
+#define  _GEOMETRY_IMAGE_MESH_H_
+
+#include "Mesh/Vertex.h"
+#include "Mesh/Edge.h"
+#include "Mesh/Face.h"
+#include "Mesh/HalfEdge.h"
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/iterators.h"
+
+namespace MeshLib
+{
+/*! \brief CGeometryImageVertex class
+*
+*	Vertex class for resampling to a geometry image
+*   traits: vertex color m_rgb, uv and normal are inherited from CVertex
+*/
+class CGeometryImageVertex : public  CVertex
+{
+public:
+	/*! CGeometryImageVertex constructor */
+	CGeometryImageVertex() { m_rgb = CPoint(1,1,1); };
+	/*! vertex color */
+	CPoint & rgb() { return m_rgb; };
+protected:
+	/*! vertex color */
+	CPoint m_rgb;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------------------------
+
+	Geometry Image Mesh
+
+----------------------------------------------------------------------------------------------------------------------------------------*/
+/*!	\brief CGeometryImageMesh class
+*
+*	Mesh class for resampling to a geometry image
+*/
+template<typename V, typename E, typename F, typename H>
+class CGeometryImageMesh : public CBaseMesh<V,E,F,H>
+{
+public:
+	typedef MeshLib::MeshFaceIterator<V,E,F,H>   MeshFaceIterator;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H>   MeshEdgeIterator;
+	typedef MeshLib::FaceVertexIterator<V,E,F,H> FaceVertexIterator;
+};
+
+typedef CGeometryImageMesh<CGeometryImageVertex, CEdge, CFace, CHalfEdge> CGIMesh;
+
+};
+#endif  //_GEOMETRY_IMAGE_MESH_H_
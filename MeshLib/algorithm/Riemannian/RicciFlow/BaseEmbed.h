@@ -0,0 +1,313 @@
+/*! \file BaseEmbed.h
+ *  \brief Isometrically embed a mesh with canonical metric onto the canonical domain
+ *  \author David Gu
+ *  \date  documented on 10/17/2010
+ *
+ *  Isometrically embed a mesh with canonical metric onto the canonical domain
+ */
+#ifndef  _BASE_EMBED_H_
+#define  _BASE_EMBED_H_
+
+#include <vector>
+#include <queue>
+
+#include "RicciFlowMesh.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MeshLib
+{
+/*! \brief CBaseEmbed class
+ *
+ *   embed a mesh with canonical metric onto the canonical domain
+ *
+ *   The faces are embedded along a breadth first spanning tree of the dual graph, rooted at
+ *   the center of the dual graph, such that the depth of the tree, and the accumulated error
+ *   along the tree, is minimized. The dual graph is stored as an adjacency array. The order of
+ *   the embedding is planned first, then the faces are embedded level by level, the faces on the
+ *   same level are independent, they can be embedded in parallel.
+ */
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+  class CBaseEmbed
+  {
+  public: 
+   /*! \brief CEmbed constructor */
+    CBaseEmbed( CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge> * pMesh );
+   /*! \brief CEmbed destructor */
+    ~CBaseEmbed(){};
+	/*! _embed the mesh */
+    void _embed();
+	/*! whether the faces on the same level are embedded in parallel, false by default */
+	bool & parallel() { return m_parallel; };
+
+  protected:
+   
+	/*! embed the first face 
+	 * \param head the first face
+	 */
+	virtual void _embed_first_face( CFace * head ) = 0;
+	/*! embed one face, vertex A, vertex B are known, vertex C is unknown
+	 *  \param A, B, C the vertices of the face in ccw order starting from C
+	 */
+	virtual void _embed_face( CVertex * A, CVertex * B, CVertex * C ) = 0;
+
+	/*! initialization */
+	void _initialize();
+	/*! build the adjacency array of the dual graph */
+	void _dual_graph();
+	/*! breadth first search on the dual graph
+	 * \param root the index of the root face
+	 * \param father the father of each face in the spanning tree, -1 for the root and unreached faces
+	 * \return the index of the last reached face, which is the farthest one from the root
+	 */
+	int  _bfs( int root, std::vector<int> & father );
+	/*! center of the dual graph, the middle face of the longest path found by two searches */
+	int  _center();
+
+  protected:
+
+	/*! the mesh to be embedded */
+    CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge> * m_pMesh;
+
+	/*! faces, indexed by face idx() */
+	std::vector<CFace*> m_faces;
+	/*! dual graph, the 3 neighboring face indices of each face, -1 for boundary edges */
+	std::vector<int>    m_adjacency;
+	/*! face indices in the breadth first order */
+	std::vector<int>    m_order;
+	/*! starting position of each level in m_order, the last one is the end of m_order */
+	std::vector<int>    m_levels;
+	/*! vertices A, B, C of each face in m_order, C is NULL if the face embeds no new vertex */
+	std::vector<CVertex*> m_plan;
+	/*! embed the faces on the same level in parallel */
+	bool                m_parallel;
+  };
+
+
+//constructor
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::CBaseEmbed( CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge> * pMesh )
+{
+    m_pMesh = pMesh;
+	m_parallel = false;
+};
+
+//build the dual graph, the neighbors of each face are ordered ccwly
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+void CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::_dual_graph()
+{
+	m_faces.clear();
+
+	for( typename CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge>::MeshFaceIterator fiter( m_pMesh ); !fiter.end(); fiter ++ )
+	{
+		CFace * f = *fiter;
+		f->idx() = (int) m_faces.size();
+		m_faces.push_back( f );
+	}
+
+	m_adjacency.assign( 3 * m_faces.size(), -1 );
+
+	for( size_t i = 0; i < m_faces.size(); i ++ )
+	{
+		CHalfEdge * he = m_pMesh->faceMostCcwHalfEdge( m_faces[i] );
+		for( int j = 0; j < 3; j ++ )
+		{
+			CHalfEdge * sh = m_pMesh->halfedgeSym( he );
+			if( sh != NULL )
+			{
+				m_adjacency[3*i+j] = m_pMesh->halfedgeFace( sh )->idx();
+			}
+			he = m_pMesh->faceNextCcwHalfEdge( he );
+		}
+	}
+};
+
+//breadth first search from the root face, m_order and m_levels are filled
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+int CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::_bfs( int root, std::vector<int> & father )
+{
+	father.assign( m_faces.size(), -1 );
+	std::vector<bool> touched( m_faces.size(), false );
+
+	m_order.clear();
+	m_levels.clear();
+
+	m_order.push_back( root );
+	touched[root] = true;
+
+	size_t head = 0;
+	while( head < m_order.size() )
+	{
+		//all the faces on the current level are in [head, end)
+		size_t end = m_order.size();
+		m_levels.push_back( (int) head );
+
+		for( ; head < end; head ++ )
+		{
+			int f = m_order[head];
+			for( int j = 0; j < 3; j ++ )
+			{
+				int g = m_adjacency[3*f+j];
+				if( g < 0 || touched[g] ) continue;
+				touched[g] = true;
+				father[g] = f;
+				m_order.push_back( g );
+			}
+		}
+	}
+	m_levels.push_back( (int) m_order.size() );
+
+	return m_order.back();
+};
+
+//the center of the dual graph, the middle of the path between the two farthest faces, 
+//the spanning tree rooted at the center has the minimal depth
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+int CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::_center()
+{
+	std::vector<int> father;
+
+	int a = _bfs( 0, father );
+	int b = _bfs( a, father );
+
+	//the path from b to a has ( number of levels - 1 ) edges
+	int steps = ( (int) m_levels.size() - 2 ) / 2;
+	int c = b;
+	for( int i = 0; i < steps; i ++ )
+	{
+		c = father[c];
+	}
+	return c;
+};
+
+//build the dual graph and the spanning tree, plan the order of the embedding
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+void CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::_initialize()
+{
+	for( typename CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge>::MeshVertexIterator viter(  m_pMesh ); !viter.end(); viter ++)
+  {
+    CVertex * v = *viter;
+    v->huv() = CPoint2( 0, 0);
+    v->touched() = false;
+  }
+
+	_dual_graph();
+
+	std::vector<int> father;
+	_bfs( _center(), father );
+
+	CFace * root_face = m_faces[m_order.front()];
+
+	for( size_t i = 0; i < m_faces.size(); i ++ )
+	{
+		m_faces[i]->touched() = false;
+	}
+	for( size_t i = 0; i < m_order.size(); i ++ )
+	{
+		m_faces[m_order[i]]->touched() = true;
+	}
+
+	CHalfEdge * he = m_pMesh->faceMostCcwHalfEdge( root_face );
+	for( int j = 0; j < 3; j ++ )
+	{
+		m_pMesh->halfedgeTarget( he )->touched() = true;
+		he = m_pMesh->faceNextCcwHalfEdge( he );
+	}
+
+	//plan the embedding in the breadth first order, each face embeds its first untouched vertex,
+	//the other two vertices are shared with its father, which is on the previous level
+	m_plan.assign( 3 * m_order.size(), NULL );
+
+	for( size_t i = 1; i < m_order.size(); i ++ )
+	{
+		std::vector<CVertex*> av;
+		for( typename CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge>::FaceVertexIterator fviter( m_faces[m_order[i]] ); !fviter.end(); fviter ++ )
+		{
+			CVertex * pV = *fviter;
+			av.push_back( pV );
+		}
+
+		for( int k = 0; k < 3; k ++ )
+		{
+			if( av[k]->touched() ) continue;
+			m_plan[3*i+0] = av[(k+1)%3];
+			m_plan[3*i+1] = av[(k+2)%3];
+			m_plan[3*i+2] = av[(k+0)%3];
+			av[k]->touched() = true;
+			break;
+		}
+	}
+
+	_embed_first_face( root_face );
+ };
+
+
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+void CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::_embed()
+{
+
+	_initialize();
+
+	//the vertices embedded on one level only depend on the vertices of the previous levels
+	for( size_t l = 1; l + 1 < m_levels.size(); l ++ )
+	{
+		int begin = m_levels[l];
+		int end   = m_levels[l+1];
+
+#pragma omp parallel for if( m_parallel ) schedule(static)
+		for( int i = begin; i < end; i ++ )
+		{
+			CVertex * C = m_plan[3*i+2];
+			if( C == NULL ) continue;
+			_embed_face( m_plan[3*i+0], m_plan[3*i+1], C );
+		}
+	}
+
+	//normalize the uv coordinates
+
+	double u_min, u_max, v_min, v_max;
+	u_min = v_min = 1e30;
+	u_max = v_max = -1e30;
+
+
+	for( typename CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter++ )
+	{
+		CVertex * pV = *viter;
+		CPoint2 uv = pV->huv();
+		double u_param = uv[0];
+		double v_param = uv[1];
+		if( u_min>u_param )
+			u_min = u_param;
+		if( u_max<u_param )
+			u_max = u_param;
+		if( v_min>v_param )
+			v_min = v_param;
+		if( v_max<v_param )
+			v_max = v_param;
+	}
+
+	double range = ( u_max-u_min )>( v_max-v_min ) ? u_max-u_min : v_max-v_min;
+
+	printf( "range = %lf\n", range );
+
+	if( range>1e-6 ) {
+		for( typename CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter++ )
+		{
+			CVertex * pV = *viter;
+			pV->u() -= log( range );
+			CPoint2 uv =  pV->huv();
+			double u_param = uv[0];
+			double v_param = uv[1];
+			uv[0] = (u_param - u_min)/range;
+			uv[1] = (v_param - v_min)/range;
+			pV->huv() = uv;
+		}
+	}
+};
+
+}
+
+
+#endif 
\ No newline at end of file
@@ -18,9 +18,10 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
+#include "Trace/Trace.h"
 #include "RicciFlowMesh.h"
 
 #ifndef PI
@@ -47,6 +48,12 @@ template<typename V, typename E, typename F, typename H>
 	/*!	Computing the metric
 	 */
 	virtual void _calculate_metric();
+	/*!	Number of Newton steps, each one solves the Hessian, of the last _calculate_metric
+	 */
+	int newton_steps() { return m_newton_steps; };
+	/*!	Number of gradient flow steps of the last _calculate_metric
+	 */
+	int flow_steps() { return m_flow_steps; };
 
 
   protected:
@@ -58,6 +65,11 @@ template<typename V, typename E, typename F, typename H>
 	 *	boundary of the input mesh
 	 */
 	CBoundary<V,E,F,H>		  m_boundary;
+	/*!
+	 *	number of Newton and gradient flow steps
+	 */
+	int						  m_newton_steps;
+	int						  m_flow_steps;
 
   protected:
 	  /*!
@@ -120,10 +132,10 @@ template<typename V, typename E, typename F, typename H>
 
 //Constructor
 template<typename V, typename E, typename F, typename H>
-CBaseRicciFlow<V,E,F,H>::CBaseRicciFlow( CRicciFlowMesh<V,E,F,H> * pMesh ): m_pMesh( pMesh), m_boundary( pMesh )
+CBaseRicciFlow<V,E,F,H>::CBaseRicciFlow( CRicciFlowMesh<V,E,F,H> * pMesh ): m_pMesh( pMesh), m_boundary( pMesh ), m_newton_steps( 0 ), m_flow_steps( 0 )
 {
   int idx = 0;
-  for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
+  for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
 	{
       V * v = *viter;
       v->u() = 0;
@@ -142,7 +154,7 @@ template<typename V, typename E, typename F, typename H>
 void CBaseRicciFlow<V,E,F,H>::_calculate_edge_length( )
 {
 
-	for( CRicciFlowMesh<V,E,F,H>::MeshEdgeIterator eiter(m_pMesh);  !eiter.end();  eiter++ )
+	for( typename CRicciFlowMesh<V,E,F,H>::MeshEdgeIterator eiter(m_pMesh);  !eiter.end();  eiter++ )
   {
       E * e = *eiter;
 
@@ -165,7 +177,7 @@ void CBaseRicciFlow<V,E,F,H>::_calculate_corner_angle( )
 	//CStructure<CRicciFlowMesh<V,E,F,H>, V,E,F,H> pS( m_pMesh );
 	//pS._metric_2_angle();
 	
-	for ( CRicciFlowMesh<V,E,F,H>::MeshFaceIterator fiter( m_pMesh); ! fiter.end(); fiter ++ )
+	for ( typename CRicciFlowMesh<V,E,F,H>::MeshFaceIterator fiter( m_pMesh); ! fiter.end(); fiter ++ )
   {
       F * f = *fiter;
 
@@ -198,11 +210,11 @@ template<typename V, typename E, typename F, typename H>
 void CBaseRicciFlow<V,E,F,H>::_calculate_vertex_curvature()
 {
 
-  for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
+  for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
   {
       V * v = *viter;
       double k  = (v->boundary() )? PI: PI * 2;
-	  for( CRicciFlowMesh<V,E,F,H>::VertexInHalfedgeIterator vh( m_pMesh, v ); !vh.end();  ++vh )
+	  for( typename CRicciFlowMesh<V,E,F,H>::VertexInHalfedgeIterator vh( m_pMesh, v ); !vh.end();  ++vh )
       {
           H * he = *vh;
           k -= he->angle();
@@ -221,7 +233,7 @@ double CBaseRicciFlow<V,E,F,H>::_calculate_curvature_error()
   double max_error = -1;
   V * vert = NULL;
 
-  for(CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh); !viter.end() ; viter ++ )
+  for(typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh); !viter.end() ; viter ++ )
    {
        V * v = *viter;
 	   double k = v->target_k() - v->k();      
@@ -232,7 +244,7 @@ double CBaseRicciFlow<V,E,F,H>::_calculate_curvature_error()
 		vert = v;
 	   }
    }
-   printf("Vertex id is %d\n", vert->id() );
+   if( vert != NULL ) TRACE_GAUGE( "CBaseRicciFlow::worst_vertex", vert->id() );
    return max_error; 
 };
 
@@ -243,6 +255,8 @@ void CBaseRicciFlow<V,E,F,H>::_calculate_metric()
 {
 
    _set_target_curvature();
+  m_newton_steps = 0;
+  m_flow_steps   = 0;
   //double error = 1e-6;
   double threshold = 5e-4;
   double step_length = 1.0;
@@ -255,7 +269,7 @@ void CBaseRicciFlow<V,E,F,H>::_calculate_metric()
 template<typename V, typename E, typename F, typename H>
 bool CBaseRicciFlow<V,E,F,H>::_flow( double error_threshold )
 {
-  int num = m_pMesh->numVertices();
+  TRACE_SCOPE( "CBaseRicciFlow::_flow" );
 
   for( int k = 0; k < 64000; k ++  )
 	  {
@@ -267,13 +281,14 @@ bool CBaseRicciFlow<V,E,F,H>::_flow( double error_threshold )
 		  _calculate_vertex_curvature();
 
 		  double error =  _calculate_curvature_error();
-		  printf("Current error is %f\r\n", error );
+		  TRACE_GAUGE( "CBaseRicciFlow::_flow error", error );
 
 		  if( error < error_threshold)  return true;
+		  m_flow_steps ++;
   	  
 
 	  //set b 
-		  for(CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
+		  for(typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
 		  {
 		    V * v = *viter;
 			double dif = v->target_k() - v->k();
@@ -288,6 +303,7 @@ bool CBaseRicciFlow<V,E,F,H>::_flow( double error_threshold )
 template<typename V, typename E, typename F, typename H>
 void CBaseRicciFlow<V,E,F,H>::_Newton( double threshold, double step_length )
 {
+	TRACE_SCOPE( "CBaseRicciFlow::_Newton" );
 	int num = m_pMesh->numVertices();
 
 	
@@ -301,9 +317,10 @@ void CBaseRicciFlow<V,E,F,H>::_Newton( double threshold, double step_length )
 		_calculate_edge_weight();
 
 		double error =  _calculate_curvature_error();
-		printf("Newton's Method: Current error is %f\r\n", error );
+		TRACE_GAUGE( "CBaseRicciFlow::_Newton error", error );
 
 		if( error < threshold) break;
+		m_newton_steps ++;
 	
 
 		Eigen::SparseMatrix<double>  M( num, num );
@@ -312,7 +329,7 @@ void CBaseRicciFlow<V,E,F,H>::_Newton( double threshold, double step_length )
 
 		Eigen::VectorXd b(num);
 
-		for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++  )
+		for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++  )
 		{
 		    V * v = *viter;
 			int idx = v->idx();
@@ -322,16 +339,21 @@ void CBaseRicciFlow<V,E,F,H>::_Newton( double threshold, double step_length )
 		//std::cout << M;
 		//Eigen::ConjugateGradient<Eigen::SparseMatrix<double>> solver;
 		Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
-		std::cerr << "Eigen Decomposition" << std::endl;
-		solver.compute(M);
-		std::cerr << "Eigen Decomposition Finished" << std::endl;
+		{
+			TRACE_SCOPE( "CBaseRicciFlow::_Newton compute" );
+			solver.compute(M);
+		}
 	
 		if( solver.info() != Eigen::Success )
 		{
 			std::cerr << "Waring: Eigen decomposition failed" << std::endl;
 		}
 
-		Eigen::VectorXd x = solver.solve(b);
+		Eigen::VectorXd x;
+		{
+			TRACE_SCOPE( "CBaseRicciFlow::_Newton solve" );
+			x = solver.solve(b);
+		}
 		if( solver.info() != Eigen::Success )
 		{
 			std::cerr << "Waring: Eigen decomposition failed" << std::endl;
@@ -340,7 +362,7 @@ void CBaseRicciFlow<V,E,F,H>::_Newton( double threshold, double step_length )
 
 		_normalization( x, num );
 
-		for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++  )
+		for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++  )
 		{
 		    V * v = *viter;
 			int idx = v->idx();
@@ -360,7 +382,7 @@ void CBaseRicciFlow<V,E,F,H>::_calculate_Hessain( Eigen::SparseMatrix<double> &
 	std::vector<Eigen::Triplet<double> > M_coefficients;
 
 	//set A
-	for( CRicciFlowMesh<V,E,F,H>::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); eiter ++  )
+	for( typename CRicciFlowMesh<V,E,F,H>::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); eiter ++  )
 	{
 	  E * e = *eiter;
 	  V * v1 = m_pMesh->edgeVertex1( e );
@@ -371,12 +393,12 @@ void CBaseRicciFlow<V,E,F,H>::_calculate_Hessain( Eigen::SparseMatrix<double> &
 
 	}
   
-	for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++  )
+	for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++  )
 	{
 	    V * v = *viter;
 		int idx = v->idx();
 		double w = 0;
-		for( CRicciFlowMesh<V,E,F,H>::VertexEdgeIterator veiter( v ); !veiter.end(); veiter ++ )
+		for( typename CRicciFlowMesh<V,E,F,H>::VertexEdgeIterator veiter( v ); !veiter.end(); veiter ++ )
 		{
 		  E * pE = *veiter;
 		  w += pE->weight();
@@ -388,4 +410,4 @@ void CBaseRicciFlow<V,E,F,H>::_calculate_Hessain( Eigen::SparseMatrix<double> &
 }
 
 }
-#endif  _BASE_RICCI_FLOW_H_
\ No newline at end of file
+#endif  //_BASE_RICCI_FLOW_H_
\ No newline at end of file
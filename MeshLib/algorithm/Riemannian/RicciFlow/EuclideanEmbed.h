@@ -31,21 +31,24 @@ class CEuclideanEmbed : public CBaseEmbed<CVertex, CEdge, CFace, CHalfEdge>
     ~CEuclideanEmbed(){};
 
   protected:
+	/*! members of the dependent base class */
+	using CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>::m_pMesh;
+
 	/*! embed the first face 
 	 * \param head the first face
 	 */
 	void _embed_first_face( CFace * head );
 	/*!
-	 *	embed one face
+	 *	embed one face, vertex A, vertex B are known, vertex C is unknown
 	 */
-	void _embed_face( CFace * head );
+	void _embed_face( CVertex * A, CVertex * B, CVertex * C );
 
   };
 
 
 //constructor
 template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
-CEuclideanEmbed<CVertex,CEdge,CFace,CHalfEdge>::CEuclideanEmbed( CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge> * pMesh ):CBaseEmbed( pMesh )
+CEuclideanEmbed<CVertex,CEdge,CFace,CHalfEdge>::CEuclideanEmbed( CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge> * pMesh ):CBaseEmbed<CVertex,CEdge,CFace,CHalfEdge>( pMesh )
 {
 };
 
@@ -97,31 +100,8 @@ void CEuclideanEmbed<CVertex,CEdge,CFace,CHalfEdge>::_embed_first_face( CFace *
 //vertex A, vertex B are known, vertex C is unknown
 
 template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
-void CEuclideanEmbed<CVertex,CEdge,CFace,CHalfEdge>::_embed_face( CFace * head )
+void CEuclideanEmbed<CVertex,CEdge,CFace,CHalfEdge>::_embed_face( CVertex * A, CVertex * B, CVertex * C )
 {
-  std::vector<CVertex*> av;
-
-  for( CRicciFlowMesh<CVertex,CEdge,CFace,CHalfEdge>::FaceVertexIterator fviter( head ); !fviter.end(); fviter ++ )
-  {
-	  CVertex * pV = *fviter;
-	  av.push_back( pV );
-  }
-
-  CVertex * A = NULL;
-  CVertex * B = NULL;
-  CVertex * C = NULL;
-
-  for( int i = 0; i < 3; i ++ )
-  {
-	  if( av[i]->touched() ) continue;
-	  C = av[(i+0)%3];
-	  A = av[(i+1)%3];
-	  B = av[(i+2)%3];
-	  break;
-  }
-	
-  if( C == NULL ) return;
-
 	//radius of the first circle
 	double r1 = m_pMesh->vertexEdge(A,C)->length();
 	//radius of the second circle
@@ -144,8 +124,6 @@ void CEuclideanEmbed<CVertex,CEdge,CFace,CHalfEdge>::_embed_face( CFace * head )
 			C->huv()  = i1;
 		else
 			C->huv()  = i2;
-
-		C->touched() = true;
 	}
 
 	
@@ -17,8 +17,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -297,18 +297,21 @@ protected:
 *	Face class for Ricci flow
 *   trait:
 *	whether the face has been touched
+*   face index
 */
 
 class CRicciFlowFace: public CFace
 {
 public:
-	CRicciFlowFace() { m_touched = false; };
+	CRicciFlowFace() { m_touched = false; m_index = 0; };
 	~CRicciFlowFace() {};
 	bool & touched() { return m_touched; };
 	CPoint & normal(){ return m_normal; };
+	int  & idx()     { return m_index; };
 protected:
 	bool m_touched;
 	CPoint m_normal;
+	int  m_index;
 };
 
 /*-------------------------------------------------------------------------------------------------------------------------------------
@@ -325,27 +328,27 @@ template<typename V, typename E, typename F, typename H>
 class CRicciFlowMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H> CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
-	typedef VertexFaceIterator<V,E,F,H> VertexFaceIterator;
-	typedef VertexInHalfedgeIterator<V,E,F,H> VertexInHalfedgeIterator;
-	typedef VertexOutHalfedgeIterator<V,E,F,H> VertexOutHalfedgeIterator;
-	typedef FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
-	typedef FaceEdgeIterator<V,E,F,H> FaceEdgeIterator;
-	typedef MeshFaceIterator<V,E,F,H> MeshFaceIterator;
-	typedef FaceVertexIterator<V,E,F,H> FaceVertexIterator;
-	typedef MeshHalfEdgeIterator<V,E,F,H> MeshHalfEdgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H> CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::VertexFaceIterator<V,E,F,H> VertexFaceIterator;
+	typedef MeshLib::VertexInHalfedgeIterator<V,E,F,H> VertexInHalfedgeIterator;
+	typedef MeshLib::VertexOutHalfedgeIterator<V,E,F,H> VertexOutHalfedgeIterator;
+	typedef MeshLib::FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
+	typedef MeshLib::FaceEdgeIterator<V,E,F,H> FaceEdgeIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H> MeshFaceIterator;
+	typedef MeshLib::FaceVertexIterator<V,E,F,H> FaceVertexIterator;
+	typedef MeshLib::MeshHalfEdgeIterator<V,E,F,H> MeshHalfEdgeIterator;
 public:
 };
 
 
 typedef CRicciFlowMesh<CRicciFlowVertex, CRicciFlowEdge, CRicciFlowFace, CRicciFlowHalfEdge> CRFMesh;	
 
-unsigned long long CRFMesh::m_input_traits = EDGE_SHARP| VERTEX_FATHER | VERTEX_RGB;
-unsigned long long CRFMesh::m_output_traits = VERTEX_UV;
+template<> inline unsigned long long CBaseMesh<CRicciFlowVertex, CRicciFlowEdge, CRicciFlowFace, CRicciFlowHalfEdge>::m_input_traits = EDGE_SHARP| VERTEX_FATHER | VERTEX_RGB;
+template<> inline unsigned long long CBaseMesh<CRicciFlowVertex, CRicciFlowEdge, CRicciFlowFace, CRicciFlowHalfEdge>::m_output_traits = VERTEX_UV;
 };
-#endif  _RICCI_FLOW_MESH_H_
\ No newline at end of file
+#endif  //_RICCI_FLOW_MESH_H_
\ No newline at end of file
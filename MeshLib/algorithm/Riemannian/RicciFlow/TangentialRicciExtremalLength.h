@@ -32,6 +32,8 @@ namespace MeshLib
 	  CTangentialRicciFlowExtremalLength( CRicciFlowMesh<V,E,F,H> * pMesh );
 
   protected:
+	/*! members of the dependent base class */
+	using CTangentialRicciFlow<V,E,F,H>::m_pMesh;
 
 	/*!
 	 *	Set the target curvature on each vertex
@@ -44,7 +46,7 @@ namespace MeshLib
   };
 
 template<typename V, typename E, typename F, typename H>
-CTangentialRicciFlowExtremalLength<V,E,F,H>::CTangentialRicciFlowExtremalLength( CRicciFlowMesh<V,E,F,H> * pMesh ): CTangentialRicciFlow( pMesh)
+CTangentialRicciFlowExtremalLength<V,E,F,H>::CTangentialRicciFlowExtremalLength( CRicciFlowMesh<V,E,F,H> * pMesh ): CTangentialRicciFlow<V,E,F,H>( pMesh)
 {
 	_calculate_topo_valence();
 }
@@ -52,11 +54,11 @@ CTangentialRicciFlowExtremalLength<V,E,F,H>::CTangentialRicciFlowExtremalLength(
 template<typename V, typename E, typename F, typename H>
 void CTangentialRicciFlowExtremalLength<V,E,F,H>::_calculate_topo_valence()
 {
-	for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
+	for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
     {
       V * v = *viter;
       v->valence() = 0;
-      for(CRicciFlowMesh<V,E,F,H>::VertexEdgeIterator veiter( v ); !veiter.end(); ++ veiter )
+      for(typename CRicciFlowMesh<V,E,F,H>::VertexEdgeIterator veiter( v ); !veiter.end(); ++ veiter )
       {
         E * e = *veiter;
         if( e->sharp() ) v->valence() ++;
@@ -71,7 +73,7 @@ template<typename V, typename E, typename F, typename H>
 void CTangentialRicciFlowExtremalLength<V,E,F,H>::_set_target_curvature()
 {
 	int count = 0;
-  for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
+  for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
   {
     V * v = *viter;
     v->target_k() = 0;
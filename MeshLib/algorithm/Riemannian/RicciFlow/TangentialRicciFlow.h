@@ -18,8 +18,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "RicciFlowMesh.h"
 #include "BaseRicciFlow.h"
@@ -54,6 +54,16 @@ class CTangentialRicciFlow : public CBaseRicciFlow<V,E,F,H>
      bool _flow( double );
 
   protected:
+	/*! members of the dependent base class */
+	using CBaseRicciFlow<V,E,F,H>::m_pMesh;
+	using CBaseRicciFlow<V,E,F,H>::m_boundary;
+	using CBaseRicciFlow<V,E,F,H>::m_newton_steps;
+	using CBaseRicciFlow<V,E,F,H>::m_flow_steps;
+	using CBaseRicciFlow<V,E,F,H>::_calculate_edge_length;
+	using CBaseRicciFlow<V,E,F,H>::_calculate_corner_angle;
+	using CBaseRicciFlow<V,E,F,H>::_calculate_vertex_curvature;
+	using CBaseRicciFlow<V,E,F,H>::_calculate_curvature_error;
+	using CBaseRicciFlow<V,E,F,H>::_Newton;
 
 	  /*!
 	   *	Calculate each edge length, has to be defined in the derivated classes
@@ -86,7 +96,7 @@ class CTangentialRicciFlow : public CBaseRicciFlow<V,E,F,H>
 
 
 template<typename V, typename E, typename F, typename H>
-CTangentialRicciFlow<V,E,F,H>::CTangentialRicciFlow( CRicciFlowMesh<V,E,F,H> * pMesh ):CBaseRicciFlow( pMesh)
+CTangentialRicciFlow<V,E,F,H>::CTangentialRicciFlow( CRicciFlowMesh<V,E,F,H> * pMesh ):CBaseRicciFlow<V,E,F,H>( pMesh)
 {
 };
 
@@ -113,19 +123,19 @@ double CTangentialRicciFlow<V,E,F,H>::_cosine_law( double a, double b, double c
 template<typename V, typename E, typename F, typename H>
 void CTangentialRicciFlow<V,E,F,H>::_calculate_edge_weight()
 {
-	for( CRicciFlowMesh<V,E,F,H>::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); eiter ++ )
+	for( typename CRicciFlowMesh<V,E,F,H>::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); eiter ++ )
   {
       E * e = *eiter;
       e->weight() = 0.0;
   }
 
-	for(  CRicciFlowMesh<V,E,F,H>::MeshFaceIterator fiter( m_pMesh ) ; !fiter.end(); fiter ++ )
+	for(  typename CRicciFlowMesh<V,E,F,H>::MeshFaceIterator fiter( m_pMesh ) ; !fiter.end(); fiter ++ )
   {
       F * f = *fiter;
 
       double r[3];
       int i = 0;
-	  for( CRicciFlowMesh<V,E,F,H>::FaceHalfedgeIterator hiter(  f ); !hiter.end(); ++hiter )
+	  for( typename CRicciFlowMesh<V,E,F,H>::FaceHalfedgeIterator hiter(  f ); !hiter.end(); ++hiter )
       {
          H * he = *hiter;
 		 V * v = m_pMesh->halfedgeTarget(he);
@@ -134,7 +144,7 @@ void CTangentialRicciFlow<V,E,F,H>::_calculate_edge_weight()
 
       double w = sqrt(r[0]*r[1]*r[2]/(r[0]+r[1]+r[2]));
       
-	  for( CRicciFlowMesh<V,E,F,H>::FaceEdgeIterator eiter(f); !eiter.end(); ++ eiter )
+	  for( typename CRicciFlowMesh<V,E,F,H>::FaceEdgeIterator eiter(f); !eiter.end(); ++ eiter )
       {
           E * e = * eiter;
           e->weight() += w/e->length();
@@ -147,25 +157,25 @@ void CTangentialRicciFlow<V,E,F,H>::_calculate_edge_weight()
 template<typename V, typename E, typename F, typename H>
 void CTangentialRicciFlow<V,E,F,H>::_set_target_curvature()
 {
-  for( CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
+  for( typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
   {
     V * v = *viter;
     v->target_k() = 0;
   }
 
-  std::vector<CRicciFlowMesh<V,E,F,H>::CLoop*>& pLs = m_boundary.loops();
+  std::vector<typename CRicciFlowMesh<V,E,F,H>::CLoop*>& pLs = m_boundary.loops();
 	
   int id = 0;
 
-  for( std::vector<CRicciFlowMesh<V,E,F,H>::CLoop*>::iterator liter = pLs.begin(); liter != pLs.end(); liter++)
+  for( typename std::vector<typename CRicciFlowMesh<V,E,F,H>::CLoop*>::iterator liter = pLs.begin(); liter != pLs.end(); liter++)
   {
-	  CRicciFlowMesh<V,E,F,H>::CLoop * pL = *liter;
+	  typename CRicciFlowMesh<V,E,F,H>::CLoop * pL = *liter;
 	  std::list<H*> & pHes = pL->halfedges();
 
 	  double sum = 0;
 	  double inv_sum = 0;
 	
-	  for( std::list<H*>::iterator hiter = pHes.begin(); hiter != pHes.end(); hiter ++ )
+	  for( typename std::list<H*>::iterator hiter = pHes.begin(); hiter != pHes.end(); hiter ++ )
 	  {
 			H  * he = *hiter;
 			E  * pe = m_pMesh->halfedgeEdge( he );
@@ -174,7 +184,7 @@ void CTangentialRicciFlow<V,E,F,H>::_set_target_curvature()
 			inv_sum += 1/pe->length();
  	  }
 
-	  for( std::list<H*>::iterator hiter = pHes.begin(); hiter != pHes.end(); hiter ++ )
+	  for( typename std::list<H*>::iterator hiter = pHes.begin(); hiter != pHes.end(); hiter ++ )
 	  {
 			H * ce = *hiter;
 			V   * pv = m_pMesh->halfedgeTarget( ce );
@@ -209,6 +219,8 @@ void CTangentialRicciFlow<V,E,F,H>::_calculate_metric()
   //double error = 1e-6;
   double error = 5e-4;
 
+  m_newton_steps = 0;
+  m_flow_steps   = 0;
   _calculate_edge_length();
 
   while( true )
@@ -227,7 +239,7 @@ void CTangentialRicciFlow<V,E,F,H>::_calculate_metric()
 template<typename V, typename E, typename F, typename H>
 bool CTangentialRicciFlow<V,E,F,H>::_flow( double error_threshold )
 {
-  int num = m_pMesh->numVertices();
+  TRACE_SCOPE( "CTangentialRicciFlow::_flow" );
 
   for( int k = 0; k < 64; k ++  )
 	  {
@@ -239,13 +251,14 @@ bool CTangentialRicciFlow<V,E,F,H>::_flow( double error_threshold )
 		  _calculate_vertex_curvature();
 
 		  double error =  _calculate_curvature_error();
-		  printf("Current error is %f\r\n", error );
+		  TRACE_GAUGE( "CTangentialRicciFlow::_flow error", error );
 
 		  if( error < error_threshold)  return true;
+		  m_flow_steps ++;
   	  
 
 	  //set b 
-		  for(CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
+		  for(typename CRicciFlowMesh<V,E,F,H>::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
 		  {
 		    V * v = *viter;
 			double dif = v->target_k() - v->k();
@@ -276,4 +289,4 @@ void CTangentialRicciFlow<V,E,F,H>::_normalization( Eigen::VectorXd & x, int num
 
 }
 
-#endif  _TANGENTIAL_RICCI_FLOW_H_
\ No newline at end of file
+#endif  //_TANGENTIAL_RICCI_FLOW_H_
\ No newline at end of file
@@ -62,6 +62,7 @@ int main( int argc, char * argv[] )
 #include "Mesh/boundary.h"
 #include "Mesh/iterators.h"
 #include "ShortestPathMesh.h"
+#include "Topology/DistanceField/DistanceField.h"
 
 namespace MeshLib
 {
@@ -96,6 +97,9 @@ namespace MeshLib
 	/*!	Boundary loops of the input mesh
 	 */
 	CSPMesh::CBoundary m_boundary;
+	/*!	Hop distance field, the vertex adjacency is built once for all the loops
+	 */
+	CDistanceField<CSPMesh,CSPVertex> m_field;
 	/*! Edges on the shortest path 
 	 */
 	std::list<CSPEdge*> m_cuts;
@@ -17,8 +17,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/traits_io.h"
 
 namespace MeshLib
@@ -101,19 +101,19 @@ template<typename V, typename E, typename F, typename H>
 class CShortestPathMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H> CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H> CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
 public:
 };
 
 
 typedef CShortestPathMesh<CSPVertex, CSPEdge, CFace, CHalfEdge> CSPMesh;
 
-unsigned long long CSPMesh::m_input_traits  = 0;
-unsigned long long CSPMesh::m_output_traits = EDGE_SHARP;
+template<> inline unsigned long long CBaseMesh<CSPVertex, CSPEdge, CFace, CHalfEdge>::m_input_traits  = 0;
+template<> inline unsigned long long CBaseMesh<CSPVertex, CSPEdge, CFace, CHalfEdge>::m_output_traits = EDGE_SHARP;
 };
-#endif  _SHORTEST_PATH_MESH_H_
\ No newline at end of file
+#endif  //_SHORTEST_PATH_MESH_H_
\ No newline at end of file
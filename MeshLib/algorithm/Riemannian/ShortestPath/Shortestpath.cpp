@@ -16,7 +16,7 @@ using namespace MeshLib;
  *  \param pMesh the input mesh
  */
 
-CShortestPath::CShortestPath( CSPMesh * pMesh ): m_pMesh( pMesh ), m_boundary( m_pMesh )
+CShortestPath::CShortestPath( CSPMesh * pMesh ): m_pMesh( pMesh ), m_boundary( m_pMesh ), m_field( m_pMesh )
 {
 }
 
@@ -105,13 +105,6 @@ void CShortestPath::_cut( const char *  prefix)
 
 void CShortestPath::_trace(CSPMesh::CLoop * source , CSPMesh::CLoop * target )
 {
-	//set all vertex touched to be false
-	for( CSPMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
-    {
-      CSPVertex * v = *viter;
-      v->touched() = false;
-    }
-
 	//set all edge strings to be empty, no edge is sharp
 	for( CSPMesh::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); ++ eiter )
     {
@@ -120,52 +113,40 @@ void CShortestPath::_trace(CSPMesh::CLoop * source , CSPMesh::CLoop * target )
       e->string() = "";
     }
 
-    std::queue<CSPVertex*> vqueue;
-	//enqueue all the target boundary loop vertices	
+	//boundary vertices are reached but not expanded, except the ones on the target loop,
+	//the search ends at the first vertex on the source loop
+	for( CSPMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
+    {
+      CSPVertex * v = *viter;
+      m_field.sink( v ) = v->boundary();
+      m_field.target( v ) = ( v->idx() == 0 );
+    }
+
+    std::vector<CSPVertex*> sources;
+	//all the target boundary loop vertices are the sources
     for( std::list<CHalfEdge * > :: iterator hiter = target->halfedges().begin() ; hiter != target->halfedges().end(); hiter++ )
     {
         CHalfEdge * he = *hiter;
         CSPVertex     * pv = m_pMesh->halfedgeVertex( he );
-        pv->touched( ) = true;
-        vqueue.push( pv );
+        m_field.sink( pv ) = false;
+        sources.push_back( pv );
     }
-    
-    CSPVertex * destiny = NULL;
+
 	//breadth first search to reach the source loop
-	//each vertex has a paraent field indicating the parent vertex
-	//in the breadth first searching tree
-    while( ! vqueue.empty() )
-    {
-		CSPVertex * head = vqueue.front();
-        vqueue.pop();
-        
-		for( CSPMesh::VertexVertexIterator vviter( head ); !vviter.end(); ++ vviter )
-        {
-            CSPVertex * w = *vviter;
-            if( w->idx() == 0 )
-            {
-                destiny = w;
-                w->parent() = head;
-                break;
-            }
-           if( w->boundary() ) continue;
-            if( w->touched() ) continue;
-             w->touched( ) = true;
-            vqueue.push( w );
-            w->parent() = head;
-        }
-
-        if( destiny != NULL ) break;
-    }
+	//each vertex has a parent in the breadth first searching tree
+	m_field._hop( sources );
+
+	//the first reached vertex on the source loop
+    CSPVertex * destiny = m_field.reached();
 	
 	//trace back from the source to the target
 	//label sharp edges
     assert( destiny != NULL );
     CSPVertex * pv = destiny;
  
-    while( pv->parent( ) != NULL )
+    while( m_field.parent( pv ) != NULL )
     {
-      CSPVertex * pw = pv->parent( );
+      CSPVertex * pw = m_field.parent( pv );
       CSPEdge * e  = m_pMesh->vertexEdge( pv, pw );
       e->sharp() = true;
 	  e->string() = "sharp";
@@ -11,6 +11,7 @@
 
 #include <map>
 #include <vector>
+#include <algorithm>
 #include <complex>
 
 #include "Mesh/BaseMesh.h"
@@ -18,8 +19,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 
 #ifndef PI
@@ -156,7 +157,7 @@ template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_metric_2_angle( )
 {
   
-	for ( M::MeshFaceIterator fiter( m_pMesh); ! fiter.end(); fiter ++ )
+	for ( typename M::MeshFaceIterator fiter( m_pMesh); ! fiter.end(); fiter ++ )
   {
       F * f = *fiter;
 
@@ -187,7 +188,7 @@ template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_embedding_2_metric( )
 {
   
-	for ( M::MeshEdgeIterator eiter( m_pMesh); ! eiter.end(); eiter ++ )
+	for ( typename M::MeshEdgeIterator eiter( m_pMesh); ! eiter.end(); eiter ++ )
 	{
       E * e = *eiter;
 	  V * v1 = m_pMesh->edgeVertex1( e );
@@ -203,11 +204,11 @@ template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_angle_2_curvature( )
 {
 
-  for( M::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
+  for( typename M::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
   {
       V * v = *viter;
       double k  = (v->boundary() )? PI: PI * 2;
-	  for( M::VertexInHalfedgeIterator vh( m_pMesh, v ); !vh.end();  ++vh )
+	  for( typename M::VertexInHalfedgeIterator vh( m_pMesh, v ); !vh.end();  ++vh )
       {
           H * he = *vh;
           k -= he->angle();
@@ -223,7 +224,7 @@ template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_angle_2_Laplace( )
 {
 
-	for( M::MeshEdgeIterator eiter( m_pMesh ); !eiter.end();  eiter ++ )
+	for( typename M::MeshEdgeIterator eiter( m_pMesh ); !eiter.end();  eiter ++ )
   {
       E * e = *eiter;
 	  
@@ -246,7 +247,7 @@ void CStructure<M, V,E,F,H>::_angle_2_Laplace( )
 template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_parameter_mu_2_metric( )
 {
-	for ( M::MeshEdgeIterator eiter( m_pMesh); ! eiter.end(); eiter ++ )
+	for ( typename M::MeshEdgeIterator eiter( m_pMesh); ! eiter.end(); eiter ++ )
 	{
       E * e = *eiter;
 	  V * v1 = m_pMesh->edgeVertex1( e );
@@ -264,7 +265,7 @@ void CStructure<M, V,E,F,H>::_parameter_mu_2_metric( )
 	  e->length() = std::abs( dz + mu * std::conj( dz ));
 	}
 
-	for ( M::MeshFaceIterator fiter( m_pMesh); ! fiter.end(); fiter ++ )
+	for ( typename M::MeshFaceIterator fiter( m_pMesh); ! fiter.end(); fiter ++ )
 	{
       F * f = *fiter;
 
@@ -489,7 +490,7 @@ std::complex<double> CStructure<M, V,E,F,H>::_diagonal_ratio( M* pM, E * pE )
 template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_metric_2_diagonal_ratio()
 {
-	for( M::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); eiter ++ )
+	for( typename M::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); eiter ++ )
 	{
 		E * pE = *eiter;			
 		std::complex<double> rho = _diagonal_ratio( m_pMesh, pE );		
@@ -502,13 +503,13 @@ void CStructure<M, V,E,F,H>::_metric_2_diagonal_ratio()
 template<typename M, typename V, typename E, typename F, typename H>
 void CStructure<M, V,E,F,H>::_parameter_mu_2_angle( )
 {
-	for( M::MeshFaceIterator fiter( m_pMesh ); ! fiter.end(); fiter ++ )
+	for( typename M::MeshFaceIterator fiter( m_pMesh ); ! fiter.end(); fiter ++ )
 	{
 		F * f = * fiter;
 
 		H * hs[3];
 		int i = 0;
-		for( M::FaceHalfedgeIterator fhiter( f ); !fhiter.end(); fhiter ++ )
+		for( typename M::FaceHalfedgeIterator fhiter( f ); !fhiter.end(); fhiter ++ )
 		{
 			H * h = *fhiter;
 			hs[i++] = h;
@@ -538,4 +539,4 @@ void CStructure<M, V,E,F,H>::_parameter_mu_2_angle( )
 };
 
 
-#endif  _STRUCTURE_H_
\ No newline at end of file
+#endif  //_STRUCTURE_H_
\ No newline at end of file
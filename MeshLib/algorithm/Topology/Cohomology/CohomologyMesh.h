@@ -17,8 +17,8 @@
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -176,21 +176,21 @@ template<typename V, typename E, typename F, typename H>
 class CCohomologyMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H>  CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshFaceIterator<V,E,F,H> MeshFaceIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
-	typedef VertexOutHalfedgeIterator<V,E,F,H> VertexOutHalfedgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H>  CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H> MeshFaceIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::VertexOutHalfedgeIterator<V,E,F,H> VertexOutHalfedgeIterator;
 public:
 };
 
 
 typedef CCohomologyMesh<CCHVertex, CCHEdge, CFace, CHalfEdge> CCHMesh;
 
-unsigned long long CCHMesh::m_input_traits  = VERTEX_FATHER;
-unsigned long long CCHMesh::m_output_traits = VERTEX_UV | EDGE_DU;
+template<> inline unsigned long long CBaseMesh<CCHVertex, CCHEdge, CFace, CHalfEdge>::m_input_traits  = VERTEX_FATHER;
+template<> inline unsigned long long CBaseMesh<CCHVertex, CCHEdge, CFace, CHalfEdge>::m_output_traits = VERTEX_UV | EDGE_DU;
 };
-#endif  _COHOMOLOGY_MESH_H_
\ No newline at end of file
+#endif  //_COHOMOLOGY_MESH_H_
\ No newline at end of file
@@ -9,6 +9,7 @@
 */
 #include <queue>
 #include "DomainCohomology.h"
+#include "Trace/Trace.h"
 
 using namespace MeshLib;
 
@@ -258,14 +259,6 @@ void CDomainCohomology::_locate_four_corners(  std::vector<CCHVertex*> & corners
 
   std::vector<CCHVertex*> buffer;
 
-  for( int i = 0; i < 4; i ++ )
-  {
-	  int fid = corners[i]->father();
-	  CCHVertex * w = m_pMesh->idVertex( fid );
-
-	  printf("vertex id %d, father id %d, father loop id %d\n", corners[i]->id(), corners[i]->father(),  w->idx() );
-  }
-
   int min_loop_id = 10000;
 
   for( int i = 0; i < 4; i ++ )
@@ -305,7 +298,9 @@ void CDomainCohomology::_locate_four_corners(  std::vector<CCHVertex*> & corners
 	  int fid = corners[i]->father();
 	  CCHVertex * w = m_pMesh->idVertex( fid );
 
-	  printf("vertex id %d, father id %d, father loop id %d\n", corners[i]->id(), corners[i]->father(),  w->idx() );
+	  TRACE_GAUGE( "CDomainCohomology::_locate_four_corners corner id", corners[i]->id() );
+	  TRACE_GAUGE( "CDomainCohomology::_locate_four_corners father id", corners[i]->father() );
+	  TRACE_GAUGE( "CDomainCohomology::_locate_four_corners father loop id", w->idx() );
   }
 
 };
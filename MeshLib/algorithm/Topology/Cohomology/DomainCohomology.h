@@ -59,4 +59,4 @@ namespace MeshLib
 	
   };
 }
-#endif _DOMAIN_COHOMOLOGY_H_
\ No newline at end of file
+#endif //_DOMAIN_COHOMOLOGY_H_
\ No newline at end of file
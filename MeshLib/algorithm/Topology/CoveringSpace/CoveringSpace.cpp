@@ -0,0 +1,122 @@
+#include "CoveringSpace.h"
+
+using namespace MeshLib;
+
+//CCoveringSpace constructor, the disk coordinates are the uv if there are any, otherwise the x,y coordinates
+CCoveringSpace::CCoveringSpace( CCSMesh * pMesh )
+{
+	m_pMesh = pMesh;
+
+	bool with_uv = false;
+	for( CCSMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
+	{
+		CCoveringSpaceVertex * v = *viter;
+		if( v->uv()[0] != 0 || v->uv()[1] != 0 ) with_uv = true;
+	}
+
+	CComplexArray uv( m_pMesh->numVertices() );
+	int i = 0;
+	for( CCSMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter, ++ i )
+	{
+		CCoveringSpaceVertex * v = *viter;
+		Complex z = with_uv? Complex( v->uv()[0], v->uv()[1] ): Complex( v->point()[0], v->point()[1] );
+		m_z[v] = z;
+		uv.set( i, z );
+	}
+	m_tiling._bound( uv );
+}
+
+//CCoveringSpace destructor
+CCoveringSpace::~CCoveringSpace()
+{
+}
+
+//move p to the origin and a to the origin, rotate the direction of q onto the direction of b, and move back to a
+CMobius CCoveringSpace::_isometry( Complex p, Complex q, Complex a, Complex b )
+{
+	CMobius mp( p, 0 );
+	CMobius ma( a, 0 );
+
+	double phi = std::arg( ma * b ) - std::arg( mp * q );
+
+	CMobius rp( p, phi );
+	CMobius ia = inverse( ma );
+	return ia * rp;
+}
+
+//pair the boundary edges with the same fathers in the reverse order, each pair gives a deck transformation;
+//the transformations of one boundary segment are averaged, which reduces the discretization error
+void CCoveringSpace::_deck_transformations()
+{
+	std::vector<CMobius> clusters;
+	std::vector<Complex> z0;
+	std::vector<Complex> theta;
+	std::vector<int>     count;
+
+	std::map< std::pair<int,int>, std::vector<CHalfEdge*> > boundary;
+
+	for( CCSMesh::MeshEdgeIterator eiter( m_pMesh ); !eiter.end(); ++ eiter )
+	{
+		CEdge * e = *eiter;
+		if( !m_pMesh->isBoundary( e ) ) continue;
+
+		CHalfEdge * he = m_pMesh->edgeHalfedge( e, 0 );
+		CCoveringSpaceVertex * s = m_pMesh->halfedgeSource( he );
+		CCoveringSpaceVertex * t = m_pMesh->halfedgeTarget( he );
+		boundary[ std::make_pair( s->father(), t->father() ) ].push_back( he );
+	}
+
+	for( std::map< std::pair<int,int>, std::vector<CHalfEdge*> >::iterator iter = boundary.begin(); iter != boundary.end(); ++ iter )
+	{
+		std::pair<int,int> key = iter->first;
+		std::map< std::pair<int,int>, std::vector<CHalfEdge*> >::iterator twin = boundary.find( std::make_pair( key.second, key.first ) );
+		if( twin == boundary.end() ) continue;
+
+		std::vector<CHalfEdge*> & hs = iter->second;
+		std::vector<CHalfEdge*> & ts = twin->second;
+		for( size_t i = 0; i < hs.size(); i ++ )
+		for( size_t j = 0; j < ts.size(); j ++ )
+		{
+			CCoveringSpaceVertex * a = m_pMesh->halfedgeSource( hs[i] );
+			CCoveringSpaceVertex * b = m_pMesh->halfedgeTarget( hs[i] );
+			CCoveringSpaceVertex * p = m_pMesh->halfedgeTarget( ts[j] );
+			CCoveringSpaceVertex * q = m_pMesh->halfedgeSource( ts[j] );
+			if( a == p || b == q ) continue;
+
+			CMobius mob = _isometry( m_z[p], m_z[q], m_z[a], m_z[b] );
+
+			size_t k = 0;
+			while( k < clusters.size() && !m_tiling._same( clusters[k], mob ) ) k ++;
+			if( k == clusters.size() )
+			{
+				clusters.push_back( mob );
+				z0.push_back( Complex( 0, 0 ) );
+				theta.push_back( Complex( 0, 0 ) );
+				count.push_back( 0 );
+			}
+			z0[k]    += mob.z();
+			theta[k] += mob.theta();
+			count[k] ++;
+		}
+	}
+
+	for( size_t k = 0; k < clusters.size(); k ++ )
+	{
+		CMobius mob( z0[k] / (double) count[k], std::arg( theta[k] ) );
+		m_tiling.add_generator( mob );
+	}
+}
+
+//stream the generators and the tiles to the output file
+int CCoveringSpace::_tiling( int depth, double scale, double min_pixels, const char * output )
+{
+	FILE * fp = fopen( output, "w" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Error: can not open %s\n", output );
+		return 0;
+	}
+	int num = m_tiling._enumerate( depth, scale, min_pixels, fp );
+	fclose( fp );
+	return num;
+}
@@ -0,0 +1,89 @@
+/*!
+*      \file CoveringSpace.h
+*      \brief Tiling the universal covering space of a high genus surface by its fundamental domain
+*
+*/
+
+/*******************************************************************************
+*      Covering Space
+*
+*    Purpose:
+*
+*       Compute the deck transformations from the boundary of a fundamental domain on the Poincare disk,
+*       and tile the disk by the images of the domain
+*
+*	Input
+*       The fundamental domain, each vertex has its father in the closed mesh; the disk coordinates are
+*       the uv, or the x,y coordinates of the points if the vertices have no uv
+*	Output
+*       The deck transformations and the tiles, each as a Mobius transformation of the domain
+*
+*******************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------------------
+
+#include "CoveringSpace/CoveringSpace.h"
+
+using namespace MeshLib;
+
+	CCSMesh mesh;
+	mesh.read_m( "genus2.pos.m" );
+	_read_vertex_father<CCSMesh, CCoveringSpaceVertex, CEdge, CFace, CHalfEdge>( &mesh );
+
+	CCoveringSpace cover( & mesh );
+	cover._deck_transformations();
+	cover._tiling( 8, 512, 2, "genus2.tiles" );
+
+--------------------------------------------------------------------------------------------------------------------------------*/
+#ifndef _COVERING_SPACE_H_
+#define _COVERING_SPACE_H_
+
+#include <map>
+#include <vector>
+
+#include "CoveringSpaceMesh.h"
+#include "Mobius/MobiusTiling.h"
+
+namespace MeshLib
+{
+/*! \brief CCoveringSpace class
+*
+*	A boundary edge of the fundamental domain and its twin, the boundary edge with the same
+*   father vertices in the reverse order, are related by a deck transformation. The
+*   transformations of all the twin pairs are clustered, one generator per boundary segment.
+*/
+  class CCoveringSpace
+  {
+  public:
+	  /*! CCoveringSpace constructor
+	  * \param pMesh the fundamental domain
+	  */
+	  CCoveringSpace( CCSMesh * pMesh );
+	  /*! CCoveringSpace destructor */
+	  ~CCoveringSpace();
+	  /*! compute the deck transformations */
+	  void _deck_transformations();
+	  /*! tile the disk
+	  * \param depth maximal word length
+	  * \param scale pixels per unit length of the disk
+	  * \param min_pixels smallest tile diameter in pixels
+	  * \param output output file of the generators and the tiles
+	  * \return number of tiles
+	  */
+	  int  _tiling( int depth, double scale, double min_pixels, const char * output );
+	  /*! the tiling */
+	  CMobiusTiling & tiling() { return m_tiling; };
+
+  protected:
+	  /*! the fundamental domain */
+	  CCSMesh * m_pMesh;
+	  /*! disk coordinates of the vertices */
+	  std::map<CCoveringSpaceVertex*, Complex> m_z;
+	  /*! the tiling */
+	  CMobiusTiling m_tiling;
+
+	  /*! the disk isometry which maps p to a, and the direction from p to q to the direction from a to b */
+	  CMobius _isometry( Complex p, Complex q, Complex a, Complex b );
+  };
+}
+#endif
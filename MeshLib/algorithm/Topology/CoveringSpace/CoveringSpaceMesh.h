@@ -0,0 +1,66 @@
+/*!
+*      \file CoveringSpaceMesh.h
+*      \brief Mesh for tiling the universal covering space by a fundamental domain
+*
+*/
+/*******************************************************************************
+*      Covering Space Mesh
+*
+*    Purpose:
+*
+*       Fundamental domain on the Poincare disk, each vertex knows its father in the closed mesh
+*
+*******************************************************************************/
+
+#ifndef  _COVERING_SPACE_MESH_H_
+#define  _COVERING_SPACE_MESH_H_
+
+#include "Mesh/Vertex.h"
+#include "Mesh/Edge.h"
+#include "Mesh/Face.h"
+#include "Mesh/HalfEdge.h"
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/iterators.h"
+
+namespace MeshLib
+{
+/*! \brief CCoveringSpaceVertex class
+*
+*	Vertex class for the fundamental domain
+*   trait: the father vertex id in the closed mesh m_father
+*/
+class CCoveringSpaceVertex : public  CVertex
+{
+public:
+	/*! CCoveringSpaceVertex constructor */
+	CCoveringSpaceVertex() { m_father = 0; };
+	/*! father vertex id */
+	int & father() { return m_father; };
+protected:
+	/*! father vertex id */
+	int m_father;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------------------------
+
+	Covering Space Mesh
+
+----------------------------------------------------------------------------------------------------------------------------------------*/
+/*!	\brief CCoveringSpaceMesh class
+*
+*	Mesh class for the fundamental domain
+*/
+template<typename V, typename E, typename F, typename H>
+class CCoveringSpaceMesh : public CBaseMesh<V,E,F,H>
+{
+public:
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H>   MeshEdgeIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H>   MeshFaceIterator;
+};
+
+typedef CCoveringSpaceMesh<CCoveringSpaceVertex, CEdge, CFace, CHalfEdge> CCSMesh;
+
+};
+#endif  //_COVERING_SPACE_MESH_H_
@@ -0,0 +1,324 @@
+/*!
+*      \file DistanceField.h
+*      \brief Hop and geodesic distance fields from a set of source vertices
+*
+*		The distance field is shared by puncturing ( the center vertex is the farthest one from the boundary ),
+*		cut tracing ( the shortest path from one boundary loop to another ) and seed selection.
+*/
+/*******************************************************************************
+*      Distance Field
+*
+*    Purpose:
+*
+*       Compute the hop distance / the geodesic distance along the edges from a set of source vertices
+*
+*	Input
+*       A mesh, the source vertices, optionally the sink vertices, which are reached but not expanded,
+*       and the target vertices, the search stops at the first one reached
+*	Output
+*       The distance, the parent in the shortest path tree, and the reaching order of each vertex
+*
+*******************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------------------
+
+#include "DistanceField/DistanceField.h"
+
+using namespace MeshLib;
+
+	CDistanceField<CPMesh, CPunctureVertex> field( & mesh );
+
+	std::vector<CPunctureVertex*> sources;
+	...
+	field._hop( sources );
+	CPunctureVertex * center = field.farthest();
+
+--------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _DISTANCE_FIELD_H_
+#define _DISTANCE_FIELD_H_
+
+#include <unordered_map>
+#include <vector>
+#include <queue>
+#include <functional>
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/iterators.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MeshLib
+{
+/*! \brief CDistanceField class
+*
+*	Hop distance and geodesic distance from a set of source vertices. The vertex adjacency is
+*   stored in compressed rows once. The hop distance is computed by a level synchronous breadth
+*   first search, each thread expands a part of the current frontier into its own frontier, the
+*   thread frontiers are merged in order, such that the result equals to the serial search.
+*
+*   \tparam M mesh class, which defines MeshVertexIterator and VertexVertexIterator
+*   \tparam V vertex class
+*/
+template<typename M, typename V>
+class CDistanceField
+{
+public:
+	/*! CDistanceField constructor
+	 * \param pMesh the input mesh
+	 */
+	CDistanceField( M * pMesh );
+	/*! CDistanceField destructor */
+	~CDistanceField(){};
+
+	/*! hop distance from the source vertices
+	 * \param sources the source vertices, whose distances are 0
+	 */
+	void _hop( std::vector<V*> & sources );
+	/*! geodesic distance along the edges from the source vertices
+	 * \param sources the source vertices, whose distances are 0
+	 */
+	void _geodesic( std::vector<V*> & sources );
+
+	/*! sink vertex, which is reached but not expanded, e.g. boundary vertices */
+	int  & sink( V * v )    { return m_sink[ m_index[v] ]; };
+	/*! target vertex, the search stops once a target is reached, the farther vertices are left unreached */
+	int  & target( V * v )  { return m_target[ m_index[v] ]; };
+	/*! the first target vertex reached, NULL if none */
+	V *  reached()          { return m_reached; };
+	/*! distance of the vertex, -1 if it is not reached */
+	double distance( V * v ) { return m_distance[ m_index[v] ]; };
+	/*! parent of the vertex in the shortest path tree, NULL for sources and unreached vertices */
+	V *  parent( V * v )    { int p = m_parent[ m_index[v] ]; return ( p < 0 )? NULL: m_verts[p]; };
+	/*! reached vertices in the order of non-decreasing distances */
+	std::vector<V*> & order() { return m_order; };
+	/*! the last reached vertex, the farthest one from the sources */
+	V *  farthest()         { return m_order.empty()? NULL: m_order.back(); };
+
+protected:
+	/*! build the vertex index and the compressed adjacency */
+	void _adjacency();
+	/*! reset the distances and put the sources */
+	void _reset( std::vector<V*> & sources );
+
+	/*! input mesh */
+	M * m_pMesh;
+	/*! vertices by index */
+	std::vector<V*>   m_verts;
+	/*! vertex index, the accessors look it up for every call */
+	std::unordered_map<V*,int> m_index;
+	/*! neighbors of vertex i are m_neighbors[ m_offset[i] .. m_offset[i+1] ) */
+	std::vector<int>  m_offset;
+	/*! compressed adjacency */
+	std::vector<int>  m_neighbors;
+	/*! sink flags */
+	std::vector<int>  m_sink;
+	/*! target flags */
+	std::vector<int>  m_target;
+	/*! the first target reached */
+	V *               m_reached;
+	/*! distances */
+	std::vector<double> m_distance;
+	/*! parents in the shortest path tree */
+	std::vector<int>  m_parent;
+	/*! reached vertices */
+	std::vector<V*>   m_order;
+};
+
+//CDistanceField constructor
+template<typename M, typename V>
+CDistanceField<M,V>::CDistanceField( M * pMesh )
+{
+	m_pMesh = pMesh;
+	m_reached = NULL;
+	_adjacency();
+};
+
+//build the vertex index and the compressed adjacency
+template<typename M, typename V>
+void CDistanceField<M,V>::_adjacency()
+{
+	m_index.reserve( m_pMesh->numVertices() );
+	for( typename M::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
+	{
+		V * v = *viter;
+		m_index[v] = (int) m_verts.size();
+		m_verts.push_back( v );
+	}
+
+	m_offset.push_back( 0 );
+	for( size_t i = 0; i < m_verts.size(); i ++ )
+	{
+		for( typename M::VertexVertexIterator vviter( m_verts[i] ); !vviter.end(); ++ vviter )
+		{
+			V * w = *vviter;
+			m_neighbors.push_back( m_index[w] );
+		}
+		m_offset.push_back( (int) m_neighbors.size() );
+	}
+
+	m_sink.assign( m_verts.size(), 0 );
+	m_target.assign( m_verts.size(), 0 );
+};
+
+//reset the distances, put the sources
+template<typename M, typename V>
+void CDistanceField<M,V>::_reset( std::vector<V*> & sources )
+{
+	m_distance.assign( m_verts.size(), -1 );
+	m_parent.assign( m_verts.size(), -1 );
+	m_order.clear();
+	m_reached = NULL;
+
+	for( size_t i = 0; i < sources.size(); i ++ )
+	{
+		int k = m_index[ sources[i] ];
+		if( m_distance[k] == 0 ) continue;
+		m_distance[k] = 0;
+		m_order.push_back( sources[i] );
+	}
+};
+
+//hop distance, level synchronous breadth first search
+template<typename M, typename V>
+void CDistanceField<M,V>::_hop( std::vector<V*> & sources )
+{
+	_reset( sources );
+
+	std::vector<int> frontier;
+	for( size_t i = 0; i < m_order.size(); i ++ )
+	{
+		int k = m_index[ m_order[i] ];
+		if( m_target[k] )
+		{
+			m_reached = m_order[i];
+			return;
+		}
+		frontier.push_back( k );
+	}
+
+	int nthreads = 1;
+#ifdef _OPENMP
+	nthreads = omp_get_max_threads();
+#endif
+	//candidates found by each thread, pairs of ( vertex, parent )
+	std::vector< std::vector<int> > local( nthreads );
+
+	double level = 0;
+	while( !frontier.empty() )
+	{
+		level += 1;
+		int n = (int) frontier.size();
+
+		for( int t = 0; t < nthreads; t ++ )
+		{
+			local[t].clear();
+		}
+
+		//each thread takes a contiguous chunk of the frontier, the distances are only read
+#pragma omp parallel num_threads( nthreads )
+		{
+			int t  = 0;
+			int nt = 1;
+#ifdef _OPENMP
+			t  = omp_get_thread_num();
+			nt = omp_get_num_threads();
+#endif
+			std::vector<int> & cand = local[t];
+
+			int begin = ( n * t ) / nt;
+			int end   = ( n * ( t + 1 ) ) / nt;
+
+			for( int i = begin; i < end; i ++ )
+			{
+				int v = frontier[i];
+				if( m_sink[v] ) continue;
+
+				for( int j = m_offset[v]; j < m_offset[v+1]; j ++ )
+				{
+					int w = m_neighbors[j];
+					if( m_distance[w] >= 0 ) continue;
+					cand.push_back( w );
+					cand.push_back( v );
+				}
+			}
+		}
+
+		//merge the thread frontiers in order, the first parent wins, the first target ends the search
+		frontier.clear();
+		for( int t = 0; t < nthreads && m_reached == NULL; t ++ )
+		{
+			std::vector<int> & cand = local[t];
+			for( size_t i = 0; i < cand.size(); i += 2 )
+			{
+				int w = cand[i];
+				if( m_distance[w] >= 0 ) continue;
+				m_distance[w] = level;
+				m_parent[w]   = cand[i+1];
+				m_order.push_back( m_verts[w] );
+				frontier.push_back( w );
+				if( m_target[w] )
+				{
+					m_reached = m_verts[w];
+					break;
+				}
+			}
+		}
+		if( m_reached != NULL ) break;
+	}
+};
+
+//geodesic distance along the edges, Dijkstra algorithm
+template<typename M, typename V>
+void CDistanceField<M,V>::_geodesic( std::vector<V*> & sources )
+{
+	_reset( sources );
+	m_order.clear();
+
+	typedef std::pair<double,int> CEntry;
+	std::priority_queue< CEntry, std::vector<CEntry>, std::greater<CEntry> > vqueue;
+
+	for( size_t i = 0; i < sources.size(); i ++ )
+	{
+		vqueue.push( CEntry( 0, m_index[ sources[i] ] ) );
+	}
+
+	std::vector<bool> done( m_verts.size(), false );
+
+	while( !vqueue.empty() )
+	{
+		CEntry head = vqueue.top();
+		vqueue.pop();
+
+		int v = head.second;
+		if( done[v] ) continue;
+		done[v] = true;
+		m_order.push_back( m_verts[v] );
+
+		if( m_target[v] )
+		{
+			m_reached = m_verts[v];
+			break;
+		}
+		if( m_sink[v] ) continue;
+
+		for( int j = m_offset[v]; j < m_offset[v+1]; j ++ )
+		{
+			int w = m_neighbors[j];
+			if( done[w] ) continue;
+
+			double d = m_distance[v] + ( m_verts[v]->point() - m_verts[w]->point() ).norm();
+			if( m_distance[w] < 0 || d < m_distance[w] )
+			{
+				m_distance[w] = d;
+				m_parent[w]   = v;
+				vqueue.push( CEntry( d, w ) );
+			}
+		}
+	}
+};
+
+}
+#endif  //_DISTANCE_FIELD_H_
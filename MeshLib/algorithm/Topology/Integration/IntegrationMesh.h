@@ -199,19 +199,19 @@ template<typename V, typename E, typename F, typename H>
 class CIntegrationMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
 public:
 };
 
 
 typedef CIntegrationMesh<CIntegrationVertex, CIntegrationEdge, CFace, CHalfEdge> CIMesh;
 
-unsigned long long CIMesh::m_input_traits  = VERTEX_FATHER | EDGE_DUV;
-unsigned long long CIMesh::m_output_traits = VERTEX_UV;
+template<> inline unsigned long long CBaseMesh<CIntegrationVertex, CIntegrationEdge, CFace, CHalfEdge>::m_input_traits  = VERTEX_FATHER | EDGE_DUV;
+template<> inline unsigned long long CBaseMesh<CIntegrationVertex, CIntegrationEdge, CFace, CHalfEdge>::m_output_traits = VERTEX_UV;
 
 };
 
-#endif  _INTEGRATION_TRAIT_H_
\ No newline at end of file
+#endif  //_INTEGRATION_TRAIT_H_
\ No newline at end of file
@@ -9,6 +9,7 @@
 */
 
 #include "Puncture.h"
+#include "Trace/Trace.h"
 
 using namespace MeshLib;
 
@@ -36,39 +37,24 @@ void CPuncture::_puncture()
 		return;
 	}
 */
-    std::queue<CPunctureVertex*> vqueue;
+	std::vector<CPunctureVertex*> sources;
 
 	for( CPMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); ++ viter )
     {
       CPunctureVertex * v = *viter;
-	  if( !v->boundary() )
-		 v->touched() = false;
-	  else
+	  if( v->boundary() )
 	  {
-		  v->touched() = true;
-		  vqueue.push( v );
+		  sources.push_back( v );
 	  }
-	
     }
-    
-    CPunctureVertex * destiny = NULL;
 
+	//the center is the last vertex reached by the breadth first search from the boundary
+	CDistanceField<CPMesh,CPunctureVertex> field( m_pMesh );
+	field._hop( sources );
 
-    while( ! vqueue.empty() )
-    {
-        CPunctureVertex * head = vqueue.front();
-        vqueue.pop();
-		destiny = head;		        
-		for( CPMesh::VertexVertexIterator vviter( head ); !vviter.end(); ++ vviter )
-        {
-            CPunctureVertex * w = *vviter;
-            if( w->touched() ) continue;
-            w->touched() = true;
-            vqueue.push( w );
-        }
-    }
+    CPunctureVertex * destiny = field.farthest();
 
-	printf("Find the center vertex %d\n", destiny->id() );
+	TRACE_GAUGE( "CPuncture::_puncture center vertex", destiny->id() );
 
 	CFace * punched_face = NULL;
 
@@ -111,13 +97,7 @@ void CPuncture::_fill_hole()
 	}
 
 
-	int fid = -1;
+	int fid = m_pMesh->maxFaceId();
 
-	for( CPMesh::MeshFaceIterator fiter( m_pMesh ); !fiter.end(); fiter ++ )
-	{
-		CFace * pF = *fiter;
-		fid = (fid> pF->id())? fid: pF->id();
-	}
-	
 	m_pMesh->createFace( v, fid + 1 );
 }
\ No newline at end of file
@@ -66,6 +66,7 @@ int main( int argc, char * argv[] )
 
 #include <queue>
 #include "PunctureMesh.h"
+#include "Topology/DistanceField/DistanceField.h"
 
 namespace MeshLib
 {
@@ -58,14 +58,14 @@ template<typename V, typename E, typename F, typename H>
 class CPunctureMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H> CBoundary;
-	typedef CLoop<V,E,F,H> CLoop;
-	typedef MeshFaceIterator<V,E,F,H> MeshFaceIterator;
-	typedef MeshVertexIterator<V,E,F,H> MeshVertexIterator;
-	typedef MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
-	typedef VertexFaceIterator<V,E,F,H> VertexFaceIterator;
+	typedef MeshLib::CBoundary<V,E,F,H> CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H> CLoop;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H> MeshFaceIterator;
+	typedef MeshLib::MeshVertexIterator<V,E,F,H> MeshVertexIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H> MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H> VertexEdgeIterator;
+	typedef MeshLib::VertexFaceIterator<V,E,F,H> VertexFaceIterator;
 public:
 };
 
@@ -73,4 +73,4 @@ public:
 typedef CPunctureMesh<CPunctureVertex, CEdge, CFace, CHalfEdge> CPMesh;
 
 };
-#endif  _PUNCTURE_MESH_H_
\ No newline at end of file
+#endif  //_PUNCTURE_MESH_H_
\ No newline at end of file
@@ -31,8 +31,7 @@ CWedge::CWedge(CSMesh * pMesh, CWedgeHalfEdge * half_edge)
 	{
 		if( edge->boundary() )
 		{
-			CWedgeVertex * pW = m_mesh->halfedgeTarget( half_edge );
-			assert( m_mesh->edgeHalfedge( edge,0 ) == m_mesh->vertexMostCcwInHalfEdge( pW ) );
+			assert( m_mesh->edgeHalfedge( edge,0 ) == m_mesh->vertexMostCcwInHalfEdge( m_mesh->halfedgeTarget( half_edge ) ) );
 		}
 
 		/*
@@ -183,7 +182,6 @@ void CWMesh::_construct()
 			//the first edge is the most Ccw Edge
 
 			CWedgeHalfEdge * he = m_pMesh->vertexMostCcwInHalfEdge( vertex );
-			CWedge		   * head = NULL;
 			CWedgeEdge     * pE = m_pMesh->halfedgeEdge( he );
 
 			while( !pE->boundary() && !pE->sharp() )
@@ -14,12 +14,12 @@
 #include <vector>
 
 #include "Mesh/BaseMesh.h"
-#include "Mesh/Boundary.h"
+#include "Mesh/boundary.h"
 #include "Mesh/Vertex.h"
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
+#include "Mesh/iterators.h"
 #include "Parser/parser.h"
 #include "Parser/traits_io.h"
 
@@ -154,24 +154,24 @@ template<typename V, typename E, typename F, typename H>
 class CSliceMesh : public CBaseMesh<V,E,F,H>
 {
 public:
-	typedef CBoundary<V,E,F,H>             CBoundary;
-	typedef CLoop<V,E,F,H>				  CLoop;
-
-	typedef MeshVertexIterator<V,E,F,H>   MeshVertexIterator;
-	typedef MeshFaceIterator<V,E,F,H>	  MeshFaceIterator;
-	typedef MeshEdgeIterator<V,E,F,H>     MeshEdgeIterator;
-	typedef VertexVertexIterator<V,E,F,H> VertexVertexIterator;
-	typedef FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
-	typedef FaceVertexIterator<V,E,F,H>   FaceVertexIterator;
-	typedef VertexEdgeIterator<V,E,F,H>   VertexEdgeIterator;
-	typedef VertexInHalfedgeIterator<V,E,F,H>   VertexInHalfedgeIterator;
+	typedef MeshLib::CBoundary<V,E,F,H>             CBoundary;
+	typedef MeshLib::CLoop<V,E,F,H>				  CLoop;
+
+	typedef MeshLib::MeshVertexIterator<V,E,F,H>   MeshVertexIterator;
+	typedef MeshLib::MeshFaceIterator<V,E,F,H>	  MeshFaceIterator;
+	typedef MeshLib::MeshEdgeIterator<V,E,F,H>     MeshEdgeIterator;
+	typedef MeshLib::VertexVertexIterator<V,E,F,H> VertexVertexIterator;
+	typedef MeshLib::FaceHalfedgeIterator<V,E,F,H> FaceHalfedgeIterator;
+	typedef MeshLib::FaceVertexIterator<V,E,F,H>   FaceVertexIterator;
+	typedef MeshLib::VertexEdgeIterator<V,E,F,H>   VertexEdgeIterator;
+	typedef MeshLib::VertexInHalfedgeIterator<V,E,F,H>   VertexInHalfedgeIterator;
 };
 
 
 typedef CSliceMesh<CWedgeVertex, CWedgeEdge, CFace, CWedgeHalfEdge> CSMesh;
 
-unsigned long long CSMesh::m_input_traits  = EDGE_SHARP;
-unsigned long long CSMesh::m_output_traits = VERTEX_FATHER;
+template<> inline unsigned long long CBaseMesh<CWedgeVertex, CWedgeEdge, CFace, CWedgeHalfEdge>::m_input_traits  = EDGE_SHARP;
+template<> inline unsigned long long CBaseMesh<CWedgeVertex, CWedgeEdge, CFace, CWedgeHalfEdge>::m_output_traits = VERTEX_FATHER;
 
 }
-#endif  _WEDGE_MESH_H_
\ No newline at end of file
+#endif  //_WEDGE_MESH_H_
\ No newline at end of file
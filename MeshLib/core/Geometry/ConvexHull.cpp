@@ -0,0 +1,453 @@
+#include "ConvexHull.h"
+
+using namespace MeshLib;
+
+
+//boundary operator
+
+void ConvexHull::CConvexHull::boundary( ConvexHull::CSimplex4 & Simplex, std::vector<int> & tets )
+{
+	for( int i = 0; i < 5; i ++ )
+	{
+		std::vector<ConvexHull::CVertex*> vts;
+		
+		for( int j = 0; j < 5; j ++ )
+		{
+			if( j == i ) continue;
+			vts.push_back( Simplex[j] );
+		}
+	
+		//swap
+		if( i%2 )
+		{
+			ConvexHull::CVertex * v = vts[0];
+			vts[0] = vts[1];
+			vts[1] = v;
+		}
+
+		tets.push_back( _new_tet( vts[0], vts[1], vts[2], vts[3] ) );
+	}
+};
+
+std::ostream & operator<< ( std::ostream & is, ConvexHull::CMatrix & m )
+{
+	for( int k = 0; k < 4; k ++ )
+	{
+		for( int j = 0; j < 4; j ++ )
+		{
+			is << m(k,j) << " ";
+		}
+		is << std::endl;
+	}
+	is << std::endl;
+	return is;
+};
+
+//ridge of a facet, the sorted ids of the three vertices other than the opposite one
+
+struct CRidge
+{
+	int id[3];
+	int tet;
+	int slot;
+	bool operator<( const CRidge & r ) const
+	{
+		for( int i = 0; i < 3; i ++ )
+		{
+			if( id[i] != r.id[i] ) return id[i] < r.id[i];
+		}
+		return tet < r.tet;
+	};
+	bool operator==( const CRidge & r ) const
+	{
+		return id[0] == r.id[0] && id[1] == r.id[1] && id[2] == r.id[2];
+	};
+};
+
+//constructor
+
+ConvexHull::CConvexHull::CConvexHull( )
+{
+	m_stamp = 0;
+};
+
+int ConvexHull::CConvexHull::_new_tet( CVertex * v0, CVertex * v1, CVertex * v2, CVertex * v3 )
+{
+	int t;
+	if( !m_free.empty() )
+	{
+		t = m_free.back();
+		m_free.pop_back();
+		m_tets[t] = CTet( v0, v1, v2, v3 );
+	}
+	else
+	{
+		t = (int) m_tets.size();
+		m_tets.push_back( CTet( v0, v1, v2, v3 ) );
+	}
+	return t;
+};
+
+void ConvexHull::CConvexHull::_delete_tet( int t )
+{
+	m_tets[t].alive() = false;
+	m_free.push_back( t );
+};
+
+double ConvexHull::CConvexHull::_orient( CVertex * pV, CTet & T )
+{
+	ConvexHull::CSimplex4 Simplex;
+	Simplex[0] = pV;
+	for( int k = 0; k < 4; k ++ )
+	{
+		Simplex[k+1] = T[k];
+	}
+	return Simplex.volume();
+};
+
+void ConvexHull::CConvexHull::_link( std::vector<int> & tets )
+{
+	std::vector<CRidge> ridges;
+
+	for( size_t i = 0; i < tets.size(); i ++ )
+	{
+		CTet & T = m_tets[ tets[i] ];
+		for( int k = 0; k < 4; k ++ )
+		{
+			if( T.neighbor(k) >= 0 ) continue;
+
+			CRidge r;
+			int n = 0;
+			for( int j = 0; j < 4; j ++ )
+			{
+				if( j != k ) r.id[n++] = T[j]->id();
+			}
+			std::sort( r.id, r.id + 3 );
+			r.tet  = tets[i];
+			r.slot = k;
+			ridges.push_back( r );
+		}
+	}
+
+	std::sort( ridges.begin(), ridges.end() );
+
+	for( size_t i = 0; i + 1 < ridges.size(); i ++ )
+	{
+		if( !( ridges[i] == ridges[i+1] ) ) continue;
+
+		m_tets[ ridges[i].tet   ].neighbor( ridges[i].slot   ) = ridges[i+1].tet;
+		m_tets[ ridges[i+1].tet ].neighbor( ridges[i+1].slot ) = ridges[i].tet;
+		i ++;
+	}
+};
+
+void ConvexHull::CConvexHull::_batch( std::vector<int> & tets )
+{
+	m_plane_batch.clear();
+	for( size_t i = 0; i < tets.size(); i ++ )
+	{
+		CTet & T = m_tets[ tets[i] ];
+		m_plane_batch.add( &T[0]->point()[0], &T[1]->point()[0], &T[2]->point()[0], &T[3]->point()[0] );
+	}
+};
+
+bool ConvexHull::CConvexHull::_assign( int v, std::vector<int> & tets )
+{
+	CVertex * pV = m_verts[v];
+
+	m_plane_batch.orient( &pV->point()[0], m_signs );
+
+	for( size_t i = 0; i < tets.size(); i ++ )
+	{
+		if( m_signs[i] < 0 )
+		{
+			CTet & T = m_tets[ tets[i] ];
+			m_conflict[v] = tets[i];
+			m_next[v]     = T.conflict();
+			T.conflict()  = v;
+			return true;
+		}
+	}
+	m_conflict[v] = -1;
+	return false;
+};
+
+//collect the tets visible from pV by walking from the tet in the bucket of pV;
+//the visible region is connected, the walk stops at the horizon ridges
+
+void ConvexHull::CConvexHull::_visibility( ConvexHull::CVertex * pV )
+{
+	m_visible.clear();
+	m_horizon.clear();
+	m_stamp ++;
+
+	int start = m_conflict[ pV->id() - 1 ];
+	if( start < 0 ) return;
+
+	m_tets[start].stamp()   = m_stamp;
+	m_tets[start].visible() = true;
+	m_visible.push_back( start );
+
+	for( size_t i = 0; i < m_visible.size(); i ++ )
+	{
+		int t = m_visible[i];
+
+		for( int k = 0; k < 4; k ++ )
+		{
+			int n = m_tets[t].neighbor(k);
+			CTet & N = m_tets[n];
+
+			if( N.stamp() != m_stamp )
+			{
+				N.stamp()   = m_stamp;
+				N.visible() = ( _orient( pV, N ) < 0 );
+				if( N.visible() ) m_visible.push_back( n );
+			}
+			if( !N.visible() )
+			{
+				m_horizon.push_back( std::pair<int,int>( t, k ) );
+			}
+		}
+	}
+};
+
+//construct the initial convex hull
+
+void ConvexHull::CConvexHull::_initialize()
+{
+	if( m_verts.size() < 5 ) 
+	{
+		std::cout << "The input points should be more than 5" << std::endl;
+		return;
+	}
+
+	//initialize 
+	ConvexHull::CSimplex4 Simplex;
+	
+	for( int i = 0; i < 5; i ++ )
+	{
+		Simplex[i] = m_verts[ m_order[i] ];
+	}
+
+	//swap
+	if( Simplex.volume() < 0 )
+	{
+		ConvexHull::CVertex* pV  = Simplex[0]; Simplex[0]= Simplex[1]; Simplex[1]   = pV;
+	}
+
+	//construct the initial tets
+	std::vector<int> tets;
+	boundary( Simplex, tets );
+	_link( tets );
+	m_cone = tets;
+
+	//initial buckets
+	_batch( tets );
+	for( size_t k = 5; k < m_order.size(); k ++ )
+	{
+		_assign( m_order[k], tets );
+	}
+};
+
+//the points are inserted in a shuffled order, the first five points span the initial simplex
+
+void ConvexHull::CConvexHull::compute_convex_hull( std::vector<CPoint4> & pts )
+{
+	for( size_t i = 0; i < pts.size(); i ++ )
+	{
+		ConvexHull::CVertex * pV = new ConvexHull::CVertex((int)(i+1));
+		pV->point() = pts[i];
+		m_verts.push_back( pV );
+	}
+
+	int n = (int) m_verts.size();
+	m_conflict.assign( n, -1 );
+	m_next.assign( n, -1 );
+	m_order.resize( n );
+	for( int i = 0; i < n; i ++ ) m_order[i] = i;
+
+	//fixed seed linear congruential shuffle, keep the first five points in front
+	unsigned int seed = 12345;
+	for( int i = n - 1; i > 5; i -- )
+	{
+		seed = seed * 1103515245u + 12345u;
+		int j = 5 + (int)( ( seed >> 8 ) % (unsigned int)( i - 4 ) );
+		std::swap( m_order[i], m_order[j] );
+	}
+
+	_initialize();
+	consistency_check( m_cone );
+	for( size_t k = 5; k < m_order.size(); k ++ )
+	{
+		if( k % 128 == 0 )
+		{
+			std::cout << k << "/" << m_verts.size() << std::endl;
+		}
+		ConvexHull::CVertex * pV = m_verts[ m_order[k] ];
+		//inside the current hull
+		if( m_conflict[ m_order[k] ] < 0 ) continue;
+		_insert_one_vertex( pV );
+		consistency_check( m_cone );
+	}
+	_remove_upper_tets();
+}
+
+//verify the neighbor links of the tets: symmetric, and no tet is seen by the
+//opposite vertex of a neighbor. Only the tets of the last insertion are checked,
+//the others did not change
+
+void ConvexHull::CConvexHull::consistency_check( std::vector<int> & tets )
+{
+	for( size_t i = 0; i < tets.size(); i ++ )
+	{
+		int t = tets[i];
+		CTet & T = m_tets[t];
+
+		for( int k = 0; k < 4; k ++ )
+		{
+			int n = T.neighbor(k);
+			if( n < 0 || !m_tets[n].alive() )
+			{
+				std::cout << "Error: tet " << t << " misses a neighbor" << std::endl;
+				continue;
+			}
+			CTet & N = m_tets[n];
+
+			int back = -1;
+			for( int j = 0; j < 4; j ++ )
+			{
+				if( N.neighbor(j) == t ) back = j;
+			}
+			if( back < 0 )
+			{
+				std::cout << "Error: tet " << t << " is not linked back" << std::endl;
+				continue;
+			}
+			if( _orient( N[back], T ) < 0 || _orient( T[k], N ) < 0 )
+			{
+				std::cout << "Error: tets " << t << " " << n << " are not convex" << std::endl;
+			}
+		}
+	}
+}
+
+void ConvexHull::CConvexHull::_insert_one_vertex( CVertex * pV )
+{
+	int v = pV->id() - 1;
+
+	//walk the visible region
+	_visibility( pV );
+
+	//cone the horizon ridges to pV; the new tet replaces the opposite vertex by pV,
+	//which keeps the removed vertex on the inner side
+	std::vector<int> new_tets;
+
+	for( size_t i = 0; i < m_horizon.size(); i ++ )
+	{
+		int t = m_horizon[i].first;
+		int k = m_horizon[i].second;
+
+		CVertex * w[4];
+		for( int j = 0; j < 4; j ++ ) w[j] = m_tets[t][j];
+		w[k] = pV;
+
+		int n = m_tets[t].neighbor(k);
+		int s = _new_tet( w[0], w[1], w[2], w[3] );
+
+		m_tets[s].neighbor(k) = n;
+		for( int j = 0; j < 4; j ++ )
+		{
+			if( m_tets[n].neighbor(j) == t ) m_tets[n].neighbor(j) = s;
+		}
+		new_tets.push_back( s );
+	}
+
+	//the ridges through pV
+	_link( new_tets );
+	m_cone = new_tets;
+
+	//collect the buckets of the visible tets before they are reused
+	std::vector<int> orphans;
+	for( size_t i = 0; i < m_visible.size(); i ++ )
+	{
+		CTet & T = m_tets[ m_visible[i] ];
+		for( int q = T.conflict(); q >= 0; q = m_next[q] )
+		{
+			if( q != v ) orphans.push_back( q );
+		}
+		T.conflict() = -1;
+	}
+
+	for( size_t i = 0; i < m_visible.size(); i ++ )
+	{
+		_delete_tet( m_visible[i] );
+	}
+
+	m_conflict[v] = -1;
+
+	//an orphan outside the new hull sees one of the new tets
+	_batch( new_tets );
+	for( size_t i = 0; i < orphans.size(); i ++ )
+	{
+		_assign( orphans[i], new_tets );
+	}
+};
+
+
+//exact sign, see _orient4d
+
+double ConvexHull::CSimplex4::volume()
+{
+	return _orient4d( &m_v[0]->point()[0], &m_v[1]->point()[0], &m_v[2]->point()[0], &m_v[3]->point()[0], &m_v[4]->point()[0] );
+};
+
+
+ConvexHull::CConvexHull::~CConvexHull()
+{
+	m_tets.clear();
+
+	for( size_t k = 0; k < m_verts.size(); k ++ )
+	{
+		delete m_verts[k];
+	}
+	m_verts.clear();
+
+};
+
+//remove the tets visible from the point at infinity above the lifted points. For
+//p = (0,0,0,w), w large, the volume of (p,T) tends to w times the volume of the
+//projection of T to R3, so the upper tets and the vertical ones are those whose
+//projection has a nonpositive volume
+
+void ConvexHull::CConvexHull::_remove_upper_tets()
+{
+	for( size_t t = 0; t < m_tets.size(); t ++ )
+	{
+		CTet & T = m_tets[t];
+		if( !T.alive() ) continue;
+
+		if( _orient3d( &T[0]->point()[0], &T[1]->point()[0], &T[2]->point()[0], &T[3]->point()[0] ) <= 0 )
+		{
+			_delete_tet( (int) t );
+		}
+	}
+}
+
+void ConvexHull::CConvexHull::_output( const char * name )
+{
+	std::ofstream of(name);
+	for( size_t k = 0; k < m_verts.size(); k ++ )
+	{
+		ConvexHull::CVertex * pV = m_verts[k];
+		of << "Vertex " << pV->id()<< " " << pV->point()[0]<< " " << pV->point()[1]<<" " << pV->point()[2] << std::endl;
+	}
+	size_t k = 0;
+	for( size_t t = 0; t < m_tets.size(); t ++ )
+	{
+		ConvexHull::CTet & T = m_tets[t];
+		if( !T.alive() ) continue;
+		of << "Tet " << ++k << " " << T[0]->id() << " " << T[1]->id() << " " << T[2]->id() << " " << T[3]->id()  << std::endl;
+	}
+	of.close();
+
+}
@@ -16,6 +16,7 @@
 #include <limits>
 #include <cstdlib>
 #include <ctime>
+#include <algorithm>
 
 #include "Mesh/Vertex.h"
 #include "Mesh/Edge.h"
@@ -27,7 +28,7 @@
 #include "Mesh/iterators.h"
 #include "Parser/parser.h"
 #include "TriangleCubeIntersect.h"
-#include "Geometry/MemoryPool.h"
+#include "Geometry/Predicates.h"
 
 namespace MeshLib
 {
@@ -74,7 +75,6 @@ namespace MeshLib
 		*******************************************************************************************************/
 		class CVertex;
 		class CEdge;
-		class CFace;
 		class CTet;
 		class CSimplex4;
 
@@ -112,16 +112,10 @@ namespace MeshLib
 			~CVertex() {};
 			CPoint4 & point() { return m_point; };
 			int & id() { return m_id; };
-			std::vector<CFace*> & faces() { return m_faces; };
-			
-			CFace * find( CFace * pF );
-			void remove( CFace * pF  );
-			
 
 		protected:
 			CPoint4 m_point;
 			int     m_id;
-			std::vector<CFace*> m_faces;
 		};
 
 		class CEdge
@@ -134,62 +128,26 @@ namespace MeshLib
 			CVertex * m_v[2];
 		};
 
-		class CFace
+		/*!
+		 *	Facet of the hull. The facet is oriented such that a point p sees it
+		 *	iff the simplex (p, v0, v1, v2, v3) has negative volume. neighbor(i)
+		 *	is the pool index of the facet sharing the ridge opposite to v_i, 
+		 *	conflict() is the first point of the bucket of points seeing the facet.
+		 */
+		class CTet
 		{
 		public:
-			CFace() { m_tets[0] = NULL; m_tets[1] = NULL; };
-
-			CFace( CVertex * v0, CVertex * v1, CVertex * v2 ) { m_v[0] = v0; m_v[1] = v1; m_v[2] = v2; m_tets[0] = NULL; m_tets[1]=NULL; };
-			~CFace(){};
-			CVertex *& operator[]( int i ) { return m_v[i]; };
-			CVertex *  operator[](int i ) const { return m_v[i]; };
-
-			//verify if two faces are equal
-			bool operator== ( const CFace & face ) const
-			{
-				std::vector<int> ids;
-				std::vector<int> fid;
-				for( int i = 0; i < 3; i ++ ) { ids.push_back( m_v[i]->id() ); fid.push_back( face[i]->id() ); };
-
-				std::sort( ids.begin(), ids.end() );
-				std::sort( fid.begin(), fid.end() );
-
-				for( int i = 0; i < 3; i ++ )
-				{
-					if( ids[i] != fid[i] ) return false;
-				}
-
-				return true;
+			CTet() 
+			{ 
+				for( int i = 0; i < 4; i ++ ) { m_v[i] = NULL; m_neighbor[i] = -1; }
+				m_visible = false; m_alive = true; m_conflict = -1; m_stamp = -1;
 			};
-			
-			CTet* & tets(int i) { return m_tets[i]; };
-			CVertex * min_vert() 
-			{
-				for( int i = 0; i < 3; i ++ )
-				{
-					if( m_v[i]->id() <= m_v[(i+1)%3]->id() && m_v[i]->id() <= m_v[(i+2)%3]->id() ) return m_v[i];
-				}
-				return NULL;
+			CTet( CVertex * v0, CVertex * v1, CVertex * v2, CVertex * v3 ) 
+			{ 
+				m_v[0] = v0; m_v[1] = v1; m_v[2] = v2; m_v[3] = v3; 
+				for( int i = 0; i < 4; i ++ ) m_neighbor[i] = -1;
+				m_visible = false; m_alive = true; m_conflict = -1; m_stamp = -1;
 			};
-
-			CFace * & next() { return m_next; };
-			CFace * & prev() { return m_prev; };
-
-		protected:
-			CVertex * m_v[3];
-			//assumption:
-			//[m_tets[0], this] = +1
-			//[m_tets[1], this] = -1
-			CTet * m_tets[2];
-		protected:
-			CFace * m_prev, * m_next;
-		};
-
-		class CTet
-		{
-		public:
-			CTet() { m_visible = false; };
-			CTet( CVertex * v0, CVertex * v1, CVertex * v2, CVertex * v3 ) { m_v[0] = v0; m_v[1] = v1; m_v[2] = v2; m_v[3] = v3; m_visible = false; };
 			~CTet(){};
 			CVertex *& operator[]( int i ) { return m_v[i]; };
 			CVertex *  operator[]( int i ) const { return m_v[i]; };
@@ -212,15 +170,19 @@ namespace MeshLib
 				return true;
 			};
 			
-			bool & visible() { return m_visible; };
-			CTet * & next() { return m_next; };
-			CTet * & prev() { return m_prev; };
+			bool & visible()          { return m_visible;  };
+			bool & alive()            { return m_alive;    };
+			int  & neighbor( int i )  { return m_neighbor[i]; };
+			int  & conflict()         { return m_conflict; };
+			int  & stamp()            { return m_stamp;    };
 
 		protected:
 			CVertex * m_v[4];
+			int       m_neighbor[4];
 			bool      m_visible;
-		protected:
-			CTet * m_prev, * m_next;
+			bool      m_alive;
+			int       m_conflict;
+			int       m_stamp;
 		};
 
 		class CSimplex4
@@ -247,13 +209,21 @@ namespace MeshLib
 
 
 
+		/*!
+		 *	Randomized incremental convex hull in R4. Every point which is not
+		 *	inserted yet sits in the bucket of one facet it sees (conflict graph).
+		 *	Inserting a point walks the visible region from that facet, cones the
+		 *	horizon ridges to the point, and redistributes the buckets of the
+		 *	removed facets to the new facets. Facets live in one pooled array.
+		 */
 		class CConvexHull
 		{
 		public:
 			CConvexHull();
 			~CConvexHull();
 			void compute_convex_hull( std::vector<CPoint4> & pts );
-			std::set<CFace*> & faces() { return m_faces; };
+			/*! facet pool, including the deleted facets */
+			std::vector<CTet> & tets() { return m_tets; };
 			void _output( const char * name );
 			
 		protected:
@@ -264,22 +234,46 @@ namespace MeshLib
 			void _remove_upper_tets();
 		
 		protected:
-			//boundary operator
-			void boundary( CSimplex4 & Simplex, std::set<CTet*> & tets );
-			//boundary operator
-			void boundary( CTet & Simplex, std::set<CFace*> & faces );
-
-			int contangency( CTet * pTet, CFace * pF );
+			//boundary operator, appends the oriented facets of the simplex
+			void boundary( CSimplex4 & Simplex, std::vector<int> & tets );
+			//allocate a facet from the pool
+			int  _new_tet( CVertex * v0, CVertex * v1, CVertex * v2, CVertex * v3 );
+			//return a facet to the pool
+			void _delete_tet( int t );
+			//volume of the simplex spanned by pV and the facet, negative if pV sees the facet
+			double _orient( CVertex * pV, CTet & T );
+			//load the hyperplanes of the facets into the batch
+			void _batch( std::vector<int> & tets );
+			//put the point in the bucket of the first facet of the batch it sees, return false if none
+			bool _assign( int v, std::vector<int> & tets );
+			//link the unlinked ridges of the facets to each other
+			void _link( std::vector<int> & tets );
 			
-			void consistency_check();
+			//verify the links and the convexity across the ridges of the facets
+			void consistency_check( std::vector<int> & tets );
 		
 		protected:
-			std::set<CTet*>    m_tets;
-			std::set<CFace*>   m_faces;
+			std::vector<CTet>     m_tets;
+			std::vector<int>      m_free;
 			std::vector<CVertex*> m_verts;
 
-			CMPool<CFace>    m_face_pool;
-			CMPool<CTet>     m_tet_pool;
+			//bucket of each point, the facet it sees, -1 if inserted or inside the hull
+			std::vector<int>      m_conflict;
+			//next point in the same bucket
+			std::vector<int>      m_next;
+			//insertion order
+			std::vector<int>      m_order;
+
+			//visible facets and horizon ridges (facet, opposite vertex) of the current point
+			std::vector<int>      m_visible;
+			std::vector< std::pair<int,int> > m_horizon;
+			int                   m_stamp;
+			//facets created by the last insertion
+			std::vector<int>      m_cone;
+
+			//hyperplanes of the facets a point is assigned to
+			CPlaneBatch           m_plane_batch;
+			std::vector<int>      m_signs;
 		};
 
 
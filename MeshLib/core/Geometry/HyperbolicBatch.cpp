@@ -0,0 +1,126 @@
+#include "HyperbolicBatch.h"
+
+using namespace MeshLib;
+
+//the geodesic circle through p is orthogonal to the unit circle, 2 <p,C> = |p|^2 + 1,
+//p and q collinear with the origin give a diameter. The determinant of the system [2p; 2q] is
+//2 det, below 1e-5 the geodesic is drawn as a straight line, the threshold of the original ps.cpp
+static const double s_geodesic_eps = 1e-5;
+
+double MeshLib::_hyperbolic_distance( Complex z, Complex w )
+{
+	double t = std::abs( ( z - w ) / ( 1.0 - std::conj( w ) * z ) );
+	return log( ( 1.0 + t ) / ( 1.0 - t ) );
+}
+
+//with t = tanh(r/2), C = c (1-t^2) / (1-|c|^2 t^2) and R = t (1-|c|^2) / (1-|c|^2 t^2),
+//R is not taken from |C|^2 - R^2, which cancels for small circles near the boundary
+void MeshLib::_hyperbolic_circle( Complex c, double r, Complex & C, double & R )
+{
+	double norm = std::norm( c );
+	double t = tanh( r / 2.0 );
+	double mu = t * t;
+	double a = 1.0 - mu * norm;
+
+	C = c * ( 1.0 - mu ) / a;
+	R = t * ( 1.0 - norm ) / a;
+}
+
+int MeshLib::_hyperbolic_geodesic( Complex p, Complex q, Complex & C, double & R )
+{
+	double det = 2.0 * ( p.real() * q.imag() - p.imag() * q.real() );
+	if( fabs( 2.0 * det ) < s_geodesic_eps )
+	{
+		C = Complex( 0, 0 );
+		R = 0;
+		return 0;
+	}
+	double u = std::norm( p ) + 1.0;
+	double v = std::norm( q ) + 1.0;
+
+	C = Complex( ( q.imag() * u - p.imag() * v ) / det, ( p.real() * v - q.real() * u ) / det );
+	R = sqrt( std::norm( C ) - 1.0 );
+	return 1;
+}
+
+//t = |z-w| / |1-conj(w) z|, d = log( (1+t)/(1-t) )
+void MeshLib::_hyperbolic_distance( const double * x0, const double * y0, const double * x1, const double * y1, double * d, int n )
+{
+	for( int i = 0; i < n; i ++ )
+	{
+		double zr = x0[i], zi = y0[i];
+		double wr = x1[i], wi = y1[i];
+
+		double nr = zr - wr, ni = zi - wi;
+		double dr = 1.0 - ( wr * zr + wi * zi );
+		double di = wi * zr - wr * zi;
+		double t  = sqrt( ( nr * nr + ni * ni ) / ( dr * dr + di * di ) );
+
+		d[i] = _fast_log( ( 1.0 + t ) / ( 1.0 - t ) );
+	}
+}
+
+void MeshLib::_hyperbolic_distance( Complex w, const double * x, const double * y, double * d, int n )
+{
+	const double wr = w.real(), wi = w.imag();
+
+	for( int i = 0; i < n; i ++ )
+	{
+		double zr = x[i], zi = y[i];
+
+		double nr = zr - wr, ni = zi - wi;
+		double dr = 1.0 - ( wr * zr + wi * zi );
+		double di = wi * zr - wr * zi;
+		double t  = sqrt( ( nr * nr + ni * ni ) / ( dr * dr + di * di ) );
+
+		d[i] = _fast_log( ( 1.0 + t ) / ( 1.0 - t ) );
+	}
+}
+
+//t = tanh(r/2) = (1-e)/(1+e) with e = exp(-r), which does not overflow
+void MeshLib::_hyperbolic_circle( const double * cx, const double * cy, const double * r, double * Cx, double * Cy, double * R, int n )
+{
+	for( int i = 0; i < n; i ++ )
+	{
+		double e  = _fast_exp( -r[i] );
+		double t  = ( 1.0 - e ) / ( 1.0 + e );
+		double mu = t * t;
+
+		double x = cx[i], y = cy[i];
+		double norm = x * x + y * y;
+		double a = 1.0 / ( 1.0 - mu * norm );
+		double s = ( 1.0 - mu ) * a;
+
+		Cx[i] = x * s;
+		Cy[i] = y * s;
+		R[i]  = t * ( 1.0 - norm ) * a;
+	}
+}
+
+//same as the scalar version, the diameters are written without branches
+void MeshLib::_hyperbolic_geodesic( const double * px, const double * py, const double * qx, const double * qy,
+									double * Cx, double * Cy, double * R, int * type, int n )
+{
+	for( int i = 0; i < n; i ++ )
+	{
+		double ax = px[i], ay = py[i];
+		double bx = qx[i], by = qy[i];
+
+		double det = 2.0 * ( ax * by - ay * bx );
+		double pp  = ax * ax + ay * ay;
+		double qq  = bx * bx + by * by;
+		int circle = ( fabs( 2.0 * det ) >= s_geodesic_eps );
+
+		double inv = circle? 1.0 / det: 0.0;
+		double u = pp + 1.0;
+		double v = qq + 1.0;
+		double X = ( by * u - ay * v ) * inv;
+		double Y = ( ax * v - bx * u ) * inv;
+		double r2 = X * X + Y * Y - 1.0;
+
+		Cx[i]   = X;
+		Cy[i]   = Y;
+		R[i]    = circle? sqrt( r2 ): 0.0;
+		type[i] = circle;
+	}
+}
@@ -0,0 +1,141 @@
+/*! \file HyperbolicBatch.h
+*   \brief Hyperbolic geometry kernels on the Poincare disk
+*
+*   Distances, hyperbolic circles, geodesics and isometries, each as a scalar
+*   reference function and as a batched kernel over structure of arrays
+*/
+#ifndef  _HYPERBOLIC_BATCH_H_
+#define  _HYPERBOLIC_BATCH_H_
+
+#include <cmath>
+#include <cstring>
+#include <complex>
+
+#include "../Mobius/MobiusBatch.h"
+
+namespace MeshLib
+{
+	/*-------------------------------------------------------------------------------------------------------------------------
+
+		Elementary functions
+
+		_fast_log and _fast_exp are branch free, so loops calling them vectorize. For positive normal
+		x, |_fast_log(x) - log(x)| < 1e-16 ( |log(x)| + 1 ); for |x| < 700, the relative error of
+		_fast_exp(x) is below 3e-16. Zeros, denormals, infinities and NaNs are not handled.
+		The batched kernels agree with the scalar reference to 1e-11 relative error for points
+		with |z| < 0.999, the remaining difference comes from the conditioning near the boundary.
+		The kernel stages of the Benchmark tool check it, Benchmark -stage kernel.
+
+	--------------------------------------------------------------------------------------------------------------------------*/
+
+	/*! natural logarithm of a positive normal double */
+	inline double _fast_log( double x )
+	{
+		const double ln2_hi = 6.93147180369123816490e-01;
+		const double ln2_lo = 1.90821492927058770002e-10;
+
+		//x = m 2^e, m in [1,2), then folded into [sqrt(1/2), sqrt(2))
+		unsigned long long bits;
+		memcpy( &bits, &x, sizeof( double ) );
+		//the biased exponent is read as the double 2^52 + E, avoiding integer conversions
+		unsigned long long ebits = ( ( bits >> 52 ) & 0x7ff ) | 0x4330000000000000ULL;
+		bits = ( bits & 0x000fffffffffffffULL ) | 0x3ff0000000000000ULL;
+		double e, m;
+		memcpy( &e, &ebits, sizeof( double ) );
+		memcpy( &m, &bits,  sizeof( double ) );
+		e -= 4503599627370496.0 + 1023.0;
+
+		double big = ( m > 1.4142135623730951 )? 1.0: 0.0;
+		m *= 1.0 - 0.5 * big;
+		e += big;
+
+		//log(m) = 2 atanh(s), |s| < 0.1716
+		double s  = ( m - 1.0 ) / ( m + 1.0 );
+		double s2 = s * s;
+		double p  = 1.0/19;
+		p = p * s2 + 1.0/17;
+		p = p * s2 + 1.0/15;
+		p = p * s2 + 1.0/13;
+		p = p * s2 + 1.0/11;
+		p = p * s2 + 1.0/9;
+		p = p * s2 + 1.0/7;
+		p = p * s2 + 1.0/5;
+		p = p * s2 + 1.0/3;
+		p = p * s2;
+
+		return e * ln2_hi + ( e * ln2_lo + 2.0 * s * p + 2.0 * s );
+	};
+
+	/*! exponential, |x| < 700 */
+	inline double _fast_exp( double x )
+	{
+		const double log2e  = 1.44269504088896338700e+00;
+		const double ln2_hi = 6.93147180369123816490e-01;
+		const double ln2_lo = 1.90821492927058770002e-10;
+
+		//x = k ln2 + r, |r| <= ln2/2, k is rounded by adding and subtracting 1.5 * 2^52
+		const double round = 6755399441055744.0;
+		double k = ( x * log2e + round ) - round;
+		double r = ( x - k * ln2_hi ) - k * ln2_lo;
+
+		//Taylor polynomial of degree 13
+		double p = 1.0/6227020800.0;
+		p = p * r + 1.0/479001600.0;
+		p = p * r + 1.0/39916800.0;
+		p = p * r + 1.0/3628800.0;
+		p = p * r + 1.0/362880.0;
+		p = p * r + 1.0/40320.0;
+		p = p * r + 1.0/5040.0;
+		p = p * r + 1.0/720.0;
+		p = p * r + 1.0/120.0;
+		p = p * r + 1.0/24.0;
+		p = p * r + 1.0/6.0;
+		p = p * r + 0.5;
+		p = p * r + 1.0;
+		p = p * r + 1.0;
+
+		//2^k, the biased exponent k + 1023 is taken from the mantissa of 2^52 + k + 1023
+		double b = k + ( 4503599627370496.0 + 1023.0 );
+		unsigned long long bits;
+		memcpy( &bits, &b, sizeof( double ) );
+		bits <<= 52;
+		double s;
+		memcpy( &s, &bits, sizeof( double ) );
+		return p * s;
+	};
+
+	/*-------------------------------------------------------------------------------------------------------------------------
+
+		Scalar reference
+
+	--------------------------------------------------------------------------------------------------------------------------*/
+
+	/*! hyperbolic distance between z and w in the Poincare disk, \f$ 2\tanh^{-1}|\frac{z-w}{1-\bar{w}z}| \f$ */
+	double _hyperbolic_distance( Complex z, Complex w );
+	/*! convert the hyperbolic circle (c,r) to the Euclidean circle (C,R) */
+	void   _hyperbolic_circle( Complex c, double r, Complex & C, double & R );
+	/*! the geodesic through p and q
+	 *  \return 1 if it is the arc of the circle (C,R), orthogonal to the unit circle; 0 if it is a diameter
+	 */
+	int    _hyperbolic_geodesic( Complex p, Complex q, Complex & C, double & R );
+
+	/*-------------------------------------------------------------------------------------------------------------------------
+
+		Batched kernels, the arrays may not overlap unless stated
+
+	--------------------------------------------------------------------------------------------------------------------------*/
+
+	/*! distances between (x0,y0)[i] and (x1,y1)[i] */
+	void _hyperbolic_distance( const double * x0, const double * y0, const double * x1, const double * y1, double * d, int n );
+	/*! distances from w to (x,y)[i] */
+	void _hyperbolic_distance( Complex w, const double * x, const double * y, double * d, int n );
+	/*! convert the hyperbolic circles ((cx,cy)[i],r[i]) to the Euclidean circles ((Cx,Cy)[i],R[i]) */
+	void _hyperbolic_circle( const double * cx, const double * cy, const double * r, double * Cx, double * Cy, double * R, int n );
+	/*! geodesics through (px,py)[i] and (qx,qy)[i], type[i] as returned by the scalar version */
+	void _hyperbolic_geodesic( const double * px, const double * py, const double * qx, const double * qy,
+							   double * Cx, double * Cy, double * R, int * type, int n );
+	/*! apply the disk isometry, a Mobius transformation, to all the points in place */
+	inline void _hyperbolic_isometry( CMobius & mob, CComplexArray & z ) { _mobius( mob, z ); };
+};
+
+#endif
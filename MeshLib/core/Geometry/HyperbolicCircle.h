@@ -10,6 +10,8 @@
 #define _MESHLIB_HYPERBOLIC_CIRCLE_H_
 
 #include "circle.h"
+#include "Predicates.h"
+#include "HyperbolicBatch.h"
 
 namespace MeshLib{
 
@@ -30,18 +32,9 @@ class CHyperbolicCircle
 	*/
     CHyperbolicCircle( const CPoint2 & center, const double r ) 
 	{
-		double norm = center[0]*center[0]+center[1]*center[1];
-		double c = (exp(r)-1.0)/(exp(r)+1.0);
-		c = c * c;
-		double a = 1 - c * norm;
-
-		double B = 2.0 * ( c - 1.0) * center[0]/a;
-		double C = 2.0 * ( c - 1.0) * center[1]/a;
-		double D = (norm - c)/a;
-
-		m_c[0] = -B/2.0;
-		m_c[1] = -C/2.0;
-		m_r    = sqrt( B*B/4.0+C*C/4.0-D);
+		Complex C;
+		_hyperbolic_circle( Complex( center[0], center[1] ), r, C, m_r );
+		m_c = CPoint2( C.real(), C.imag() );
 	};	
 	
 	/*!
@@ -78,12 +71,43 @@ class CHyperbolicCircle
 
 
 
+/*!
+ *	The existence of the intersection is decided by _circles_intersect, which is
+ *	exact; the intersection points are then computed in floating point, with the
+ *	half chord clamped at zero for tangent circles.
+ */
 inline int CHyperbolicCircle::intersect(CHyperbolicCircle & circle , CPoint2 & p0, CPoint2 & p1 )
 {
-	CCircle c0( m_c, m_r );
-	CCircle c1( circle.c(), circle.r() );
-	return _circle_circle_intersection( c0, c1, p0, p1);
+	double x0 = m_c[0];
+	double y0 = m_c[1];
+	double r0 = m_r;
+
+	double x1 = circle.c()[0];
+	double y1 = circle.c()[1];
+	double r1 = circle.r();
+
+	if( _circles_intersect( x0, y0, r0, x1, y1, r1 ) == 0 ) return 0;
+
+	double dx = x1 - x0;
+	double dy = y1 - y0;
+	double d  = sqrt( dx * dx + dy * dy );
+	//concentric circles
+	if( d == 0 ) return 0;
+
+	double a  = ( r0 * r0 - r1 * r1 + d * d ) / ( 2.0 * d );
+	double h2 = r0 * r0 - a * a;
+	double h  = ( h2 > 0 ) ? sqrt( h2 ) : 0;
+
+	double x2 = x0 + dx * a / d;
+	double y2 = y0 + dy * a / d;
+
+	double rx = -dy * ( h / d );
+	double ry =  dx * ( h / d );
+
+	p0 = CPoint2( x2 + rx, y2 + ry );
+	p1 = CPoint2( x2 - rx, y2 - ry );
 
+	return 1;
 };
 
 
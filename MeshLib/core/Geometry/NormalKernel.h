@@ -0,0 +1,221 @@
+/*! \file NormalKernel.h
+*   \brief Face normals, face areas, vertex normals and vertex areas of a triangle mesh in one pass
+*
+*   The mesh is copied into structure of arrays, the faces are swept once and the vertex
+*   quantities are gathered from a vertex to face table, so no two threads write the same entry.
+*/
+#ifndef  _NORMAL_KERNEL_H_
+#define  _NORMAL_KERNEL_H_
+
+#include <cmath>
+#include <vector>
+
+#include "Point.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MeshLib
+{
+	/*!	CNormalKernel class
+	 *
+	 *	Geometric derivatives of a triangle mesh given as vertex coordinates x, y, z and the
+	 *	corners of face f at fv[3f], fv[3f+1], fv[3f+2], counterclockwise.
+	 *	-	_topology builds the vertex to face table once per connectivity, in compressed rows:
+	 *		the corners of vertex v are m_corner[ m_offset[v] .. m_offset[v+1] - 1 ], each stored
+	 *		as 3f + j, in increasing face order,
+	 *	-	_compute sweeps the faces once, a branch free loop over the arrays which vectorizes,
+	 *		computing the cross product of each face one time: unit normal, area and the share of
+	 *		the area of each corner, then gathers per vertex the area weighted normal and the area.
+	 *	Both loops run in parallel; every vertex sums its faces in the same order, so the result
+	 *	does not depend on the number of threads.
+	 *
+	 *	The corner areas are either one third of the face area, or the mixed Voronoi areas of
+	 *	Meyer et al.: the Voronoi region of the corner inside a non-obtuse triangle, half the area
+	 *	for an obtuse corner and a quarter for the other two. Degenerate faces get a zero normal
+	 *	and zero areas, isolated vertices a zero normal.
+	 *
+	 *	Usage
+	 *	\code
+	 *		CNormalKernel kernel;
+	 *		kernel.resize( nv, nf );
+	 *		//fill kernel.x(), y(), z() and kernel.corners()
+	 *		kernel._topology();
+	 *		kernel._compute( CNormalKernel::VORONOI );
+	 *		CPoint n = kernel.vertex_normal( 0 );
+	 *	\endcode
+	 */
+	class CNormalKernel
+	{
+	public:
+		enum { BARYCENTRIC, VORONOI };
+
+		CNormalKernel() { m_nv = 0; m_nf = 0; };
+
+		/*! nv vertices and nf faces, the contents are undefined until filled */
+		void resize( int nv, int nf )
+		{
+			m_nv = nv;
+			m_nf = nf;
+			m_x.resize( nv ); m_y.resize( nv ); m_z.resize( nv );
+			m_fv.resize( 3 * nf );
+			m_fnx.resize( nf ); m_fny.resize( nf ); m_fnz.resize( nf );
+			m_farea.resize( nf );
+			m_carea.resize( 3 * nf );
+			m_vnx.resize( nv ); m_vny.resize( nv ); m_vnz.resize( nv );
+			m_varea.resize( nv );
+		};
+		/*! number of vertices */
+		int vertices() { return m_nv; };
+		/*! number of faces */
+		int faces()    { return m_nf; };
+
+		/*! vertex coordinates */
+		double * x() { return m_nv? &m_x[0]: NULL; };
+		double * y() { return m_nv? &m_y[0]: NULL; };
+		double * z() { return m_nv? &m_z[0]: NULL; };
+		/*! set vertex i */
+		void set_point( int i, const CPoint & p ) { m_x[i] = p[0]; m_y[i] = p[1]; m_z[i] = p[2]; };
+		/*! face corners, three vertex indices per face */
+		int * corners() { return m_nf? &m_fv[0]: NULL; };
+
+		/*! build the vertex to face table from the corners */
+		void _topology()
+		{
+			m_offset.assign( m_nv + 1, 0 );
+			m_corner.resize( 3 * m_nf );
+			for( int c = 0; c < 3 * m_nf; c ++ ) m_offset[ m_fv[c] + 1 ] ++;
+			for( int v = 0; v < m_nv; v ++ ) m_offset[v+1] += m_offset[v];
+			//counting sort, the corners are visited in increasing order
+			std::vector<int> next( m_offset.begin(), m_offset.end() - 1 );
+			for( int c = 0; c < 3 * m_nf; c ++ ) m_corner[ next[ m_fv[c] ] ++ ] = c;
+		};
+
+		/*! compute all the quantities, _topology must be called before
+		 *  \param area BARYCENTRIC or VORONOI vertex areas
+		 */
+		void _compute( int area = BARYCENTRIC )
+		{
+			_faces( area == VORONOI );
+			_gather();
+		};
+
+		/*! unit normal of face f */
+		CPoint face_normal( int f )   { return CPoint( m_fnx[f], m_fny[f], m_fnz[f] ); };
+		/*! area of face f */
+		double face_area( int f )     { return m_farea[f]; };
+		/*! area of corner j of face f */
+		double corner_area( int f, int j ) { return m_carea[3*f+j]; };
+		/*! area weighted unit normal of vertex v */
+		CPoint vertex_normal( int v ) { return CPoint( m_vnx[v], m_vny[v], m_vnz[v] ); };
+		/*! area of vertex v, the sum of its corner areas */
+		double vertex_area( int v )   { return m_varea[v]; };
+
+	protected:
+		/*! sweep the faces, one cross product and one square root per face */
+		void _faces( bool voronoi )
+		{
+			const double * x = m_nv? &m_x[0]: NULL;
+			const double * y = m_nv? &m_y[0]: NULL;
+			const double * z = m_nv? &m_z[0]: NULL;
+			const int    * fv = m_nf? &m_fv[0]: NULL;
+			double * nx = m_nf? &m_fnx[0]: NULL;
+			double * ny = m_nf? &m_fny[0]: NULL;
+			double * nz = m_nf? &m_fnz[0]: NULL;
+			double * fa = m_nf? &m_farea[0]: NULL;
+			double * ca = m_nf? &m_carea[0]: NULL;
+			const double w = voronoi? 1.0: 0.0;
+
+#pragma omp parallel for
+			for( int f = 0; f < m_nf; f ++ )
+			{
+				int i = fv[3*f], j = fv[3*f+1], k = fv[3*f+2];
+				//edges opposite to the corners 0, 1, 2
+				double ax = x[k] - x[j], ay = y[k] - y[j], az = z[k] - z[j];
+				double bx = x[i] - x[k], by = y[i] - y[k], bz = z[i] - z[k];
+				double cx = x[j] - x[i], cy = y[j] - y[i], cz = z[j] - z[i];
+
+				//( p1 - p0 ) ^ ( p2 - p0 ) = b ^ c
+				double qx = by * cz - bz * cy;
+				double qy = bz * cx - bx * cz;
+				double qz = bx * cy - by * cx;
+				double len = sqrt( qx * qx + qy * qy + qz * qz );
+				double inv = ( len > 0 )? 1.0 / len: 0.0;
+				double A   = 0.5 * len;
+
+				nx[f] = qx * inv;
+				ny[f] = qy * inv;
+				nz[f] = qz * inv;
+				fa[f] = A;
+
+				//cotangents of the corner angles, dot / |cross|
+				double aa = ax * ax + ay * ay + az * az;
+				double bb = bx * bx + by * by + bz * bz;
+				double cc = cx * cx + cy * cy + cz * cz;
+				double d0 = -( bx * cx + by * cy + bz * cz );
+				double d1 = -( cx * ax + cy * ay + cz * az );
+				double d2 = -( ax * bx + ay * by + az * bz );
+
+				//Voronoi areas of a non-obtuse triangle, 1/8 ( |e|^2 cot ) over the two edges at the corner
+				double v0 = 0.125 * inv * ( cc * d2 + bb * d1 );
+				double v1 = 0.125 * inv * ( aa * d0 + cc * d2 );
+				double v2 = 0.125 * inv * ( bb * d1 + aa * d0 );
+				//obtuse triangles
+				double o0 = ( d0 < 0 )? 0.5 * A: 0.25 * A;
+				double o1 = ( d1 < 0 )? 0.5 * A: 0.25 * A;
+				double o2 = ( d2 < 0 )? 0.5 * A: 0.25 * A;
+				bool obtuse = ( d0 < 0 ) | ( d1 < 0 ) | ( d2 < 0 );
+				v0 = obtuse? o0: v0;
+				v1 = obtuse? o1: v1;
+				v2 = obtuse? o2: v2;
+
+				const double t = A / 3.0;
+				ca[3*f]   = w * v0 + ( 1 - w ) * t;
+				ca[3*f+1] = w * v1 + ( 1 - w ) * t;
+				ca[3*f+2] = w * v2 + ( 1 - w ) * t;
+			}
+		};
+
+		/*! sum the corners of every vertex, each thread owns its vertices */
+		void _gather()
+		{
+#pragma omp parallel for schedule(dynamic,1024)
+			for( int v = 0; v < m_nv; v ++ )
+			{
+				double sx = 0, sy = 0, sz = 0, sa = 0;
+				for( int k = m_offset[v]; k < m_offset[v+1]; k ++ )
+				{
+					int c = m_corner[k];
+					int f = c / 3;
+					double A = m_farea[f];
+					sx += m_fnx[f] * A;
+					sy += m_fny[f] * A;
+					sz += m_fnz[f] * A;
+					sa += m_carea[c];
+				}
+				double len = sqrt( sx * sx + sy * sy + sz * sz );
+				double inv = ( len > 0 )? 1.0 / len: 0.0;
+				m_vnx[v] = sx * inv;
+				m_vny[v] = sy * inv;
+				m_vnz[v] = sz * inv;
+				m_varea[v] = sa;
+			}
+		};
+
+		int m_nv;
+		int m_nf;
+		/*! vertex coordinates */
+		std::vector<double> m_x, m_y, m_z;
+		/*! face corners */
+		std::vector<int>    m_fv;
+		/*! vertex to face table */
+		std::vector<int>    m_offset, m_corner;
+		/*! face normals, face areas and corner areas */
+		std::vector<double> m_fnx, m_fny, m_fnz, m_farea, m_carea;
+		/*! vertex normals and areas */
+		std::vector<double> m_vnx, m_vny, m_vnz, m_varea;
+	};
+};
+
+#endif
@@ -0,0 +1,414 @@
+#include "Octree.h"
+
+using namespace MeshLib;
+
+//spread the lower 21 bits of x, two zero bits between consecutive bits
+static unsigned long long _spread_bits( unsigned long long x )
+{
+	x &= 0x1fffffULL;
+	x = ( x | x << 32 ) & 0x1f00000000ffffULL;
+	x = ( x | x << 16 ) & 0x1f0000ff0000ffULL;
+	x = ( x | x <<  8 ) & 0x100f00f00f00f00fULL;
+	x = ( x | x <<  4 ) & 0x10c30c30c30c30c3ULL;
+	x = ( x | x <<  2 ) & 0x1249249249249249ULL;
+	return x;
+}
+
+//Morton code of cell (x,y,z), the x bit is the most significant one of each level,
+//such that sorted codes follow the i,j,k order of COctreeNode::m_child
+static unsigned long long _morton( int x, int y, int z )
+{
+	return ( _spread_bits( x ) << 2 ) | ( _spread_bits( y ) << 1 ) | _spread_bits( z );
+}
+
+static unsigned long long _compact_bits( unsigned long long x )
+{
+	x &= 0x1249249249249249ULL;
+	x = ( x | x >>  2 ) & 0x10c30c30c30c30c3ULL;
+	x = ( x | x >>  4 ) & 0x100f00f00f00f00fULL;
+	x = ( x | x >>  8 ) & 0x1f0000ff0000ffULL;
+	x = ( x | x >> 16 ) & 0x1f00000000ffffULL;
+	x = ( x | x >> 32 ) & 0x1fffffULL;
+	return x;
+}
+
+//cell index of coordinate t in [-1,1] on a grid of m cells of size h, clamped to the grid
+static int _cell( double t, double h, int m )
+{
+	int i = (int) floor( ( t + 1.0 ) / h );
+	if( i < 0 ) i = 0;
+	if( i > m - 1 ) i = m - 1;
+	return i;
+}
+
+COctree::COctree()
+{
+	m_depth = 0;
+	m_point_items = false;
+}
+
+COctree::~COctree()
+{
+}
+
+void COctree::corner( COctreeNode * pN, CPoint & p, CPoint & q )
+{
+	double h = 2.0 / (double)( 1ULL << pN->m_level );
+	int x = (int) _compact_bits( pN->m_code >> 2 );
+	int y = (int) _compact_bits( pN->m_code >> 1 );
+	int z = (int) _compact_bits( pN->m_code );
+
+	p = CPoint( -1 + x * h, -1 + y * h, -1 + z * h );
+	q = p + CPoint( h, h, h );
+}
+
+void COctree::_construct( std::vector<CPoint> & pts, int n )
+{
+	m_pts = pts;
+	m_point_items = true;
+
+	std::vector<CCellItem> cells;
+	
+	if( n > 0 )
+	{
+		int    m = 1 << n;
+		double h = 2.0 / m;
+
+		for( size_t id = 0; id < m_pts.size(); id ++ )
+		{
+			CPoint p = m_pts[id];
+			bool inside = true;
+			for( int i = 0; i < 3; i ++ )
+			{
+				if( p[i] < -1 || p[i] > 1 ) inside = false;
+			}
+			if( !inside ) continue;
+
+			CCellItem c;
+			c.code = _morton( _cell( p[0], h, m ), _cell( p[1], h, m ), _cell( p[2], h, m ) );
+			c.item = (int) id;
+			cells.push_back( c );
+		}
+		std::sort( cells.begin(), cells.end() );
+	}
+
+	_build( cells, n );
+}
+
+void COctree::_construct( int n )
+{
+	m_point_items = false;
+
+	std::vector<CCellItem> cells;
+	if( n >= 0 )
+		_bin_triangles( n, cells );
+
+	_build( cells, n );
+}
+
+//each chunk bins a contiguous range of triangles: the leaf cells overlapped by the
+//triangle bounding box are culled against the triangle plane, and only the remaining
+//cells go through the exact triangle cube test. The per chunk lists are sorted in
+//parallel and merged, the result is independent of the number of threads.
+void COctree::_bin_triangles( int n, std::vector<CCellItem> & cells )
+{
+	int    m   = 1 << n;
+	double h   = 2.0 / m;
+	//tolerance of CTriangleCubeIntersect, in units of the cell size
+	double tol = 2 * EPS;
+
+	int nt = 1;
+#ifdef _OPENMP
+	nt = omp_get_max_threads();
+#endif
+	std::vector< std::vector<CCellItem> > local( nt );
+
+	int num = (int) m_trs.size();
+
+#pragma omp parallel for schedule( static, 1 )
+	for( int tid = 0; tid < nt; tid ++ )
+	{
+		std::vector<CCellItem> & out = local[tid];
+		CTriangleCubeIntersect TC;
+
+		int chunk = ( num + nt - 1 ) / nt;
+		int begin = std::min( num, tid * chunk );
+		int end   = std::min( num, begin + chunk );
+
+		for( int id = begin; id < end; id ++ )
+		{
+			CTriangle & T = m_trs[id];
+
+			CPoint lo = T.v[0];
+			CPoint hi = T.v[0];
+			for( int k = 1; k < 3; k ++ )
+			for( int i = 0; i < 3; i ++ )
+			{
+				lo[i] = std::min( lo[i], T.v[k][i] );
+				hi[i] = std::max( hi[i], T.v[k][i] );
+			}
+
+			bool outside = false;
+			for( int i = 0; i < 3; i ++ )
+			{
+				if( hi[i] < -1 - tol * 2 || lo[i] > 1 + tol * 2 ) outside = true;
+			}
+			if( outside ) continue;
+
+			int b[3], e[3];
+			for( int i = 0; i < 3; i ++ )
+			{
+				b[i] = _cell( lo[i] - tol * h, h, m );
+				e[i] = _cell( hi[i] + tol * h, h, m );
+			}
+
+			CPoint nr = ( T.v[1] - T.v[0] ) ^ ( T.v[2] - T.v[0] );
+			double radius = ( fabs( nr[0] ) + fabs( nr[1] ) + fabs( nr[2] ) ) * h / 2.0 * ( 1 + 4 * tol );
+			bool   single = ( b[0] == e[0] && b[1] == e[1] && b[2] == e[2] );
+
+			for( int x = b[0]; x <= e[0]; x ++ )
+			for( int y = b[1]; y <= e[1]; y ++ )
+			for( int z = b[2]; z <= e[2]; z ++ )
+			{
+				CPoint center( -1 + ( x + 0.5 ) * h, -1 + ( y + 0.5 ) * h, -1 + ( z + 0.5 ) * h );
+
+				if( !single && fabs( nr * ( center - T.v[0] ) ) > radius ) continue;
+
+				CPoint a = ( T.v[0] - center ) / h;
+				CPoint c = ( T.v[1] - center ) / h;
+				CPoint d = ( T.v[2] - center ) / h;
+
+				if( TC.test( a, c, d ) == INSIDE )
+				{
+					CCellItem ci;
+					ci.code = _morton( x, y, z );
+					ci.item = id;
+					out.push_back( ci );
+				}
+			}
+		}
+
+		std::sort( out.begin(), out.end() );
+	}
+
+	size_t total = 0;
+	for( int t = 0; t < nt; t ++ ) total += local[t].size();
+	cells.reserve( total );
+
+	for( int t = 0; t < nt; t ++ )
+	{
+		size_t mid = cells.size();
+		cells.insert( cells.end(), local[t].begin(), local[t].end() );
+		std::inplace_merge( cells.begin(), cells.begin() + mid, cells.end() );
+		std::vector<CCellItem>().swap( local[t] );
+	}
+}
+
+//leaves are the runs of equal codes of the sorted cells; the codes of level l are the
+//distinct codes of level l+1 shifted by 3 bits. The pool stores the levels one after
+//the other, each level in Morton order, so the children of a node are contiguous.
+void COctree::_build( std::vector<CCellItem> & cells, int n )
+{
+	m_nodes.clear();
+	m_items.clear();
+	m_depth = n;
+
+	if( cells.empty() ) return;
+
+	std::vector< std::vector<unsigned long long> > codes( n + 1 );
+	std::vector<int> offset;
+
+	m_items.resize( cells.size() );
+	for( size_t i = 0; i < cells.size(); i ++ )
+	{
+		m_items[i] = cells[i].item;
+		if( i == 0 || cells[i].code != cells[i-1].code )
+		{
+			codes[n].push_back( cells[i].code );
+			offset.push_back( (int) i );
+		}
+	}
+	offset.push_back( (int) cells.size() );
+
+	for( int l = n - 1; l >= 0; l -- )
+	{
+		std::vector<unsigned long long> & child = codes[l+1];
+		for( size_t i = 0; i < child.size(); i ++ )
+		{
+			unsigned long long c = child[i] >> 3;
+			if( codes[l].empty() || codes[l].back() != c )
+				codes[l].push_back( c );
+		}
+	}
+
+	std::vector<int> base( n + 2, 0 );
+	for( int l = 0; l <= n; l ++ )
+		base[l+1] = base[l] + (int) codes[l].size();
+
+	m_nodes.resize( base[n+1] );
+
+	for( int l = 0; l <= n; l ++ )
+	{
+		int num = (int) codes[l].size();
+#pragma omp parallel for
+		for( int i = 0; i < num; i ++ )
+		{
+			COctreeNode & N = m_nodes[ base[l] + i ];
+			N.m_code  = codes[l][i];
+			N.m_level = l;
+			if( l == n )
+			{
+				N.m_begin = offset[i];
+				N.m_end   = offset[i+1];
+			}
+		}
+	}
+
+	for( int l = 1; l <= n; l ++ )
+	{
+		int p = 0;
+		for( size_t i = 0; i < codes[l].size(); i ++ )
+		{
+			unsigned long long c = codes[l][i];
+			while( codes[l-1][p] != ( c >> 3 ) ) p ++;
+
+			int oct = (int)( c & 7 );
+			m_nodes[ base[l-1] + p ].m_child[ (oct>>2)&1 ][ (oct>>1)&1 ][ oct&1 ] = base[l] + (int) i;
+		}
+	}
+}
+
+void COctree::_insert_triangle( CPoint a, CPoint b, CPoint c )
+{
+	CTriangle T;
+	T.v[0] = a;
+	T.v[1] = b;
+	T.v[2] = c;
+
+	m_trs.push_back( T );
+}
+
+void COctree::_insert_triangle( const CTriangle & tri )
+{
+	m_trs.push_back( tri );
+}
+
+CPoint COctree::_jitter( COctreeNode * pN )
+{
+	CPoint rd;	
+	for (int i =0; i<3;++i)
+	{
+		rd[i] =((double) rand() / ((double) RAND_MAX + 1)) * 2 - 1.0;
+	}
+	
+	CPoint p, q;
+	corner( pN, p, q );
+	double len = q[0] - p[0];
+	//ditter
+	return (p + q)/2.0 + rd * len/4.0;
+}
+
+//one jittered sample per non-empty leaf, the leaves are visited in Morton order,
+//which is the depth first order of the pointer based tree
+void COctree::_sample( std::vector<CPoint> & samples )
+{
+	srand((unsigned)time(NULL));
+	if( m_point_items ) return;
+
+	for( size_t i = 0; i < m_nodes.size(); i ++ )
+	{
+		COctreeNode * pN = &m_nodes[i];
+		if( !pN->leaf() ) continue;
+
+		CPoint p = _jitter( pN );
+
+		for( int k = pN->m_begin; k < pN->m_end; k ++ )
+		{
+			CTriangle & T = m_trs[ m_items[k] ];
+			CPoint q;
+			if( T._project( p, q ) ) 
+			{
+				samples.push_back( q );
+				break;
+			}
+		}
+	}
+};
+
+void COctree::_sample( std::vector<CSample> & samples )
+{
+	srand((unsigned)time(NULL));
+	if( m_point_items ) return;
+
+	for( size_t i = 0; i < m_nodes.size(); i ++ )
+	{
+		COctreeNode * pN = &m_nodes[i];
+		if( !pN->leaf() ) continue;
+
+		CPoint p = _jitter( pN );
+
+		for( int k = pN->m_begin; k < pN->m_end; k ++ )
+		{
+			CTriangle & T = m_trs[ m_items[k] ];
+			CSample  q;
+			if( T._project( p, q ) ) 
+			{
+				samples.push_back( q );
+				break;
+			}
+		}
+	}
+};
+
+
+bool CTriangle::_project( CPoint &in, CPoint &out )
+{
+	CPoint n = (v[1] - v[0])^(v[2]-v[0]);
+	double d = n.norm();
+	if( d < 1e-8 ) return false;
+	n = n/d;
+
+	double t = (v[0] - in ) * n;
+
+	out = in + n * t;
+	
+	CPoint bary;
+
+	for( int i = 0; i < 3; i ++ )
+	{
+		CPoint l = v[(i+0)%3] - out;
+		CPoint r = v[(i+1)%3] - out;
+		bary[i] = (l^r) * n;
+	}
+
+	return (bary[0]>=0 && bary[1] >= 0 && bary[2] >= 0 );
+};
+
+
+bool CTriangle::_project( CPoint &in, CSample & sample )
+{
+	CPoint n = (v[1] - v[0])^(v[2]-v[0]);
+	double d = n.norm();
+	if( d < 1e-8 ) return false;
+
+	n = n/d;
+
+	double t = (v[0] - in ) * n;
+
+	CPoint out = in + n * t;
+	
+	CPoint bary;
+
+	for( int i = 0; i < 3; i ++ )
+	{
+		CPoint l = v[(i+1)%3] - out;
+		CPoint r = v[(i+2)%3] - out;
+		bary[i] = (l^r) * n/d;
+	}
+	
+	sample.point() = out;
+	sample.uv()    = uv[0] * bary[0] + uv[1] * bary[1] + uv[2] * bary[2];
+	sample.rgb()   = rgb[0] * bary[0] + rgb[1] * bary[1] + rgb[2] * bary[2];
+
+	return (bary[0]>=0 && bary[1] >= 0 && bary[2] >= 0 );
+};
\ No newline at end of file
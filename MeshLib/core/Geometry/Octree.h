@@ -0,0 +1,169 @@
+/*! \file Octree.h
+*   \brief Octree
+*   \author David Gu
+*   \date   documented on 02/11/2011
+*
+*   Mesh for viewer 
+*/
+#ifndef  _OCTREE_H_
+#define  _OCTREE_H_
+
+#include <map>
+#include <vector>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+
+#include "Mesh/Vertex.h"
+#include "Mesh/Edge.h"
+#include "Mesh/Face.h"
+#include "Mesh/HalfEdge.h"
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Parser/parser.h"
+#include "TriangleCubeIntersect.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MeshLib
+{
+	class CSample
+	{
+	public:
+		CPoint  & point() { return m_point; };
+		CPoint2 & uv()    { return m_uv;    };
+		CPoint  & rgb()   { return m_rgb;   };
+	protected:
+		CPoint  m_point;
+		CPoint2 m_uv;
+		CPoint  m_rgb;
+	};
+
+	class CTriangle
+	{
+	public:
+		CTriangle() {};
+		CTriangle( const CTriangle & tri )
+		{
+			for( int i = 0; i < 3; i ++ )
+			{
+				v[i] = tri.v[i]; uv[i] = tri.uv[i]; rgb[i] = tri.rgb[i];
+			}
+		}
+		~CTriangle(){};
+	public:
+		CPoint    v[3];
+		CPoint2  uv[3];
+		CPoint  rgb[3];
+		//project point in, the output is out, 
+		//if the projection is out of the triangle
+		// return false; else retun true
+		bool _project( CPoint & in, CPoint & out  );
+		bool _project( CPoint & in, CSample & out );
+	};
+
+	/*!	COctreeNode class
+	 *
+	 *	Node of the linear octree. Nodes live in one flat pool owned by COctree,
+	 *	children are pool indices, and the node cell is given by its Morton code
+	 *	at its level. Only leaves own items, as the range [m_begin,m_end) of the
+	 *	compact leaf index list.
+	 */
+	class COctreeNode
+	{
+	public:
+		COctreeNode()
+		{
+			m_code  = 0;
+			m_level = 0;
+			m_begin = 0;
+			m_end   = 0;
+			for( int i = 0; i < 2; i ++ )
+			for( int j = 0; j < 2; j ++ )
+			for( int k = 0; k < 2; k ++ )
+			{
+				m_child[i][j][k] = -1;
+			}
+		};
+		/*! whether the node is a leaf */
+		bool leaf() { return m_begin < m_end; };
+
+	public:
+		/*! Morton code of the cell, 3 bits per level, x bit most significant */
+		unsigned long long m_code;
+		/*! depth of the node, the root is at level 0 */
+		int m_level;
+		/*! pool indices of the children, -1 for empty children */
+		int m_child[2][2][2];
+		/*! range of the node items in the leaf index list */
+		int m_begin;
+		int m_end;
+	};
+
+	/*!	COctree class
+	 *
+	 *	Linear octree over the cube [-1,1]^3. Items are binned directly into the
+	 *	cells of the finest level through their bounding boxes, the exact
+	 *	triangle cube test is only performed on those leaf cells, and the
+	 *	internal nodes are rebuilt from the sorted leaf Morton codes.
+	 */
+	class COctree
+	{
+	public:
+		COctree();
+		~COctree();
+		/*! root node, NULL if the tree is empty */
+		COctreeNode * root() { return m_nodes.empty() ? NULL : &m_nodes[0]; };
+		/*! node pool */
+		std::vector<COctreeNode> & nodes() { return m_nodes; };
+		/*! compact leaf index list, into points or triangles */
+		std::vector<int> & leaf_items() { return m_items; };
+		/*! inserted triangles */
+		std::vector<CTriangle> & triangles() { return m_trs; };
+		/*! cell of a node */
+		void corner( COctreeNode * pN, CPoint & p, CPoint & q );
+
+		void _construct( std::vector<CPoint> & pts, int n );
+		void _construct( int n );
+		void _insert_triangle( CPoint a, CPoint b, CPoint c );
+		void _insert_triangle( const CTriangle & tri );
+		void _sample( std::vector<CPoint> & samples );
+		void _sample( std::vector<CSample> & samples );
+
+	protected:
+		/*! (Morton code, item) pair of a leaf cell */
+		struct CCellItem
+		{
+			unsigned long long code;
+			int item;
+			bool operator<( const CCellItem & other ) const
+			{
+				return code < other.code || ( code == other.code && item < other.item );
+			};
+		};
+		/*! bin the triangles into the leaf cells of level n */
+		void _bin_triangles( int n, std::vector<CCellItem> & cells );
+		/*! build the node pool from the sorted leaf cells */
+		void _build( std::vector<CCellItem> & cells, int n );
+		/*! jittered point in a leaf cell */
+		CPoint _jitter( COctreeNode * pN );
+
+		std::vector<COctreeNode> m_nodes;
+		std::vector<int>         m_items;
+		std::vector<CTriangle>   m_trs;
+		std::vector<CPoint>      m_pts;
+		/*! depth of the leaves */
+		int  m_depth;
+		/*! whether the leaf items index m_pts instead of m_trs */
+		bool m_point_items;
+	};
+};
+
+#endif
\ No newline at end of file
@@ -209,7 +209,7 @@ inline CPoint2 operator/(  const CPoint2 & uv0, const double s )
  *  \param uv input two dimensional point
  *  \return square of the norm of the point
  */
-inline double mag2(  CPoint2 & uv )
+inline double mag2(  const CPoint2 & uv )
 {
 	return uv[0] * uv[0] + uv[1] * uv[1];
 };
@@ -219,7 +219,7 @@ inline double mag2(  CPoint2 & uv )
  *  \param uv input two dimensional point
  *  \return norm of the point
  */
-inline double mag(  CPoint2 & uv )
+inline double mag(  const CPoint2 & uv )
 {
 	return sqrt(uv[0] * uv[0] + uv[1] * uv[1]);
 };
@@ -0,0 +1,402 @@
+#include <limits>
+#include "Predicates.h"
+
+using namespace MeshLib;
+
+//unit roundoff and splitter of the double format
+static const double s_epsilon  = std::numeric_limits<double>::epsilon() / 2.0;
+static const double s_splitter = 134217729.0;
+
+//error bounds of the filters, relative to the permanents
+static const double s_o3d_bound = ( 12.0 + 128.0 * s_epsilon ) * s_epsilon;
+static const double s_o4d_bound = ( 32.0 + 512.0 * s_epsilon ) * s_epsilon;
+static const double s_cc_bound  = (  8.0 +  64.0 * s_epsilon ) * s_epsilon;
+
+/*-------------------------------------------------------------------------------------------
+
+	error free transformations
+
+--------------------------------------------------------------------------------------------*/
+
+static inline void _two_sum( double a, double b, double & x, double & y )
+{
+	x = a + b;
+	double bv = x - a;
+	double av = x - bv;
+	y = ( a - av ) + ( b - bv );
+}
+
+static inline void _fast_two_sum( double a, double b, double & x, double & y )
+{
+	x = a + b;
+	y = b - ( x - a );
+}
+
+static inline void _split( double a, double & hi, double & lo )
+{
+	double c = s_splitter * a;
+	double big = c - a;
+	hi = c - big;
+	lo = a - hi;
+}
+
+static inline void _two_product( double a, double b, double & x, double & y )
+{
+	x = a * b;
+	double ahi, alo, bhi, blo;
+	_split( a, ahi, alo );
+	_split( b, bhi, blo );
+	double err1 = x - ahi * bhi;
+	double err2 = err1 - alo * bhi;
+	double err3 = err2 - ahi * blo;
+	y = alo * blo - err3;
+}
+
+//add b to the expansion e, eliminating zero components
+static void _grow( const std::vector<double> & e, double b, std::vector<double> & h )
+{
+	h.clear();
+	double q = b;
+	for( size_t i = 0; i < e.size(); i ++ )
+	{
+		double x, y;
+		_two_sum( q, e[i], x, y );
+		if( y != 0 ) h.push_back( y );
+		q = x;
+	}
+	if( q != 0 ) h.push_back( q );
+}
+
+/*-------------------------------------------------------------------------------------------
+
+	CExpansion
+
+--------------------------------------------------------------------------------------------*/
+
+CExpansion CExpansion::diff( double a, double b )
+{
+	CExpansion e;
+	double x, y;
+	_two_sum( a, -b, x, y );
+	if( y != 0 ) e.m_c.push_back( y );
+	if( x != 0 ) e.m_c.push_back( x );
+	return e;
+}
+
+CExpansion CExpansion::product( double a, double b )
+{
+	CExpansion e;
+	double x, y;
+	_two_product( a, b, x, y );
+	if( y != 0 ) e.m_c.push_back( y );
+	if( x != 0 ) e.m_c.push_back( x );
+	return e;
+}
+
+CExpansion CExpansion::operator+( const CExpansion & e ) const
+{
+	CExpansion h( *this );
+	std::vector<double> t;
+	for( size_t i = 0; i < e.m_c.size(); i ++ )
+	{
+		_grow( h.m_c, e.m_c[i], t );
+		h.m_c.swap( t );
+	}
+	return h;
+}
+
+CExpansion CExpansion::operator-() const
+{
+	CExpansion h( *this );
+	for( size_t i = 0; i < h.m_c.size(); i ++ ) h.m_c[i] = -h.m_c[i];
+	return h;
+}
+
+CExpansion CExpansion::operator-( const CExpansion & e ) const
+{
+	return (*this) + ( -e );
+}
+
+//scale expansion with zero elimination
+CExpansion CExpansion::operator*( double b ) const
+{
+	CExpansion h;
+	if( m_c.empty() || b == 0 ) return h;
+
+	double q, hh;
+	_two_product( m_c[0], b, q, hh );
+	if( hh != 0 ) h.m_c.push_back( hh );
+
+	for( size_t i = 1; i < m_c.size(); i ++ )
+	{
+		double p1, p0, sum;
+		_two_product( m_c[i], b, p1, p0 );
+		_two_sum( q, p0, sum, hh );
+		if( hh != 0 ) h.m_c.push_back( hh );
+		_fast_two_sum( p1, sum, q, hh );
+		if( hh != 0 ) h.m_c.push_back( hh );
+	}
+	if( q != 0 ) h.m_c.push_back( q );
+	return h;
+}
+
+CExpansion CExpansion::operator*( const CExpansion & e ) const
+{
+	CExpansion h;
+	for( size_t i = 0; i < e.m_c.size(); i ++ )
+	{
+		h = h + (*this) * e.m_c[i];
+	}
+	return h;
+}
+
+double CExpansion::estimate() const
+{
+	double s = 0;
+	for( size_t i = 0; i < m_c.size(); i ++ ) s += m_c[i];
+	return s;
+}
+
+/*-------------------------------------------------------------------------------------------
+
+	exact determinants of differences
+
+--------------------------------------------------------------------------------------------*/
+
+static CExpansion _det3( CExpansion m[3][3] )
+{
+	return m[0][0] * ( m[1][1] * m[2][2] - m[1][2] * m[2][1] )
+		 - m[0][1] * ( m[1][0] * m[2][2] - m[1][2] * m[2][0] )
+		 + m[0][2] * ( m[1][0] * m[2][1] - m[1][1] * m[2][0] );
+}
+
+static CExpansion _det4( CExpansion m[4][4] )
+{
+	CExpansion det;
+	for( int j = 0; j < 4; j ++ )
+	{
+		CExpansion minor[3][3];
+		for( int r = 1; r < 4; r ++ )
+		{
+			int c = 0;
+			for( int k = 0; k < 4; k ++ )
+			{
+				if( k == j ) continue;
+				minor[r-1][c++] = m[r][k];
+			}
+		}
+		CExpansion t = m[0][j] * _det3( minor );
+		det = ( j % 2 ) ? det - t : det + t;
+	}
+	return det;
+}
+
+/*-------------------------------------------------------------------------------------------
+
+	filtered predicates
+
+--------------------------------------------------------------------------------------------*/
+
+double MeshLib::_orient3d( const double * p0, const double * p1, const double * p2, const double * p3 )
+{
+	const double * p[3] = { p1, p2, p3 };
+	double m[3][3];
+	for( int i = 0; i < 3; i ++ )
+	for( int j = 0; j < 3; j ++ )
+		m[i][j] = p[i][j] - p0[j];
+
+	double c0 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+	double c1 = m[1][0] * m[2][2] - m[1][2] * m[2][0];
+	double c2 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+	double det = m[0][0] * c0 - m[0][1] * c1 + m[0][2] * c2;
+
+	double a0 = fabs( m[1][1] * m[2][2] ) + fabs( m[1][2] * m[2][1] );
+	double a1 = fabs( m[1][0] * m[2][2] ) + fabs( m[1][2] * m[2][0] );
+	double a2 = fabs( m[1][0] * m[2][1] ) + fabs( m[1][1] * m[2][0] );
+	double permanent = fabs( m[0][0] ) * a0 + fabs( m[0][1] ) * a1 + fabs( m[0][2] ) * a2;
+
+	if( fabs( det ) > s_o3d_bound * permanent ) return det;
+
+	CExpansion e[3][3];
+	for( int i = 0; i < 3; i ++ )
+	for( int j = 0; j < 3; j ++ )
+		e[i][j] = CExpansion::diff( p[i][j], p0[j] );
+
+	return _det3( e ).estimate();
+}
+
+double MeshLib::_orient4d( const double * p0, const double * p1, const double * p2, const double * p3, const double * p4 )
+{
+	const double * p[4] = { p1, p2, p3, p4 };
+	double m[4][4];
+	for( int i = 0; i < 4; i ++ )
+	for( int j = 0; j < 4; j ++ )
+		m[i][j] = p[i][j] - p0[j];
+
+	//2x2 minors of the last two rows, and their permanents
+	double s[4][4], t[4][4];
+	for( int j = 0; j < 4; j ++ )
+	for( int k = j + 1; k < 4; k ++ )
+	{
+		s[j][k] = m[2][j] * m[3][k] - m[2][k] * m[3][j];
+		t[j][k] = fabs( m[2][j] * m[3][k] ) + fabs( m[2][k] * m[3][j] );
+	}
+
+	//3x3 minors of the last three rows, column j removed
+	double c[4], a[4];
+	c[0] = m[1][1] * s[2][3] - m[1][2] * s[1][3] + m[1][3] * s[1][2];
+	c[1] = m[1][0] * s[2][3] - m[1][2] * s[0][3] + m[1][3] * s[0][2];
+	c[2] = m[1][0] * s[1][3] - m[1][1] * s[0][3] + m[1][3] * s[0][1];
+	c[3] = m[1][0] * s[1][2] - m[1][1] * s[0][2] + m[1][2] * s[0][1];
+	a[0] = fabs( m[1][1] ) * t[2][3] + fabs( m[1][2] ) * t[1][3] + fabs( m[1][3] ) * t[1][2];
+	a[1] = fabs( m[1][0] ) * t[2][3] + fabs( m[1][2] ) * t[0][3] + fabs( m[1][3] ) * t[0][2];
+	a[2] = fabs( m[1][0] ) * t[1][3] + fabs( m[1][1] ) * t[0][3] + fabs( m[1][3] ) * t[0][1];
+	a[3] = fabs( m[1][0] ) * t[1][2] + fabs( m[1][1] ) * t[0][2] + fabs( m[1][2] ) * t[0][1];
+
+	double det = m[0][0] * c[0] - m[0][1] * c[1] + m[0][2] * c[2] - m[0][3] * c[3];
+	double permanent = fabs( m[0][0] ) * a[0] + fabs( m[0][1] ) * a[1] + fabs( m[0][2] ) * a[2] + fabs( m[0][3] ) * a[3];
+
+	if( fabs( det ) > s_o4d_bound * permanent ) return det;
+
+	CExpansion e[4][4];
+	for( int i = 0; i < 4; i ++ )
+	for( int j = 0; j < 4; j ++ )
+		e[i][j] = CExpansion::diff( p[i][j], p0[j] );
+
+	return _det4( e ).estimate();
+}
+
+int MeshLib::_circles_intersect( double x0, double y0, double r0, double x1, double y1, double r1 )
+{
+	double dx = x1 - x0;
+	double dy = y1 - y0;
+	double d2 = dx * dx + dy * dy;
+	double sp = r0 + r1;
+	double sm = r0 - r1;
+
+	double outer = sp * sp - d2;
+	double inner = d2 - sm * sm;
+	double bound = s_cc_bound * ( sp * sp + d2 + sm * sm );
+
+	int so, si;
+	if( fabs( outer ) > bound && fabs( inner ) > bound )
+	{
+		so = outer > 0 ? 1 : -1;
+		si = inner > 0 ? 1 : -1;
+	}
+	else
+	{
+		CExpansion ex = CExpansion::diff( x1, x0 );
+		CExpansion ey = CExpansion::diff( y1, y0 );
+		CExpansion ed = ex * ex + ey * ey;
+		CExpansion ep = CExpansion( r0 ) + CExpansion( r1 );
+		CExpansion em = CExpansion::diff( r0, r1 );
+		so = ( ep * ep - ed ).sign();
+		si = ( ed - em * em ).sign();
+	}
+
+	if( so < 0 || si < 0 ) return 0;
+	if( so == 0 || si == 0 ) return 1;
+	return 2;
+}
+
+/*-------------------------------------------------------------------------------------------
+
+	CPlaneBatch
+
+--------------------------------------------------------------------------------------------*/
+
+void CPlaneBatch::clear()
+{
+	for( int j = 0; j < 4; j ++ )
+	{
+		m_a[j].clear(); m_n[j].clear(); m_m[j].clear();
+	}
+	for( int j = 0; j < 16; j ++ ) m_v[j].clear();
+}
+
+//n_j is the cofactor of the first row of det[ p-a, b-a, c-a, d-a ] at column j
+void CPlaneBatch::add( const double * a, const double * b, const double * c, const double * d )
+{
+	const double * v[4] = { a, b, c, d };
+	for( int i = 0; i < 4; i ++ )
+	for( int j = 0; j < 4; j ++ )
+		m_v[ i * 4 + j ].push_back( v[i][j] );
+
+	double m[3][4];
+	for( int j = 0; j < 4; j ++ )
+	{
+		m[0][j] = b[j] - a[j];
+		m[1][j] = c[j] - a[j];
+		m[2][j] = d[j] - a[j];
+	}
+
+	double s[4][4], t[4][4];
+	for( int j = 0; j < 4; j ++ )
+	for( int k = j + 1; k < 4; k ++ )
+	{
+		s[j][k] = m[1][j] * m[2][k] - m[1][k] * m[2][j];
+		t[j][k] = fabs( m[1][j] * m[2][k] ) + fabs( m[1][k] * m[2][j] );
+	}
+
+	double n[4], p[4];
+	n[0] =  ( m[0][1] * s[2][3] - m[0][2] * s[1][3] + m[0][3] * s[1][2] );
+	n[1] = -( m[0][0] * s[2][3] - m[0][2] * s[0][3] + m[0][3] * s[0][2] );
+	n[2] =  ( m[0][0] * s[1][3] - m[0][1] * s[0][3] + m[0][3] * s[0][1] );
+	n[3] = -( m[0][0] * s[1][2] - m[0][1] * s[0][2] + m[0][2] * s[0][1] );
+	p[0] = fabs( m[0][1] ) * t[2][3] + fabs( m[0][2] ) * t[1][3] + fabs( m[0][3] ) * t[1][2];
+	p[1] = fabs( m[0][0] ) * t[2][3] + fabs( m[0][2] ) * t[0][3] + fabs( m[0][3] ) * t[0][2];
+	p[2] = fabs( m[0][0] ) * t[1][3] + fabs( m[0][1] ) * t[0][3] + fabs( m[0][3] ) * t[0][1];
+	p[3] = fabs( m[0][0] ) * t[1][2] + fabs( m[0][1] ) * t[0][2] + fabs( m[0][2] ) * t[0][1];
+
+	for( int j = 0; j < 4; j ++ )
+	{
+		m_a[j].push_back( a[j] );
+		m_n[j].push_back( n[j] );
+		m_m[j].push_back( p[j] );
+	}
+}
+
+//the filter loop is branch free over contiguous arrays, so that it vectorizes;
+//a zero sign marks the tets left to the exact fallback
+void CPlaneBatch::orient( const double * p, std::vector<int> & signs )
+{
+	int num = size();
+	signs.resize( num );
+	if( num == 0 ) return;
+
+	const double * a0 = &m_a[0][0], * a1 = &m_a[1][0], * a2 = &m_a[2][0], * a3 = &m_a[3][0];
+	const double * n0 = &m_n[0][0], * n1 = &m_n[1][0], * n2 = &m_n[2][0], * n3 = &m_n[3][0];
+	const double * m0 = &m_m[0][0], * m1 = &m_m[1][0], * m2 = &m_m[2][0], * m3 = &m_m[3][0];
+	int * sg = &signs[0];
+
+	const double px = p[0], py = p[1], pz = p[2], pw = p[3];
+
+	for( int i = 0; i < num; i ++ )
+	{
+		double q0 = px - a0[i];
+		double q1 = py - a1[i];
+		double q2 = pz - a2[i];
+		double q3 = pw - a3[i];
+
+		double v = q0 * n0[i] + q1 * n1[i] + q2 * n2[i] + q3 * n3[i];
+		double e = fabs( q0 ) * m0[i] + fabs( q1 ) * m1[i] + fabs( q2 ) * m2[i] + fabs( q3 ) * m3[i];
+		e *= s_o4d_bound;
+
+		//volume of (p,a,b,c,d) is -v
+		sg[i] = ( v < -e ) - ( v > e );
+	}
+
+	for( int i = 0; i < num; i ++ )
+	{
+		if( sg[i] != 0 ) continue;
+
+		double v[4][4];
+		for( int k = 0; k < 4; k ++ )
+		for( int j = 0; j < 4; j ++ )
+			v[k][j] = m_v[ k * 4 + j ][i];
+
+		double vol = _orient4d( p, v[0], v[1], v[2], v[3] );
+		sg[i] = ( vol > 0 ) - ( vol < 0 );
+	}
+}
@@ -0,0 +1,101 @@
+/*! \file Predicates.h
+*   \brief Robust geometric predicates
+*
+*   Orientation tests with a floating point filter and an exact fallback
+*/
+#ifndef  _PREDICATES_H_
+#define  _PREDICATES_H_
+
+#include <vector>
+#include <cmath>
+
+namespace MeshLib
+{
+	/*!	CExpansion class
+	 *
+	 *	Exact floating point expansion: the value is the sum of nonoverlapping
+	 *	components stored in increasing magnitude, following J. R. Shewchuk,
+	 *	Adaptive precision floating-point arithmetic and fast robust geometric
+	 *	predicates, 1997. Only used when a filter is inconclusive.
+	 */
+	class CExpansion
+	{
+	public:
+		CExpansion() {};
+		CExpansion( double a ) { if( a != 0 ) m_c.push_back( a ); };
+		~CExpansion() {};
+
+		/*! exact a - b */
+		static CExpansion diff( double a, double b );
+		/*! exact a * b */
+		static CExpansion product( double a, double b );
+
+		CExpansion operator+( const CExpansion & e ) const;
+		CExpansion operator-( const CExpansion & e ) const;
+		CExpansion operator*( const CExpansion & e ) const;
+		CExpansion operator*( double b ) const;
+		CExpansion operator-() const;
+
+		/*! sign of the exact value, -1, 0 or +1 */
+		int    sign()     const { return m_c.empty() ? 0 : ( m_c.back() > 0 ? 1 : -1 ); };
+		/*! double approximation of the exact value */
+		double estimate() const;
+
+	protected:
+		std::vector<double> m_c;
+	};
+
+	/*!
+	 *	Oriented volume det[ p1-p0, p2-p0, p3-p0 ] of four points in R3. The
+	 *	sign is always exact, the magnitude is the floating point value unless
+	 *	the filter fails, then it is the rounded exact value.
+	 */
+	double _orient3d( const double * p0, const double * p1, const double * p2, const double * p3 );
+
+	/*!
+	 *	Oriented volume det[ p1-p0, p2-p0, p3-p0, p4-p0 ] of five points in R4,
+	 *	with an exact sign as _orient3d.
+	 */
+	double _orient4d( const double * p0, const double * p1, const double * p2, const double * p3, const double * p4 );
+
+	/*!
+	 *	Number of intersection points of the circles (x0,y0,r0) and (x1,y1,r1):
+	 *	0 if they are disjoint or nested, 1 if tangent, 2 otherwise. Decided on
+	 *	the signs of (r0+r1)^2 - d^2 and d^2 - (r0-r1)^2, d the center distance.
+	 */
+	int _circles_intersect( double x0, double y0, double r0, double x1, double y1, double r1 );
+
+	/*!	CPlaneBatch class
+	 *
+	 *	Tetrahedra in R4 stored as hyperplanes, structure of arrays, for testing
+	 *	one point against many of them. For a tet (a,b,c,d) the value of p is
+	 *	det[ p-a, b-a, c-a, d-a ] = n.(p-a), and its rounding error is bounded by
+	 *	a multiple of |p-a|.m, where m holds the permanents of the minors.
+	 */
+	class CPlaneBatch
+	{
+	public:
+		CPlaneBatch() {};
+		~CPlaneBatch() {};
+		/*! remove all the tets */
+		void clear();
+		/*! add the tet (a,b,c,d) */
+		void add( const double * a, const double * b, const double * c, const double * d );
+		/*! number of tets */
+		int  size() { return (int) m_a[0].size(); };
+		/*!
+		 *	Signs of the volumes det[ a-p, b-p, c-p, d-p ] of all the tets, which is
+		 *	the orientation of the simplex (p,a,b,c,d). The filter runs over all the
+		 *	tets in one loop, the tets it cannot decide fall back to _orient4d.
+		 */
+		void orient( const double * p, std::vector<int> & signs );
+
+	protected:
+		std::vector<double> m_a[4];
+		std::vector<double> m_n[4];
+		std::vector<double> m_m[4];
+		std::vector<double> m_v[16];
+	};
+};
+
+#endif
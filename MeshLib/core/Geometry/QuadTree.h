@@ -0,0 +1,351 @@
+/*! \file QuadTree.h
+*   \brief Octree
+*   \author David Gu
+*   \date   documented on 02/14/2011
+*
+*   Mesh for viewer 
+*/
+#ifndef  _QUAD_TREE_H_
+#define  _QUAD_TREE_H_
+
+#include <map>
+#include <vector>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+
+#include "Mesh/Vertex.h"
+#include "Mesh/Edge.h"
+#include "Mesh/Face.h"
+#include "Mesh/HalfEdge.h"
+
+#include "Mesh/BaseMesh.h"
+#include "Mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Parser/parser.h"
+#include "TriangleCubeIntersect.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MeshLib
+{
+	/*!	CUVTriangle class
+	 *
+	 *	Triangle of a parameter domain, the item type of CQuadTree for the
+	 *	faces of a mesh with uv traits. A point exactly on an edge belongs to
+	 *	both triangles sharing the edge.
+	 */
+	class CUVTriangle
+	{
+	public:
+		CUVTriangle() { m_id = -1; };
+		~CUVTriangle() {};
+
+		CPoint2 & uv( int i ) { return m_uv[i]; };
+		/*! id of the face */
+		int & id() { return m_id; };
+
+		/*! whether the triangle overlaps the box [lo,hi], separating axis test */
+		bool intersect( CPoint2 & lo, CPoint2 & hi )
+		{
+			for( int d = 0; d < 2; d ++ )
+			{
+				double mn = std::min( m_uv[0][d], std::min( m_uv[1][d], m_uv[2][d] ) );
+				double mx = std::max( m_uv[0][d], std::max( m_uv[1][d], m_uv[2][d] ) );
+				if( mx < lo[d] || mn > hi[d] ) return false;
+			}
+
+			CPoint2 box[4] = { lo, CPoint2( hi[0], lo[1] ), hi, CPoint2( lo[0], hi[1] ) };
+			double  side   = _cross( m_uv[0], m_uv[1], m_uv[2] ) > 0 ? 1.0 : -1.0;
+
+			for( int i = 0; i < 3; i ++ )
+			{
+				CPoint2 & a = m_uv[i];
+				CPoint2 & b = m_uv[(i+1)%3];
+				bool outside = true;
+				for( int k = 0; k < 4 && outside; k ++ )
+				{
+					if( side * _cross( a, b, box[k] ) >= 0 ) outside = false;
+				}
+				if( outside ) return false;
+			}
+			return true;
+		};
+
+		/*! whether pt is inside the triangle */
+		bool inside( CPoint2 & pt )
+		{
+			CPoint bary;
+			return barycentric( pt, bary );
+		};
+
+		/*! barycentric coordinates of pt, returns whether pt is inside the triangle */
+		bool barycentric( CPoint2 & pt, CPoint & bary )
+		{
+			double area = _cross( m_uv[0], m_uv[1], m_uv[2] );
+			if( area == 0 ) return false;
+
+			bary[0] = _cross( pt, m_uv[1], m_uv[2] ) / area;
+			bary[1] = _cross( m_uv[0], pt, m_uv[2] ) / area;
+			bary[2] = 1.0 - bary[0] - bary[1];
+
+			const double eps = 1e-12;
+			return bary[0] >= -eps && bary[1] >= -eps && bary[2] >= -eps;
+		};
+
+	protected:
+		/*! twice the signed area of (a,b,c) */
+		static double _cross( const CPoint2 & a, const CPoint2 & b, const CPoint2 & c )
+		{
+			return ( b[0] - a[0] ) * ( c[1] - a[1] ) - ( b[1] - a[1] ) * ( c[0] - a[0] );
+		};
+
+		CPoint2 m_uv[3];
+		int     m_id;
+	};
+
+	/*!	CQuadTreeNode class
+	 *
+	 *	Node of the arena backed quad tree. Children are four consecutive nodes
+	 *	of the arena starting at m_child, in the order (0,0),(0,1),(1,0),(1,1);
+	 *	only leaves own items, the range [m_begin,m_end) of the leaf item list.
+	 */
+	template <typename T>
+	class CQuadTreeNode
+	{
+	public:
+		CQuadTreeNode<T>() { m_child = -1; m_begin = 0; m_end = 0; };
+		CQuadTreeNode<T>( CPoint2 p, CPoint2 q )
+		{
+			m_corner[0] = p;
+			m_corner[1] = q;
+			m_child = -1; 
+			m_begin = 0; 
+			m_end   = 0;
+		};
+		~CQuadTreeNode<T>() {};
+
+		bool leaf() { return m_child < 0; };
+
+	public:
+
+		CPoint2 m_corner[2];
+		int     m_child;
+		int     m_begin;
+		int     m_end;
+	};
+
+	/*!	CQuadTree class
+	 *
+	 *	Bounded depth quad tree over a box of the plane, all nodes live in one
+	 *	arena. T provides intersect( CPoint2 & lo, CPoint2 & hi ) for the box
+	 *	test, inside( CPoint2 & ) and, for the batch queries, 
+	 *	barycentric( CPoint2 &, CPoint & ), see CUVTriangle.
+	 */
+	template <typename T>
+	class CQuadTree
+	{
+	public:
+		CQuadTree<T>();
+		CQuadTree<T>( CPoint2 lo, CPoint2 hi );
+		~CQuadTree<T>();
+		CQuadTreeNode<T> * root() { return m_nodes.empty() ? NULL : &m_nodes[0]; };
+		/*! node arena */
+		std::vector< CQuadTreeNode<T> > & nodes() { return m_nodes; };
+		/*! leaf item list */
+		std::vector<T*> & items() { return m_items; };
+
+		/*! build the tree of depth at most n, a node with at most leaf_size items is not split */
+		void _construct( std::vector<T*> & samples, int n, int leaf_size = 8 );
+		/*! the item containing pt, NULL if none */
+		T* _locate( CPoint2 & pt );
+		/*! the items containing the points and the barycentric coordinates, in parallel */
+		void _locate( std::vector<CPoint2> & pts, std::vector<T*> & items, std::vector<CPoint> & bary );
+
+	protected:
+		/*! leaf containing pt, -1 if pt is outside the root */
+		int _leaf( CPoint2 & pt );
+
+		std::vector< CQuadTreeNode<T> > m_nodes;
+		std::vector<T*>                 m_items;
+		CPoint2                         m_corner[2];
+	};
+
+
+	template <typename T>
+	CQuadTree<T>::CQuadTree()
+	{
+		m_corner[0] = CPoint2(-1,-1);
+		m_corner[1] = CPoint2( 1, 1);
+	};
+
+	template <typename T>
+	CQuadTree<T>::CQuadTree( CPoint2 lo, CPoint2 hi )
+	{
+		m_corner[0] = lo;
+		m_corner[1] = hi;
+	};
+
+	template <typename T>
+	CQuadTree<T>::~CQuadTree()
+	{
+	};
+	
+	/*!
+	 *	The tree is built level by level. The item lists of the nodes being split
+	 *	are temporary, the children of all the nodes of a level are filled in 
+	 *	parallel and appended to the arena in node order, and a node which is not
+	 *	split moves its list to the leaf item list.
+	 */
+	template <typename T>
+	void CQuadTree<T>::_construct( std::vector<T*> & samples, int n, int leaf_size )
+	{
+		m_nodes.clear();
+		m_items.clear();
+
+		m_nodes.push_back( CQuadTreeNode<T>( m_corner[0], m_corner[1] ) );
+
+		std::vector<int> level( 1, 0 );
+		std::vector< std::vector<T*> > lists( 1 );
+		for( size_t i = 0; i < samples.size(); i ++ )
+		{
+			if( samples[i]->intersect( m_corner[0], m_corner[1] ) ) lists[0].push_back( samples[i] );
+		}
+
+		for( int depth = 0; !level.empty(); depth ++ )
+		{
+			int num = (int) level.size();
+			std::vector< std::vector<T*> > children( 4 * num );
+			std::vector<char> split( num, 0 );
+
+#pragma omp parallel for schedule( dynamic, 1 )
+			for( int k = 0; k < num; k ++ )
+			{
+				if( depth >= n || (int) lists[k].size() <= leaf_size ) continue;
+				split[k] = 1;
+
+				CQuadTreeNode<T> & N = m_nodes[ level[k] ];
+				double len = ( N.m_corner[1][0] - N.m_corner[0][0] ) / 2.0;
+				double wid = ( N.m_corner[1][1] - N.m_corner[0][1] ) / 2.0;
+
+				for( int i = 0; i < 2; i ++ )
+				for( int j = 0; j < 2; j ++ )
+				{
+					CPoint2 p = N.m_corner[0] + CPoint2( i * len, j * wid );
+					CPoint2 q = p + CPoint2( len, wid );
+					std::vector<T*> & list = children[ 4 * k + 2 * i + j ];
+					for( size_t id = 0; id < lists[k].size(); id ++ )
+					{
+						T * pT = lists[k][id];
+						if( pT->intersect( p, q ) ) list.push_back( pT );
+					}
+				}
+			}
+
+			std::vector<int> next;
+			std::vector< std::vector<T*> > next_lists;
+
+			for( int k = 0; k < num; k ++ )
+			{
+				if( !split[k] )
+				{
+					CQuadTreeNode<T> & N = m_nodes[ level[k] ];
+					N.m_begin = (int) m_items.size();
+					m_items.insert( m_items.end(), lists[k].begin(), lists[k].end() );
+					N.m_end   = (int) m_items.size();
+					continue;
+				}
+
+				CPoint2 lo = m_nodes[ level[k] ].m_corner[0];
+				CPoint2 hi = m_nodes[ level[k] ].m_corner[1];
+				CPoint2 h  = ( hi - lo ) / 2.0;
+
+				m_nodes[ level[k] ].m_child = (int) m_nodes.size();
+				for( int i = 0; i < 2; i ++ )
+				for( int j = 0; j < 2; j ++ )
+				{
+					CPoint2 p = lo + CPoint2( i * h[0], j * h[1] );
+					next.push_back( (int) m_nodes.size() );
+					m_nodes.push_back( CQuadTreeNode<T>( p, p + h ) );
+					next_lists.push_back( std::vector<T*>() );
+					next_lists.back().swap( children[ 4 * k + 2 * i + j ] );
+				}
+			}
+
+			level.swap( next );
+			lists.swap( next_lists );
+		}
+	};
+
+	//descend by the midpoints, a point on a split line goes to the lower child
+	template <typename T>
+	int CQuadTree<T>::_leaf( CPoint2 & pt )
+	{
+		if( m_nodes.empty() ) return -1;
+		if( pt[0] < m_corner[0][0] || pt[1] < m_corner[0][1] || pt[0] > m_corner[1][0] || pt[1] > m_corner[1][1] ) return -1;
+
+		int n = 0;
+		while( !m_nodes[n].leaf() )
+		{
+			CQuadTreeNode<T> & N = m_nodes[n];
+			double cx = ( N.m_corner[0][0] + N.m_corner[1][0] ) / 2.0;
+			double cy = ( N.m_corner[0][1] + N.m_corner[1][1] ) / 2.0;
+			int i = ( pt[0] > cx ) ? 1 : 0;
+			int j = ( pt[1] > cy ) ? 1 : 0;
+			n = N.m_child + 2 * i + j;
+		}
+		return n;
+	};
+
+	template <typename T>
+	T* CQuadTree<T>::_locate( CPoint2 & pt )
+	{
+		int n = _leaf( pt );
+		if( n < 0 ) return NULL;
+
+		CQuadTreeNode<T> & N = m_nodes[n];
+		for( int i = N.m_begin; i < N.m_end; i ++ )
+		{
+			T * pT = m_items[i];
+			if( pT->inside( pt ) ) 
+				return pT;
+		}
+		return NULL;
+	};
+
+	template <typename T>
+	void CQuadTree<T>::_locate( std::vector<CPoint2> & pts, std::vector<T*> & items, std::vector<CPoint> & bary )
+	{
+		int num = (int) pts.size();
+		items.assign( num, NULL );
+		bary.assign( num, CPoint() );
+
+#pragma omp parallel for schedule( dynamic, 1024 )
+		for( int k = 0; k < num; k ++ )
+		{
+			int n = _leaf( pts[k] );
+			if( n < 0 ) continue;
+
+			CQuadTreeNode<T> & N = m_nodes[n];
+			for( int i = N.m_begin; i < N.m_end; i ++ )
+			{
+				T * pT = m_items[i];
+				CPoint b;
+				if( pT->barycentric( pts[k], b ) )
+				{
+					items[k] = pT;
+					bary[k]  = b;
+					break;
+				}
+			}
+		}
+	};
+
+};
+
+#endif
@@ -0,0 +1,276 @@
+#include "SurfaceSampler.h"
+
+using namespace MeshLib;
+
+//SplitMix64 finalizer
+static unsigned long long _mix( unsigned long long x )
+{
+	x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+//candidate of the Poisson disk sampling
+struct CDiskCandidate
+{
+	unsigned long long cell;
+	unsigned long long priority;
+	int    id;
+	CPoint point;
+	bool operator<( const CDiskCandidate & other ) const
+	{
+		if( cell != other.cell ) return cell < other.cell;
+		if( priority != other.priority ) return priority < other.priority;
+		return id < other.id;
+	};
+};
+
+CSurfaceSampler::CSurfaceSampler( COctree & tree ) : m_tree( tree ), m_bvh( tree.triangles() )
+{
+	m_seed = 0;
+	m_bvh._construct();
+}
+
+double CSurfaceSampler::_uniform( unsigned long long stream, unsigned long long counter )
+{
+	unsigned long long x = _mix( _mix( (unsigned long long) m_seed + 0x9e3779b97f4a7c15ULL * ( stream + 1 ) ) ^ counter );
+	return (double)( x >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+
+double CSurfaceSampler::_area()
+{
+	std::vector<CTriangle> & trs = m_tree.triangles();
+	double area = 0;
+	for( size_t i = 0; i < trs.size(); i ++ )
+	{
+		CTriangle & T = trs[i];
+		area += ( ( T.v[1] - T.v[0] ) ^ ( T.v[2] - T.v[0] ) ).norm() / 2.0;
+	}
+	return area;
+}
+
+//the jitter of a leaf is drawn from the stream of its Morton code, the leaves
+//are processed in parallel and compacted in Morton order
+void CSurfaceSampler::_jitter( std::vector<CSample> & samples )
+{
+	std::vector<COctreeNode> & nodes = m_tree.nodes();
+
+	std::vector<int> leaves;
+	for( size_t i = 0; i < nodes.size(); i ++ )
+	{
+		if( nodes[i].leaf() ) leaves.push_back( (int) i );
+	}
+
+	int num = (int) leaves.size();
+	std::vector<CSample> out( num );
+	std::vector<char>    ok( num, 0 );
+
+#pragma omp parallel for schedule( dynamic, 64 )
+	for( int i = 0; i < num; i ++ )
+	{
+		COctreeNode * pN = &nodes[ leaves[i] ];
+
+		CPoint rd;
+		for( int k = 0; k < 3; k ++ )
+		{
+			rd[k] = _uniform( pN->m_code, k ) * 2 - 1.0;
+		}
+
+		CPoint p, q;
+		m_tree.corner( pN, p, q );
+		double len = q[0] - p[0];
+		CPoint c = (p + q)/2.0 + rd * len/4.0;
+
+		ok[i] = m_bvh._closest( c, out[i] ) ? 1 : 0;
+	}
+
+	for( int i = 0; i < num; i ++ )
+	{
+		if( ok[i] ) samples.push_back( out[i] );
+	}
+}
+
+//the radius is set from the target count by the density of maximal Poisson disk
+//sets, about 0.7 A / r^2 samples, and corrected a few times from the actual count
+void CSurfaceSampler::_poisson( std::vector<CSample> & samples, int target )
+{
+	if( target <= 0 ) return;
+
+	double area = _area();
+	if( area <= 0 ) return;
+
+	double radius = sqrt( 0.7 * area / target );
+
+	std::vector<CSample> result;
+	for( int iter = 0; iter < 4; iter ++ )
+	{
+		result.clear();
+		_poisson( result, radius, 8 * target );
+
+		int n = (int) result.size();
+		if( n == 0 || fabs( (double)( n - target ) ) <= 0.01 * target ) break;
+		radius *= sqrt( (double) n / target );
+	}
+
+	samples.insert( samples.end(), result.begin(), result.end() );
+}
+
+//dart throwing on a grid of cell size radius. Candidates are drawn uniformly by area
+//from per triangle streams, and cells are processed in 27 phases (x%3,y%3,z%3). Cells
+//of one phase are at least two cells apart, so they can accept their candidates in
+//parallel, each against the samples already accepted in its 3x3x3 neighborhood.
+void CSurfaceSampler::_poisson( std::vector<CSample> & samples, double radius, int candidates )
+{
+	std::vector<CTriangle> & trs = m_tree.triangles();
+	int nt = (int) trs.size();
+	if( nt == 0 || radius <= 0 || candidates <= 0 ) return;
+
+	std::vector<double> area( nt );
+	double total = 0;
+	for( int t = 0; t < nt; t ++ )
+	{
+		CTriangle & T = trs[t];
+		area[t] = ( ( T.v[1] - T.v[0] ) ^ ( T.v[2] - T.v[0] ) ).norm() / 2.0;
+		total += area[t];
+	}
+	if( total <= 0 ) return;
+
+	std::vector<int> offset( nt + 1, 0 );
+	for( int t = 0; t < nt; t ++ )
+	{
+		double e = candidates * area[t] / total;
+		int    n = (int) floor( e );
+		if( _uniform( t, 0 ) < e - n ) n ++;
+		offset[t+1] = offset[t] + n;
+	}
+
+	CPoint lo = trs[0].v[0], hi = trs[0].v[0];
+	for( int t = 0; t < nt; t ++ )
+	for( int k = 0; k < 3; k ++ )
+	for( int d = 0; d < 3; d ++ )
+	{
+		lo[d] = std::min( lo[d], trs[t].v[k][d] );
+		hi[d] = std::max( hi[d], trs[t].v[k][d] );
+	}
+	int dim[3];
+	for( int d = 0; d < 3; d ++ )
+		dim[d] = (int) floor( ( hi[d] - lo[d] ) / radius ) + 1;
+
+	int nc = offset[nt];
+	std::vector<CDiskCandidate> cand( nc );
+	std::vector<CPoint>         bary( nc );
+
+#pragma omp parallel for schedule( dynamic, 256 )
+	for( int t = 0; t < nt; t ++ )
+	{
+		CTriangle & T = trs[t];
+		for( int j = offset[t]; j < offset[t+1]; j ++ )
+		{
+			unsigned long long c = 3 * (unsigned long long)( j - offset[t] );
+			double s = sqrt( _uniform( t, c + 1 ) );
+			double u = _uniform( t, c + 2 );
+			CPoint b( 1 - s, s * ( 1 - u ), s * u );
+
+			CDiskCandidate & C = cand[j];
+			C.point = T.v[0] * b[0] + T.v[1] * b[1] + T.v[2] * b[2];
+			C.id    = j;
+			C.priority = _mix( (unsigned long long) m_seed ^ _mix( (unsigned long long) t * 0x100000000ULL + ( c + 3 ) ) );
+
+			int x[3];
+			for( int d = 0; d < 3; d ++ )
+			{
+				x[d] = (int) floor( ( C.point[d] - lo[d] ) / radius );
+				x[d] = std::max( 0, std::min( dim[d] - 1, x[d] ) );
+			}
+			C.cell = ( (unsigned long long) x[0] * dim[1] + x[1] ) * dim[2] + x[2];
+			bary[j] = b;
+		}
+	}
+
+	std::sort( cand.begin(), cand.end() );
+
+	//cells, their candidate ranges and phases
+	std::vector<unsigned long long> key;
+	std::vector<int> begin;
+	std::vector< std::vector<int> > phase( 27 );
+	for( int i = 0; i < nc; i ++ )
+	{
+		if( i > 0 && cand[i].cell == cand[i-1].cell ) continue;
+
+		unsigned long long c = cand[i].cell;
+		int z = (int)( c % dim[2] );
+		int y = (int)( ( c / dim[2] ) % dim[1] );
+		int x = (int)( c / dim[2] / dim[1] );
+
+		phase[ ( x % 3 ) * 9 + ( y % 3 ) * 3 + ( z % 3 ) ].push_back( (int) key.size() );
+		key.push_back( c );
+		begin.push_back( i );
+	}
+	begin.push_back( nc );
+
+	int ncell = (int) key.size();
+	std::vector< std::vector<int> > accepted( ncell );
+	double r2 = radius * radius;
+
+	for( int ph = 0; ph < 27; ph ++ )
+	{
+		std::vector<int> & cells = phase[ph];
+		int num = (int) cells.size();
+
+#pragma omp parallel for schedule( dynamic, 16 )
+		for( int ci = 0; ci < num; ci ++ )
+		{
+			int cell = cells[ci];
+			unsigned long long c = key[cell];
+			int z = (int)( c % dim[2] );
+			int y = (int)( ( c / dim[2] ) % dim[1] );
+			int x = (int)( c / dim[2] / dim[1] );
+
+			std::vector<int> around;
+			for( int dx = -1; dx <= 1; dx ++ )
+			for( int dy = -1; dy <= 1; dy ++ )
+			for( int dz = -1; dz <= 1; dz ++ )
+			{
+				int X = x + dx, Y = y + dy, Z = z + dz;
+				if( X < 0 || Y < 0 || Z < 0 || X >= dim[0] || Y >= dim[1] || Z >= dim[2] ) continue;
+				unsigned long long k = ( (unsigned long long) X * dim[1] + Y ) * dim[2] + Z;
+				std::vector<unsigned long long>::iterator pos = std::lower_bound( key.begin(), key.end(), k );
+				if( pos != key.end() && *pos == k ) around.push_back( (int)( pos - key.begin() ) );
+			}
+
+			for( int i = begin[cell]; i < begin[cell+1]; i ++ )
+			{
+				CPoint & p = cand[i].point;
+				bool free = true;
+				for( size_t a = 0; a < around.size() && free; a ++ )
+				{
+					std::vector<int> & acc = accepted[ around[a] ];
+					for( size_t m = 0; m < acc.size(); m ++ )
+					{
+						CPoint d = cand[ acc[m] ].point - p;
+						if( d * d < r2 ) { free = false; break; }
+					}
+				}
+				if( free ) accepted[cell].push_back( i );
+			}
+		}
+	}
+
+	for( int cell = 0; cell < ncell; cell ++ )
+	{
+		std::vector<int> & acc = accepted[cell];
+		for( size_t m = 0; m < acc.size(); m ++ )
+		{
+			CDiskCandidate & C = cand[ acc[m] ];
+			CTriangle & T = trs[ std::upper_bound( offset.begin(), offset.end(), C.id ) - offset.begin() - 1 ];
+			CPoint & b = bary[ C.id ];
+
+			CSample s;
+			s.point() = C.point;
+			s.uv()    = T.uv[0] * b[0] + T.uv[1] * b[1] + T.uv[2] * b[2];
+			s.rgb()   = T.rgb[0] * b[0] + T.rgb[1] * b[1] + T.rgb[2] * b[2];
+			samples.push_back( s );
+		}
+	}
+}
@@ -0,0 +1,50 @@
+/*! \file SurfaceSampler.h
+*   \brief Deterministic surface sampling
+*
+*   Jittered and Poisson disk samples on a triangle soup
+*/
+#ifndef  _SURFACE_SAMPLER_H_
+#define  _SURFACE_SAMPLER_H_
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "Octree.h"
+#include "TriangleBVH.h"
+
+namespace MeshLib
+{
+	/*!	CSurfaceSampler class
+	 *
+	 *	Samples the triangles of a constructed COctree. All random numbers come
+	 *	from a counter based generator, one stream per leaf or per triangle, so
+	 *	the samples only depend on the seed and not on the number of threads.
+	 */
+	class CSurfaceSampler
+	{
+	public:
+		CSurfaceSampler( COctree & tree );
+		~CSurfaceSampler() {};
+		/*! seed of the random streams */
+		unsigned int & seed() { return m_seed; };
+		/*! one jittered sample per non-empty leaf, moved to the closest surface point */
+		void _jitter( std::vector<CSample> & samples );
+		/*! Poisson disk samples, about target of them */
+		void _poisson( std::vector<CSample> & samples, int target );
+		/*! Poisson disk samples with a fixed radius */
+		void _poisson( std::vector<CSample> & samples, double radius, int candidates );
+
+	protected:
+		/*! uniform number in [0,1) of a stream at a counter */
+		double _uniform( unsigned long long stream, unsigned long long counter );
+		/*! total area of the triangles */
+		double _area();
+
+		COctree    & m_tree;
+		CTriangleBVH m_bvh;
+		unsigned int m_seed;
+	};
+};
+
+#endif
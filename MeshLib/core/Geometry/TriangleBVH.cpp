@@ -0,0 +1,226 @@
+#include "TriangleBVH.h"
+
+using namespace MeshLib;
+
+//orders triangle indices by one centroid coordinate, then by index
+struct CCentroidCompare
+{
+	CCentroidCompare( std::vector<CPoint> & c, int axis ) : m_c( c ), m_axis( axis ) {};
+	bool operator()( int a, int b ) const
+	{
+		double x = m_c[a][m_axis];
+		double y = m_c[b][m_axis];
+		return x < y || ( x == y && a < b );
+	};
+	std::vector<CPoint> & m_c;
+	int m_axis;
+};
+
+CTriangleBVH::CTriangleBVH( std::vector<CTriangle> & trs ) : m_trs( trs )
+{
+}
+
+void CTriangleBVH::_construct( int leaf_size )
+{
+	m_nodes.clear();
+	m_index.clear();
+	m_centroid.clear();
+
+	int num = (int) m_trs.size();
+	if( num == 0 ) return;
+
+	m_index.resize( num );
+	m_centroid.resize( num );
+	for( int i = 0; i < num; i ++ )
+	{
+		m_index[i] = i;
+		m_centroid[i] = ( m_trs[i].v[0] + m_trs[i].v[1] + m_trs[i].v[2] ) / 3.0;
+	}
+
+	m_nodes.reserve( 2 * ( num / std::max( leaf_size, 1 ) ) + 1 );
+	m_nodes.push_back( CBVHNode() );
+	m_nodes[0].m_begin = 0;
+	m_nodes[0].m_end   = num;
+
+	//nodes are split in creation order, the pool grows while it is scanned
+	for( size_t n = 0; n < m_nodes.size(); n ++ )
+	{
+		_bound( (int) n );
+		_split( (int) n, leaf_size );
+	}
+}
+
+void CTriangleBVH::_bound( int node )
+{
+	CBVHNode & N = m_nodes[node];
+	N.m_min = m_trs[ m_index[N.m_begin] ].v[0];
+	N.m_max = N.m_min;
+
+	for( int i = N.m_begin; i < N.m_end; i ++ )
+	{
+		CTriangle & T = m_trs[ m_index[i] ];
+		for( int k = 0; k < 3; k ++ )
+		for( int d = 0; d < 3; d ++ )
+		{
+			N.m_min[d] = std::min( N.m_min[d], T.v[k][d] );
+			N.m_max[d] = std::max( N.m_max[d], T.v[k][d] );
+		}
+	}
+}
+
+//sort the centroids along the longest axis of the box and split at the median
+void CTriangleBVH::_split( int node, int leaf_size )
+{
+	int begin = m_nodes[node].m_begin;
+	int end   = m_nodes[node].m_end;
+	if( end - begin <= leaf_size ) return;
+
+	CPoint d = m_nodes[node].m_max - m_nodes[node].m_min;
+	int axis = 0;
+	if( d[1] > d[axis] ) axis = 1;
+	if( d[2] > d[axis] ) axis = 2;
+
+	int mid = ( begin + end ) / 2;
+
+	CCentroidCompare cmp( m_centroid, axis );
+
+	std::nth_element( m_index.begin() + begin, m_index.begin() + mid, m_index.begin() + end, cmp );
+
+	CBVHNode left, right;
+	left.m_begin  = begin; left.m_end  = mid;
+	right.m_begin = mid;   right.m_end = end;
+
+	m_nodes[node].m_child = (int) m_nodes.size();
+	m_nodes.push_back( left  );
+	m_nodes.push_back( right );
+}
+
+double CTriangleBVH::_box_distance( const CPoint & p, CBVHNode & N )
+{
+	double d = 0;
+	for( int i = 0; i < 3; i ++ )
+	{
+		double t = 0;
+		if( p[i] < N.m_min[i] ) t = N.m_min[i] - p[i];
+		if( p[i] > N.m_max[i] ) t = p[i] - N.m_max[i];
+		d += t * t;
+	}
+	return d;
+}
+
+//closest point on a triangle by its Voronoi regions, see Ericson,
+//Real-Time Collision Detection, 5.1.5
+CPoint CTriangleBVH::_closest_on_triangle( const CPoint & p, CTriangle & T, CPoint & bary )
+{
+	CPoint a = T.v[0], b = T.v[1], c = T.v[2];
+	CPoint ab = b - a;
+	CPoint ac = c - a;
+	CPoint ap = p - a;
+
+	double d1 = ab * ap;
+	double d2 = ac * ap;
+	if( d1 <= 0 && d2 <= 0 ) { bary = CPoint(1,0,0); return a; }
+
+	CPoint bp = p - b;
+	double d3 = ab * bp;
+	double d4 = ac * bp;
+	if( d3 >= 0 && d4 <= d3 ) { bary = CPoint(0,1,0); return b; }
+
+	double vc = d1 * d4 - d3 * d2;
+	if( vc <= 0 && d1 >= 0 && d3 <= 0 )
+	{
+		double v = d1 / ( d1 - d3 );
+		bary = CPoint( 1 - v, v, 0 );
+		return a + ab * v;
+	}
+
+	CPoint cp = p - c;
+	double d5 = ab * cp;
+	double d6 = ac * cp;
+	if( d6 >= 0 && d5 <= d6 ) { bary = CPoint(0,0,1); return c; }
+
+	double vb = d5 * d2 - d1 * d6;
+	if( vb <= 0 && d2 >= 0 && d6 <= 0 )
+	{
+		double w = d2 / ( d2 - d6 );
+		bary = CPoint( 1 - w, 0, w );
+		return a + ac * w;
+	}
+
+	double va = d3 * d6 - d5 * d4;
+	if( va <= 0 && ( d4 - d3 ) >= 0 && ( d5 - d6 ) >= 0 )
+	{
+		double w = ( d4 - d3 ) / ( ( d4 - d3 ) + ( d5 - d6 ) );
+		bary = CPoint( 0, 1 - w, w );
+		return b + ( c - b ) * w;
+	}
+
+	double denom = 1.0 / ( va + vb + vc );
+	double v = vb * denom;
+	double w = vc * denom;
+	bary = CPoint( 1 - v - w, v, w );
+	return a + ab * v + ac * w;
+}
+
+//depth first search with an explicit stack, the nearer child is visited first;
+//ties between triangles are broken by the smaller index so the result does not
+//depend on the traversal
+int CTriangleBVH::_closest( const CPoint & p, CPoint & q, CPoint & bary )
+{
+	if( m_nodes.empty() ) return -1;
+
+	double best = std::numeric_limits<double>::max();
+	int    tri  = -1;
+
+	std::vector<int> stack;
+	stack.reserve( 64 );
+	stack.push_back( 0 );
+
+	while( !stack.empty() )
+	{
+		int n = stack.back();
+		stack.pop_back();
+
+		CBVHNode & N = m_nodes[n];
+		if( _box_distance( p, N ) > best ) continue;
+
+		if( N.leaf() )
+		{
+			for( int i = N.m_begin; i < N.m_end; i ++ )
+			{
+				int t = m_index[i];
+				CPoint b;
+				CPoint r = _closest_on_triangle( p, m_trs[t], b );
+				double d = ( r - p ) * ( r - p );
+				if( d < best || ( d == best && t < tri ) )
+				{
+					best = d; tri = t; q = r; bary = b;
+				}
+			}
+			continue;
+		}
+
+		int l = N.m_child;
+		int r = N.m_child + 1;
+		double dl = _box_distance( p, m_nodes[l] );
+		double dr = _box_distance( p, m_nodes[r] );
+		if( dl < dr ) std::swap( l, r );
+		stack.push_back( l );
+		stack.push_back( r );
+	}
+
+	return tri;
+}
+
+bool CTriangleBVH::_closest( const CPoint & p, CSample & sample )
+{
+	CPoint q, bary;
+	int t = _closest( p, q, bary );
+	if( t < 0 ) return false;
+
+	CTriangle & T = m_trs[t];
+	sample.point() = q;
+	sample.uv()    = T.uv[0] * bary[0] + T.uv[1] * bary[1] + T.uv[2] * bary[2];
+	sample.rgb()   = T.rgb[0] * bary[0] + T.rgb[1] * bary[1] + T.rgb[2] * bary[2];
+	return true;
+}
@@ -0,0 +1,73 @@
+/*! \file TriangleBVH.h
+*   \brief Bounding volume hierarchy of triangles
+*
+*   Closest point queries on a triangle soup
+*/
+#ifndef  _TRIANGLE_BVH_H_
+#define  _TRIANGLE_BVH_H_
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Octree.h"
+
+namespace MeshLib
+{
+	/*!	CBVHNode class
+	 *
+	 *	Node of the flat bounding volume hierarchy. An internal node has its
+	 *	children at m_child and m_child+1, a leaf owns the triangles
+	 *	[m_begin,m_end) of the reordered triangle index list.
+	 */
+	class CBVHNode
+	{
+	public:
+		CBVHNode() { m_child = -1; m_begin = 0; m_end = 0; };
+		bool leaf() { return m_child < 0; };
+	public:
+		CPoint m_min;
+		CPoint m_max;
+		int    m_child;
+		int    m_begin;
+		int    m_end;
+	};
+
+	/*!	CTriangleBVH class
+	 *
+	 *	Median split hierarchy over a triangle list, answering closest point
+	 *	queries. The query is read only, it can be called from several threads.
+	 */
+	class CTriangleBVH
+	{
+	public:
+		CTriangleBVH( std::vector<CTriangle> & trs );
+		~CTriangleBVH() {};
+		/*! build the hierarchy, at most leaf_size triangles per leaf */
+		void _construct( int leaf_size = 4 );
+		/*! closest point on the triangles to p, returns the triangle index, -1 if empty
+		 *  \param p query point
+		 *  \param q closest point
+		 *  \param bary barycentric coordinates of q in the returned triangle
+		 */
+		int  _closest( const CPoint & p, CPoint & q, CPoint & bary );
+		/*! closest point as a sample, interpolating uv and rgb */
+		bool _closest( const CPoint & p, CSample & sample );
+
+	protected:
+		void _split( int node, int leaf_size );
+		void _bound( int node );
+		/*! closest point on one triangle */
+		static CPoint _closest_on_triangle( const CPoint & p, CTriangle & T, CPoint & bary );
+		/*! squared distance from p to the box of a node */
+		double _box_distance( const CPoint & p, CBVHNode & N );
+
+		std::vector<CTriangle> & m_trs;
+		std::vector<CBVHNode>    m_nodes;
+		std::vector<int>         m_index;
+		std::vector<CPoint>      m_centroid;
+	};
+};
+
+#endif
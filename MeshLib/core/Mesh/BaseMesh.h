@@ -24,6 +24,7 @@
 #include "../Geometry/Point.h"
 #include "../Geometry/Point2.h"
 #include "../Parser/StrUtil.h"
+#include "../Trace/Trace.h"
 
 namespace MeshLib{
 
@@ -150,6 +151,11 @@ public:
 	\return the face id.
 	*/
 	int     faceId( tFace  f );
+	/*!
+	The maximal face id, faces are kept sorted by their ids, no face scan is needed
+	\return the maximal face id, -1 if there is no face.
+	*/
+	int     maxFaceId();
 
 	//access edge - edge key, vertex
 	/*!
@@ -852,7 +858,7 @@ CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::~CBaseMesh()
 {
 	//remove vertices
 
-  for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++ )
+  for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++ )
   {
       CVertex * pV = *viter;
       delete pV;
@@ -861,7 +867,7 @@ CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::~CBaseMesh()
 
 	//remove faces
 
-  for( std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+  for( typename std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
   {
       CFace * pF = *fiter;
 
@@ -873,7 +879,7 @@ CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::~CBaseMesh()
         hes.push_back( he );
       }while( he != pF->halfedge() );
 
-      for( std::list<CHalfEdge*>::iterator hiter = hes.begin(); hiter != hes.end(); hiter ++)
+      for( typename std::list<CHalfEdge*>::iterator hiter = hes.begin(); hiter != hes.end(); hiter ++)
       {
           CHalfEdge * pH = *hiter;
           delete pH;
@@ -885,7 +891,7 @@ CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::~CBaseMesh()
   m_faces.clear();
 	
   //remove edges
-  for( std::list<CEdge*>::iterator eiter = m_edges.begin(); eiter != m_edges.end(); eiter ++ )
+  for( typename std::list<CEdge*>::iterator eiter = m_edges.begin(); eiter != m_edges.end(); eiter ++ )
   {
       CEdge * pE = *eiter;
       delete pE;
@@ -1147,6 +1153,21 @@ CFace * CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::idFace( int id )
 	return m_map_face[id];
 };
 
+/*!
+	The maximal face id
+	\return the maximal face id, -1 if there is no face.
+*/
+template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
+int CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::maxFaceId()
+{
+	//idFace may insert empty entries for missing ids
+	for( typename std::map<int,tFace>::reverse_iterator fiter = m_map_face.rbegin(); fiter != m_map_face.rend(); fiter ++ )
+	{
+		if( fiter->second != NULL ) return fiter->first;
+	}
+	return -1;
+};
+
 //acess f->id
 /*!
 	The face id
@@ -1172,7 +1193,7 @@ CEdge * CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::createEdge( tVertex  v1, tVert
 	std::list<CEdge*> & ledges = (std::list<CEdge*> &) pV->edges();
 
 	
-	for( std::list<CEdge*>::iterator te = ledges.begin(); te != ledges.end(); te ++ )
+	for( typename std::list<CEdge*>::iterator te = ledges.begin(); te != ledges.end(); te ++ )
 	{
 		CEdge	  * pE = *te;
 		CHalfEdge * pH = (CHalfEdge*) pE->halfedge(0);
@@ -1215,7 +1236,7 @@ inline CEdge * CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::vertexEdge( tVertex  v0
 	CVertex * pV = (v0->id() < v1->id() )? v0: v1;
 	std::list<CEdge*> & ledges = vertexEdges( pV );
 
-	for( std::list<CEdge*>::iterator eiter = ledges.begin(); eiter != ledges.end(); eiter ++ )
+	for( typename std::list<CEdge*>::iterator eiter = ledges.begin(); eiter != ledges.end(); eiter ++ )
 	{
 		CEdge * pE = *eiter;
 		CHalfEdge * pH =  edgeHalfedge(pE,0);
@@ -1278,6 +1299,7 @@ inline CHalfEdge * CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::vertexHalfedge( tVe
 template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
 void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::read_m( const char * input )
 {
+	TRACE_SCOPE( "CBaseMesh::read_m" );
 	std::fstream is( input, std::fstream::in );
 
 	if( is.fail() )
@@ -1421,7 +1443,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::read_m( const char * input )
 	//labelBoundary();
 
 	//Label boundary edges
-	for(std::list<CEdge*>::iterator eiter= m_edges.begin() ; eiter != m_edges.end() ; ++ eiter )
+	for(typename std::list<CEdge*>::iterator eiter= m_edges.begin() ; eiter != m_edges.end() ; ++ eiter )
 	{
 		CEdge *     edge = *eiter;
 		CHalfEdge * he[2];
@@ -1454,14 +1476,14 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::read_m( const char * input )
 
 	std::list<CVertex*> dangling_verts;
 	//Label boundary edges
-	for(std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
+	for(typename std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
 	{
 		CVertex *     v = *viter;
 		if( v->halfedge() != NULL ) continue;
 		dangling_verts.push_back( v );
 	}
 
-	for( std::list<CVertex*>::iterator  viter = dangling_verts.begin() ; viter != dangling_verts.end(); ++ viter )
+	for( typename std::list<CVertex*>::iterator  viter = dangling_verts.begin() ; viter != dangling_verts.end(); ++ viter )
 	{
 		CVertex * v = *viter;
 		m_verts.remove( v );
@@ -1472,7 +1494,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::read_m( const char * input )
 	//Arrange the boundary half_edge of boundary vertices, to make its halfedge
 	//to be the most ccw in half_edge
 
-	for(std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
+	for(typename std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
 	{
 		CVertex *     v = *viter;
 		if( !v->boundary() ) continue;
@@ -1487,25 +1509,25 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::read_m( const char * input )
 
 	//read in the traits
 
-	for(std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
+	for(typename std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
 	{
 		CVertex *     v = *viter;
 		v->_from_string();
 	}
 
-	for(std::list<CEdge*>::iterator eiter = m_edges.begin();  eiter != m_edges.end() ; ++ eiter )
+	for(typename std::list<CEdge*>::iterator eiter = m_edges.begin();  eiter != m_edges.end() ; ++ eiter )
 	{
 		CEdge *     e = *eiter;
 		e->_from_string();
 	}
 
-	for(std::list<CFace*>::iterator fiter = m_faces.begin();  fiter != m_faces.end() ; ++ fiter )
+	for(typename std::list<CFace*>::iterator fiter = m_faces.begin();  fiter != m_faces.end() ; ++ fiter )
 	{
 		CFace *     f = *fiter;
 		f->_from_string();
 	}
 
-	for( std::list<CFace*>::iterator fiter=m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+	for( typename std::list<CFace*>::iterator fiter=m_faces.begin(); fiter != m_faces.end(); fiter ++ )
 	{
 		CFace * pF = *fiter;
 
@@ -1524,26 +1546,27 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::read_m( const char * input )
 	*/template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
 void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_m( const char * output )
 {
+	TRACE_SCOPE( "CBaseMesh::write_m" );
 	//write traits to string
-	for( std::list<CVertex*>::iterator viter=m_verts.begin(); viter != m_verts.end(); viter ++ )
+	for( typename std::list<CVertex*>::iterator viter=m_verts.begin(); viter != m_verts.end(); viter ++ )
 	{
 		CVertex * pV = *viter;
 		pV->_to_string();
 	}
 
-	for( std::list<CEdge*>::iterator eiter=m_edges.begin(); eiter != m_edges.end(); eiter ++ )
+	for( typename std::list<CEdge*>::iterator eiter=m_edges.begin(); eiter != m_edges.end(); eiter ++ )
 	{
 		CEdge * pE = *eiter;
 		pE->_to_string();
 	}
 
-	for( std::list<CFace*>::iterator fiter=m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+	for( typename std::list<CFace*>::iterator fiter=m_faces.begin(); fiter != m_faces.end(); fiter ++ )
 	{
 		CFace * pF = *fiter;
 		pF->_to_string();
 	}
 
-	for( std::list<CFace*>::iterator fiter=m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+	for( typename std::list<CFace*>::iterator fiter=m_faces.begin(); fiter != m_faces.end(); fiter ++ )
 	{
 		CFace * pF = *fiter;
 		CHalfEdge * pH  = faceMostCcwHalfEdge( pF );
@@ -1563,7 +1586,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_m( const char * output )
 
 
 	//remove vertices
-  for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+  for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
   {
 		tVertex v = *viter;
 
@@ -1580,7 +1603,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_m( const char * output )
 		_os << std::endl;
 	}
 
-  for( std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+  for( typename std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
 	{
 		tFace f = *fiter;
 
@@ -1598,7 +1621,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_m( const char * output )
 		_os << std::endl;
 	}
 
-  for( std::list<CEdge*>::iterator eiter = m_edges.begin(); eiter != m_edges.end(); eiter ++ )
+  for( typename std::list<CEdge*>::iterator eiter = m_edges.begin(); eiter != m_edges.end(); eiter ++ )
 	{
 		tEdge e = *eiter;
 		if( e->string().size() > 0 )
@@ -1608,7 +1631,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_m( const char * output )
 		}
 	}
 
-  for( std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++  )
+  for( typename std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++  )
 	{
 		tFace f = *fiter;
 
@@ -1645,13 +1668,13 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_obj( const char * output )
 	}
 
 	int vid = 1;
-	for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+	for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
 	{
 		tVertex v = *viter;
 		v->id() = vid ++;
 	}
 
-	for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+	for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
 	{
 		tVertex v = *viter;
 
@@ -1664,7 +1687,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_obj( const char * output )
 		_os << std::endl;
 	}
 
-	for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+	for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
 	{
 		tVertex v = *viter;
 
@@ -1677,7 +1700,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_obj( const char * output )
 		_os << std::endl;
 	}
 
-	for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+	for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
 	{
 		tVertex v = *viter;
 
@@ -1691,7 +1714,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_obj( const char * output )
 	}
 
 
-  for( std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+  for( typename std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
 	{
 		tFace f = *fiter;
 
@@ -1729,13 +1752,13 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_off( const char * output )
 
 
 	int vid = 0;
-	for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+	for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
 	{
 		tVertex v = *viter;
 		v->id() = vid ++;
 	}
 
-	for( std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
+	for( typename std::list<CVertex*>::iterator viter = m_verts.begin(); viter != m_verts.end(); viter ++)
 	{
 		tVertex v = *viter;
 		_os << v->point()[0]  << " " << v->point()[1] << " " << v->point()[2]<< std::endl;
@@ -1743,7 +1766,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_off( const char * output )
 	}
 
 
-	for( std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
+	for( typename std::list<CFace*>::iterator fiter = m_faces.begin(); fiter != m_faces.end(); fiter ++ )
 	{
 		tFace f = *fiter;
 
@@ -1772,7 +1795,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::write_off( const char * output )
 template<typename CVertex, typename CEdge, typename CFace, typename CHalfEdge>
 void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::deleteFace( tFace  pFace )
 {  	  
-	  std::map<int,tFace>::iterator fiter = m_map_face.find( pFace->id() );
+	  typename std::map<int,tFace>::iterator fiter = m_map_face.find( pFace->id() );
 	  if( fiter != m_map_face.end() )
 	  {
 		  m_map_face.erase( fiter );
@@ -1820,8 +1843,6 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::deleteFace( tFace  pFace )
 			{
 				//assert(0);
 				m_edges.remove( pE );
-				CVertex * v0 = halfedgeSource( pH );
-				CVertex * v1 = halfedgeTarget( pH );
 				delete pE;
 			}
 
@@ -1950,7 +1971,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::labelBoundary( void )
 {
 	
 	//Label boundary edges
-	for(std::list<CEdge*>::iterator eiter= m_edges.begin() ; eiter != m_edges.end() ; ++ eiter )
+	for(typename std::list<CEdge*>::iterator eiter= m_edges.begin() ; eiter != m_edges.end() ; ++ eiter )
 	{
 		CEdge *     edge = *eiter;
 		CHalfEdge * he[2];
@@ -1983,14 +2004,14 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::labelBoundary( void )
 
 	std::list<CVertex*> dangling_verts;
 	//Label boundary edges
-	for(std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
+	for(typename std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
 	{
 		tVertex     v = *viter;
 		if( v->halfedge() != NULL ) continue;
 		dangling_verts.push_back( v );
 	}
 
-	for( std::list<CVertex*>::iterator  viter = dangling_verts.begin() ; viter != dangling_verts.end(); ++ viter )
+	for( typename std::list<CVertex*>::iterator  viter = dangling_verts.begin() ; viter != dangling_verts.end(); ++ viter )
 	{
 		tVertex v = *viter;
 		m_verts.remove( v );
@@ -2001,7 +2022,7 @@ void CBaseMesh<CVertex,CEdge,CFace,CHalfEdge>::labelBoundary( void )
 	//Arrange the boundary half_edge of boundary vertices, to make its halfedge
 	//to be the most ccw in half_edge
 
-	for(std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
+	for(typename std::list<CVertex*>::iterator viter = m_verts.begin();  viter != m_verts.end() ; ++ viter )
 	{
 		tVertex     v = *viter;
 		if( !v->boundary() ) continue;
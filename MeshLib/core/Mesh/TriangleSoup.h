@@ -0,0 +1,624 @@
+#ifndef _TRIANGLE_SOUP_H_
+#define _TRIANGLE_SOUP_H_
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <string.h>
+#include <iostream>
+#include <fstream>
+
+#include "../Geometry/Point.h"
+#include "../Geometry/Point2.h"
+#include "../Parser/parser.h"
+#include "../Parser/StrUtil.h"
+#include "../Parser/MappedFile.h"
+#include "../Trace/Trace.h"
+
+namespace MeshLib
+{
+namespace TriangleSoup
+{
+
+class CVertex
+{
+	public:
+		CPoint    m_point;
+		CPoint2   m_uv;
+		CPoint    m_rgb;
+		CPoint    m_normal;
+		int       m_id;
+		double    m_area;
+};
+
+class CFace
+{
+	public:
+		int m_id;
+		CVertex * m_v[3];
+		CPoint    m_normal;
+		double    m_area;
+};
+
+
+
+/*!
+ *	\brief CTriangleMesh class
+ *
+ *  Triangle soup read from a .m file. The vertices and faces are stored in flat arrays,
+ *  vertices() and faces() point into them. read_m maps the file and parses it in line
+ *  aligned chunks in parallel, the face corners are resolved by a table from the vertex
+ *  ids to the array indices.
+ */
+class CTriangleMesh
+{
+  public:
+
+	CTriangleMesh()
+	{
+		m_has_uv     = false;
+		m_has_rgb    = false;
+		m_has_normal = false;
+	};
+
+	~CTriangleMesh(){};
+	
+	bool m_has_uv;
+	bool m_has_rgb;
+	bool m_has_normal;
+
+
+	std::vector<CFace*> 	& faces() { return	m_faces;};
+	std::vector<CVertex*> 	& vertices() { return	m_vertices;};
+
+	/*! index of the vertex with the given id in the vertex array, -1 if there is none */
+	int vertex_index( int id )
+	{
+		if( !m_id_sparse.empty() )
+		{
+			std::vector< std::pair<int,int> >::iterator it =
+				std::lower_bound( m_id_sparse.begin(), m_id_sparse.end(), std::pair<int,int>( id, -1 ) );
+			return ( it != m_id_sparse.end() && it->first == id )? it->second: -1;
+		}
+		if( id < m_id_base || id - m_id_base >= (int) m_id_table.size() ) return -1;
+		return m_id_table[ id - m_id_base ];
+	};
+	/*! index of v in vertices() */
+	int index( CVertex * v ) { return (int)( v - &m_vertex_array[0] ); };
+
+   protected:
+
+	std::vector<CVertex>    m_vertex_array;
+	std::vector<CFace>      m_face_array;
+	std::vector<CVertex*>   m_vertices;
+	std::vector<CFace*> 	m_faces;
+
+	/*! id to index table, dense from m_id_base, or sorted ( id, index ) pairs if the ids are sparse */
+	int                     m_id_base;
+	std::vector<int>        m_id_table;
+	std::vector< std::pair<int,int> > m_id_sparse;
+
+	/*! face as read, corners by vertex id */
+	class CFaceIds
+	{
+	public:
+		int m_id;
+		int m_v[3];
+	};
+
+	/*! vertices and faces of one chunk */
+	class CChunk
+	{
+	public:
+		CChunk() { m_has_uv = m_has_rgb = false; };
+		std::vector<CVertex>  m_vertices;
+		std::vector<CFaceIds> m_faces;
+		bool m_has_uv;
+		bool m_has_rgb;
+	};
+
+	/*! value of key=(...) in the trait string [p,end), the numbers are read into v */
+	static bool read_trait( const char * p, const char * end, const char * key, double * v, int n )
+	{
+		size_t len = strlen( key );
+		for( ; p + len + 1 < end; p ++ )
+		{
+			if( memcmp( p, key, len ) != 0 || p[len] != '=' ) continue;
+			if( p[-1] != '{' && p[-1] != ' ' ) continue;
+			const char * q = skip_blank( p + len + 1, end );
+			if( q == end || *q != '(' ) return false;
+			q ++;
+			for( int i = 0; i < n; i ++ )
+				if( !scan_double( q, end, v[i] ) ) return false;
+			return true;
+		}
+		return false;
+	};
+
+	/*! parse the vertex and face lines of [p,end) */
+	static void read_chunk( const char * p, const char * end, CChunk & chunk )
+	{
+		while( p < end )
+		{
+			const char * line = skip_blank( p, end );
+			const char * eol  = (const char *) memchr( line, '\n', end - line );
+			if( eol == NULL ) eol = end;
+			p = ( eol < end )? eol + 1: end;
+
+			if( match_keyword( line, eol, "Vertex", 6 ) )
+			{
+				CVertex v;
+				v.m_rgb  = CPoint(1,1,1);
+				v.m_area = 0;
+				const char * q = line + 6;
+				if( !scan_int( q, eol, v.m_id ) ||
+					!scan_double( q, eol, v.m_point[0] ) ||
+					!scan_double( q, eol, v.m_point[1] ) ||
+					!scan_double( q, eol, v.m_point[2] ) )
+				{
+					std::cerr << "Error in reading vertex" << std::endl;
+					continue;
+				}
+				const char * open = (const char *) memchr( q, '{', eol - q );
+				if( open != NULL )
+				{
+					double t[3];
+					if( read_trait( open + 1, eol, "rgb", t, 3 ) )
+					{
+						v.m_rgb = CPoint( t[0], t[1], t[2] );
+						chunk.m_has_rgb = true;
+					}
+					if( read_trait( open + 1, eol, "uv", t, 2 ) )
+					{
+						v.m_uv = CPoint2( t[0], t[1] );
+						chunk.m_has_uv = true;
+					}
+				}
+				chunk.m_vertices.push_back( v );
+				continue;
+			}
+
+			if( match_keyword( line, eol, "Face", 4 ) )
+			{
+				CFaceIds f;
+				const char * q = line + 4;
+				if( !scan_int( q, eol, f.m_id ) ||
+					!scan_int( q, eol, f.m_v[0] ) ||
+					!scan_int( q, eol, f.m_v[1] ) ||
+					!scan_int( q, eol, f.m_v[2] ) )
+				{
+					std::cerr << "Error in reading face" << std::endl;
+					continue;
+				}
+				chunk.m_faces.push_back( f );
+			}
+		}
+	};
+
+	/*! build the id to index table, a later vertex with the same id wins */
+	void build_id_table()
+	{
+		m_id_table.clear();
+		m_id_sparse.clear();
+		m_id_base = 0;
+		if( m_vertex_array.empty() ) return;
+
+		int lo = m_vertex_array[0].m_id, hi = lo;
+		for( size_t i = 1; i < m_vertex_array.size(); i ++ )
+		{
+			lo = std::min( lo, m_vertex_array[i].m_id );
+			hi = std::max( hi, m_vertex_array[i].m_id );
+		}
+
+		if( (double) hi - lo < 4.0 * m_vertex_array.size() + 1024 )
+		{
+			m_id_base = lo;
+			m_id_table.assign( hi - lo + 1, -1 );
+			for( size_t i = 0; i < m_vertex_array.size(); i ++ )
+				m_id_table[ m_vertex_array[i].m_id - lo ] = (int) i;
+			return;
+		}
+
+		m_id_sparse.resize( m_vertex_array.size() );
+		for( size_t i = 0; i < m_vertex_array.size(); i ++ )
+			m_id_sparse[i] = std::pair<int,int>( m_vertex_array[i].m_id, (int) i );
+		std::stable_sort( m_id_sparse.begin(), m_id_sparse.end(), compare_id );
+		/* keep the last of equal ids */
+		size_t k = 0;
+		for( size_t i = 0; i < m_id_sparse.size(); i ++ )
+		{
+			if( k > 0 && m_id_sparse[k-1].first == m_id_sparse[i].first ) m_id_sparse[k-1] = m_id_sparse[i];
+			else m_id_sparse[k++] = m_id_sparse[i];
+		}
+		m_id_sparse.resize( k );
+	};
+
+	static bool compare_id( const std::pair<int,int> & a, const std::pair<int,int> & b ) { return a.first < b.first; };
+
+   public:
+
+	/*! read a .m file, returns false if it can not be opened */
+	bool read_m( const char * name )
+	{
+		TRACE_SCOPE( "CTriangleMesh::read_m" );
+		CMappedFile file( name );
+		if( !file.valid() )
+		{
+			std::cerr << "Error in reading " << name << std::endl;
+			return false;
+		}
+
+		int n = CMappedFile::parallel_chunks( file.size() );
+		std::vector<const char*> bounds;
+		file.chunks( n, bounds );
+
+		std::vector<CChunk> chunks( n );
+#pragma omp parallel for schedule(dynamic)
+		for( int k = 0; k < n; k ++ )
+			read_chunk( bounds[k], bounds[k+1], chunks[k] );
+
+		/* concatenate the chunks in file order */
+		std::vector<size_t> voff( n + 1, 0 ), foff( n + 1, 0 );
+		for( int k = 0; k < n; k ++ )
+		{
+			voff[k+1] = voff[k] + chunks[k].m_vertices.size();
+			foff[k+1] = foff[k] + chunks[k].m_faces.size();
+			m_has_uv  = m_has_uv  || chunks[k].m_has_uv;
+			m_has_rgb = m_has_rgb || chunks[k].m_has_rgb;
+		}
+		m_vertex_array.resize( voff[n] );
+		std::vector<CFaceIds> ids( foff[n] );
+
+#pragma omp parallel for
+		for( int k = 0; k < n; k ++ )
+		{
+			std::copy( chunks[k].m_vertices.begin(), chunks[k].m_vertices.end(), m_vertex_array.begin() + voff[k] );
+			std::copy( chunks[k].m_faces.begin(), chunks[k].m_faces.end(), ids.begin() + foff[k] );
+			std::vector<CVertex>().swap( chunks[k].m_vertices );
+			std::vector<CFaceIds>().swap( chunks[k].m_faces );
+		}
+
+		build_id_table();
+
+		/* resolve the corners, faces with a missing vertex are dropped */
+		int nf = (int) ids.size();
+		std::vector<char> valid( nf, 1 );
+#pragma omp parallel for
+		for( int i = 0; i < nf; i ++ )
+			for( int j = 0; j < 3; j ++ )
+				if( vertex_index( ids[i].m_v[j] ) < 0 ) valid[i] = 0;
+
+		int missing = 0;
+		for( int i = 0; i < nf; i ++ ) missing += !valid[i];
+		if( missing )
+			std::cerr << "Error in reading face, " << missing << " faces refer to missing vertices" << std::endl;
+
+		std::vector<int> slot( nf );
+		for( int i = 0, k = 0; i < nf; i ++ ) { slot[i] = k; k += valid[i]; }
+
+		m_face_array.resize( nf - missing );
+#pragma omp parallel for
+		for( int i = 0; i < nf; i ++ )
+		{
+			if( !valid[i] ) continue;
+			CFace & f = m_face_array[ slot[i] ];
+			f.m_id   = ids[i].m_id;
+			f.m_area = 0;
+			for( int j = 0; j < 3; j ++ )
+				f.m_v[j] = &m_vertex_array[ vertex_index( ids[i].m_v[j] ) ];
+		}
+
+		m_vertices.resize( m_vertex_array.size() );
+		for( size_t i = 0; i < m_vertex_array.size(); i ++ ) m_vertices[i] = &m_vertex_array[i];
+		m_faces.resize( m_face_array.size() );
+		for( size_t i = 0; i < m_face_array.size(); i ++ ) m_faces[i] = &m_face_array[i];
+
+		return true;
+	}
+};
+
+class CObjVertex
+{
+public:
+	int m_ipt;
+	int m_iuv;
+	int m_inl;
+};
+
+class CObjFace
+{
+public:
+	CObjVertex m_v[3];
+	double m_area;
+	CPoint m_normal;
+};
+
+/*!
+ *	\brief CObject class
+ *
+ *  Triangles of an .obj file, polygons are split into fans. read maps the file and parses
+ *  it in line aligned chunks in parallel, like CTriangleMesh::read_m.
+ */
+class CObject
+{
+public:
+	CObject() 
+	{ 
+		m_has_uv = false;
+		m_has_normal = false;
+	}
+	
+	/*! read an .obj file, returns false if it can not be opened */
+	bool read( const char * input );
+
+	std::vector<CPoint>  & points()  { return m_points;  };
+	std::vector<CPoint2> & uvs()     { return m_uvs;     };
+	std::vector<CPoint>  & normals() { return m_normals; };
+	std::vector<CObjFace> & faces()  { return m_faces;   };
+protected:
+
+	std::vector<CPoint>   m_points;
+	std::vector<CPoint2>  m_uvs;
+	std::vector<CPoint>   m_normals;
+
+	std::vector<CObjFace> m_faces;
+
+	/*! corner index relative to the end of its chunk's list, resolved after the concatenation */
+	class CRelative
+	{
+	public:
+		size_t m_face;
+		int    m_corner;
+		int    m_kind;
+	};
+
+	/*! lists of one chunk */
+	class CChunk
+	{
+	public:
+		CChunk() { m_has_uv = m_has_normal = false; };
+		std::vector<CPoint>    m_points;
+		std::vector<CPoint2>   m_uvs;
+		std::vector<CPoint>    m_normals;
+		std::vector<CObjFace>  m_faces;
+		std::vector<CRelative> m_relative;
+		bool m_has_uv;
+		bool m_has_normal;
+	};
+
+	static void read_chunk( const char * p, const char * end, CChunk & chunk );
+
+public:
+
+	bool m_has_uv;
+	bool m_has_normal;
+};
+
+/*! parse the v, vt, vn and f lines of [p,end) */
+inline void CObject::read_chunk( const char * p, const char * end, CChunk & chunk )
+{
+	while( p < end )
+	{
+		const char * line = skip_blank( p, end );
+		const char * eol  = (const char *) memchr( line, '\n', end - line );
+		if( eol == NULL ) eol = end;
+		p = ( eol < end )? eol + 1: end;
+
+		if( match_keyword( line, eol, "v", 1 ) )
+		{
+			CPoint v;
+			const char * q = line + 1;
+			for( int i = 0; i < 3; i ++ ) scan_double( q, eol, v[i] );
+			chunk.m_points.push_back( v );
+			continue;
+		}
+		if( match_keyword( line, eol, "vt", 2 ) )
+		{
+			CPoint2 uv;
+			const char * q = line + 2;
+			for( int i = 0; i < 2; i ++ ) scan_double( q, eol, uv[i] );
+			chunk.m_uvs.push_back( uv );
+			continue;
+		}
+		if( match_keyword( line, eol, "vn", 2 ) )
+		{
+			CPoint n;
+			const char * q = line + 2;
+			for( int i = 0; i < 3; i ++ ) scan_double( q, eol, n[i] );
+			chunk.m_normals.push_back( n );
+			continue;
+		}
+		if( !match_keyword( line, eol, "f", 1 ) ) continue;
+
+		/* corners v, v/t, v//n or v/t/n; 0 for a missing index */
+		int corner[3][3];
+		int count = 0;
+		const char * q = line + 1;
+		while( true )
+		{
+			int c[3] = { 0, 0, 0 };
+			if( !scan_int( q, eol, c[0] ) ) break;
+			for( int k = 1; k < 3 && q < eol && *q == '/'; k ++ )
+			{
+				q ++;
+				if( q < eol && *q != '/' ) scan_int( q, eol, c[k] );
+			}
+
+			/* fan: the first corner, the previous corner, this corner */
+			int slot = ( count < 3 )? count: 2;
+			if( count >= 3 ) for( int k = 0; k < 3; k ++ ) corner[1][k] = corner[2][k];
+			for( int k = 0; k < 3; k ++ ) corner[slot][k] = c[k];
+			count ++;
+			if( count < 3 ) continue;
+
+			CObjFace f;
+			f.m_area = 0;
+			size_t sizes[3] = { chunk.m_points.size(), chunk.m_uvs.size(), chunk.m_normals.size() };
+			for( int i = 0; i < 3; i ++ )
+			{
+				int * idx[3] = { &f.m_v[i].m_ipt, &f.m_v[i].m_iuv, &f.m_v[i].m_inl };
+				for( int k = 0; k < 3; k ++ )
+				{
+					int id = corner[i][k];
+					if( id > 0 ) *idx[k] = id - 1;
+					else if( id == 0 ) *idx[k] = 0;
+					else
+					{
+						*idx[k] = (int) sizes[k] + id;
+						CRelative r;
+						r.m_face = chunk.m_faces.size();
+						r.m_corner = i;
+						r.m_kind = k;
+						chunk.m_relative.push_back( r );
+					}
+				}
+			}
+			if( corner[0][1] ) chunk.m_has_uv = true;
+			if( corner[0][2] ) chunk.m_has_normal = true;
+			chunk.m_faces.push_back( f );
+		}
+	}
+}
+
+inline bool CObject::read( const char * input )
+{
+	CMappedFile file( input );
+	if( !file.valid() )
+	{
+		std::cerr << "Error in reading " << input << std::endl;
+		return false;
+	}
+
+	int n = CMappedFile::parallel_chunks( file.size() );
+	std::vector<const char*> bounds;
+	file.chunks( n, bounds );
+
+	std::vector<CChunk> chunks( n );
+#pragma omp parallel for schedule(dynamic)
+	for( int k = 0; k < n; k ++ )
+		read_chunk( bounds[k], bounds[k+1], chunks[k] );
+
+	/* offsets of the chunks in the concatenated lists, in file order */
+	std::vector<size_t> off[4];
+	for( int i = 0; i < 4; i ++ ) off[i].assign( n + 1, 0 );
+	for( int k = 0; k < n; k ++ )
+	{
+		off[0][k+1] = off[0][k] + chunks[k].m_points.size();
+		off[1][k+1] = off[1][k] + chunks[k].m_uvs.size();
+		off[2][k+1] = off[2][k] + chunks[k].m_normals.size();
+		off[3][k+1] = off[3][k] + chunks[k].m_faces.size();
+		m_has_uv     = m_has_uv     || chunks[k].m_has_uv;
+		m_has_normal = m_has_normal || chunks[k].m_has_normal;
+	}
+	m_points.resize( off[0][n] );
+	m_uvs.resize( off[1][n] );
+	m_normals.resize( off[2][n] );
+	m_faces.resize( off[3][n] );
+
+#pragma omp parallel for
+	for( int k = 0; k < n; k ++ )
+	{
+		CChunk & c = chunks[k];
+		for( size_t i = 0; i < c.m_relative.size(); i ++ )
+		{
+			CRelative & r = c.m_relative[i];
+			CObjVertex & v = c.m_faces[ r.m_face ].m_v[ r.m_corner ];
+			int * idx[3] = { &v.m_ipt, &v.m_iuv, &v.m_inl };
+			*idx[ r.m_kind ] += (int) off[ r.m_kind ][k];
+		}
+		std::copy( c.m_points.begin(),  c.m_points.end(),  m_points.begin()  + off[0][k] );
+		std::copy( c.m_uvs.begin(),     c.m_uvs.end(),     m_uvs.begin()     + off[1][k] );
+		std::copy( c.m_normals.begin(), c.m_normals.end(), m_normals.begin() + off[2][k] );
+		std::copy( c.m_faces.begin(),   c.m_faces.end(),   m_faces.begin()   + off[3][k] );
+		chunks[k] = CChunk();
+	}
+	return true;
+}
+
+}
+}
+#endif
+
+
+/* std::string version is slow
+
+void CObject::read( const char * input )
+{
+	std::ifstream file( input );
+
+	std::string line;
+
+	while( std::getline( file, line ) )
+	{
+		strutil::Tokenizer TK(line);
+
+		if( !TK.nextToken() ) continue;
+		std::string key = TK.getToken();
+
+		if( key == "v" )
+		{
+			CPoint p;
+			for(int i = 0; i < 3; i ++ )
+			{
+				TK.nextToken(" \n");
+				p[i] = strutil::parseString<double>( TK.getToken() );
+			}
+			m_points.push_back( p );
+			continue;
+		}
+
+		if( key == "vt" )
+		{
+			CPoint2 uv;
+			for(int i = 0; i < 2; i ++ )
+			{
+				TK.nextToken(" \n");
+				uv[i] = strutil::parseString<double>( TK.getToken() );
+			}
+			m_uvs.push_back( uv );
+			continue;
+		}
+
+		if( key == "vn" )
+		{
+			CPoint n;
+			for(int i = 0; i < 3; i ++ )
+			{
+				TK.nextToken(" \n");
+				n[i] = strutil::parseString<double>( TK.getToken() );
+			}
+			m_normals.push_back( n );
+			continue;
+		}
+
+		if( key == "f" )
+		{
+			CObjFace pf;
+			for( int i = 0; i < 3; i ++ )
+			{
+				TK.nextToken(" \n");			
+				strutil::Tokenizer STK( TK.getToken(), "/ \n" );
+
+				STK.nextToken();
+				pf.m_v[i].m_ipt = strutil::parseString<int>( STK.getToken() )-1;
+
+				if( STK.nextToken() )
+				{
+					pf.m_v[i].m_iuv = strutil::parseString<int>( STK.getToken() )-1;
+					m_has_uv = true;
+				}
+
+				if( STK.nextToken() )
+				{
+					pf.m_v[i].m_inl = strutil::parseString<int>( STK.getToken() )-1;
+					m_has_normal = true;
+				}
+			}
+			m_faces.push_back(pf);
+		}
+		
+
+	}
+
+}
+*/
@@ -13,6 +13,8 @@
 #include <math.h>
 #include <complex>
 
+#include "../Geometry/HyperbolicBatch.h"
+
 namespace MeshLib{
 
 	enum HyperbolicLineType {CIRCLE, LINE};
@@ -41,29 +43,9 @@ public:
 			m_p[1] = z1;
 		}
 
-		std::complex<double> mid = (m_p[0]+m_p[1])/2.0;
-
-		if( std::abs( mid ) < 1e-10 ) 
-		{
-			m_type = LINE;
-			return;
-		}
-		else
-		{
-			m_type = CIRCLE;
-		}
-
-		std::complex<double> D = m_p[1] - m_p[0];
-		std::complex<double> d( -D.imag(), D.real() );
-
-
-		std::complex<double> t = ( 1.0 + m_p[0] * std::conj( m_p[0] ) - mid * std::conj( m_p[0] ) - std::conj( mid ) * m_p[0] )/( d * std::conj( m_p[0] ) + std::conj(d) * m_p[0] );
-
-		m_c = mid + d * t.real();
-		
-		m_r = std::abs( m_p[0] - m_c );
-
-		printf("%f %f\n", m_r - std::abs( m_p[1] - m_c ), std::norm( m_c ) -1 - m_r * m_r);
+		//the circle orthogonal to the unit circle through both points, a diameter if they are
+		//collinear with the origin
+		m_type = _hyperbolic_geodesic( m_p[0], m_p[1], m_c, m_r )? CIRCLE: LINE;
 	}
 	/*!
 	 *	CHyperbolicLine destructor
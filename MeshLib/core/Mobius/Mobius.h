@@ -76,7 +76,7 @@ protected:
 /*! 
  *	Compute the inverse mobius transformation
  */
-CMobius inverse( CMobius & mob )
+inline CMobius inverse( CMobius & mob )
 {
 	CMobius imb;
 	imb.m_theta = std::conj( mob.m_theta );
@@ -87,7 +87,7 @@ CMobius inverse( CMobius & mob )
 /*!
  *	Compose Mobius transformation
  */
-CMobius operator*( CMobius & mob1, CMobius & mob2 )
+inline CMobius operator*( CMobius & mob1, CMobius & mob2 )
 {
 	Complex m1[2][2];
 	Complex m2[2][2];
@@ -0,0 +1,95 @@
+#include "MobiusBatch.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace MeshLib;
+
+//theta (z-z0)/(1-conj(z0) z), expanded to real arithmetic without branches so the loop vectorizes
+void MeshLib::_mobius( CMobius & mob, const double * re, const double * im, double * ore, double * oim, int n )
+{
+	const double ar = mob.z().real(),     ai = mob.z().imag();
+	const double tr = mob.theta().real(), ti = mob.theta().imag();
+
+	for( int i = 0; i < n; i ++ )
+	{
+		double x = re[i];
+		double y = im[i];
+		//numerator theta (z - z0)
+		double nr = x - ar, ni = y - ai;
+		double pr = tr * nr - ti * ni;
+		double pi = tr * ni + ti * nr;
+		//denominator 1 - conj(z0) z
+		double dr = 1.0 - ( ar * x + ai * y );
+		double di = ai * x - ar * y;
+		double s  = 1.0 / ( dr * dr + di * di );
+
+		ore[i] = ( pr * dr + pi * di ) * s;
+		oim[i] = ( pi * dr - pr * di ) * s;
+	}
+}
+
+void MeshLib::_mobius( CMobius & mob, CComplexArray & z )
+{
+	_mobius( mob, z.re(), z.im(), z.re(), z.im(), z.size() );
+}
+
+//energy of the transformed uv in the buffers, with L_f = log( |A_f| / w_f ) and the total area A,
+//E = sum w_f ( L_f - log A )^2 is accumulated in one pass over the faces
+double CMobiusDistortion::_energy( CMobius & mob, double * re, double * im )
+{
+	int nv = m_uv.size();
+	int nf = (int) m_weight.size();
+	if( nf == 0 ) return 0;
+
+	_mobius( mob, m_uv.re(), m_uv.im(), re, im, nv );
+
+	const int    * fv = &m_faces[0];
+	const double * wf = &m_weight[0];
+	const double tiny = 1e-300;
+
+	double total = 0, sw = 0, sl = 0, sl2 = 0;
+	for( int f = 0; f < nf; f ++ )
+	{
+		int i = fv[3*f], j = fv[3*f+1], k = fv[3*f+2];
+		double a = fabs( ( re[j] - re[i] ) * ( im[k] - im[i] ) - ( im[j] - im[i] ) * ( re[k] - re[i] ) ) / 2.0;
+		double w = wf[f];
+		total += a;
+		if( w <= 0 ) continue;
+		double l = log( ( a + tiny ) / w );
+		sw  += w;
+		sl  += w * l;
+		sl2 += w * l * l;
+	}
+	if( total <= 0 ) return 0;
+
+	double c = log( total );
+	return sl2 - 2 * c * sl + c * c * sw;
+}
+
+double CMobiusDistortion::_energy( CMobius & mob )
+{
+	CComplexArray buffer( m_uv.size() );
+	return _energy( mob, buffer.re(), buffer.im() );
+}
+
+//each thread owns one pair of buffers, the candidates are spread over the threads
+int CMobiusDistortion::_energy( std::vector<CMobius> & candidates, std::vector<double> & energy )
+{
+	int num = (int) candidates.size();
+	energy.assign( num, 0 );
+
+#pragma omp parallel
+	{
+		CComplexArray buffer( m_uv.size() );
+#pragma omp for schedule(dynamic)
+		for( int i = 0; i < num; i ++ )
+			energy[i] = _energy( candidates[i], buffer.re(), buffer.im() );
+	}
+
+	int best = -1;
+	for( int i = 0; i < num; i ++ )
+		if( best < 0 || energy[i] < energy[best] ) best = i;
+	return best;
+}
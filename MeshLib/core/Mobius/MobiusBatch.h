@@ -0,0 +1,158 @@
+/*! \file MobiusBatch.h
+*   \brief Mobius transformations applied to arrays of complex numbers
+*
+*   Structure of arrays uv coordinates, whole mesh Mobius normalization and the
+*   area distortion of many candidate transformations
+*/
+#ifndef  _MOBIUS_BATCH_H_
+#define  _MOBIUS_BATCH_H_
+
+#include <map>
+#include <vector>
+#include <cmath>
+
+#include "Mobius.h"
+#include "../Geometry/Point.h"
+#include "../Geometry/Point2.h"
+
+namespace MeshLib
+{
+	/*!	CComplexArray class
+	 *
+	 *	Complex numbers stored as separate real and imaginary arrays, such that
+	 *	the transformation loops run over contiguous doubles.
+	 */
+	class CComplexArray
+	{
+	public:
+		CComplexArray() {};
+		CComplexArray( int n ) { resize( n ); };
+		~CComplexArray() {};
+
+		void resize( int n ) { m_re.resize( n ); m_im.resize( n ); };
+		int  size() const    { return (int) m_re.size(); };
+		/*! the i-th number */
+		Complex get( int i ) const { return Complex( m_re[i], m_im[i] ); };
+		/*! set the i-th number */
+		void set( int i, Complex z ) { m_re[i] = z.real(); m_im[i] = z.imag(); };
+
+		double * re() { return m_re.empty()? NULL: &m_re[0]; };
+		double * im() { return m_im.empty()? NULL: &m_im[0]; };
+
+	protected:
+		std::vector<double> m_re;
+		std::vector<double> m_im;
+	};
+
+	/*!	Apply the Mobius transformation to n numbers, the output may alias the input
+	 *  \param mob the transformation \f$ e^{i\theta}(z-z_0)/(1-\bar{z}_0 z) \f$
+	 */
+	void _mobius( CMobius & mob, const double * re, const double * im, double * ore, double * oim, int n );
+	/*!	Apply the Mobius transformation to the whole array in place */
+	void _mobius( CMobius & mob, CComplexArray & z );
+
+	/*!	CMobiusDistortion class
+	 *
+	 *	Area distortion of a disk parameterization after a Mobius transformation,
+	 *	\f$ E = \sum_f w_f \log^2( a_f / w_f ) \f$, where \f$w_f\f$ and \f$a_f\f$ are the
+	 *	normalized 3D and uv areas of face f. Many candidate transformations are
+	 *	evaluated in parallel, one per thread at a time, each thread transforms the
+	 *	uv into its own buffers.
+	 */
+	class CMobiusDistortion
+	{
+	public:
+		CMobiusDistortion() {};
+		~CMobiusDistortion() {};
+
+		/*! collect the vertex uv, the faces and the 3D face areas of a mesh
+		 *  \tparam M mesh class, which defines MeshVertexIterator, MeshFaceIterator and FaceVertexIterator
+		 *  \tparam V vertex class, with point() and uv()
+		 */
+		template<typename M, typename V, typename F>
+		void _build( M * pMesh );
+
+		/*! energy of one transformation */
+		double _energy( CMobius & mob );
+		/*! energies of all the candidate transformations
+		 *  \param candidates the transformations
+		 *  \param energy energy of each candidate
+		 *  \return index of the candidate with the least energy, -1 if none
+		 */
+		int _energy( std::vector<CMobius> & candidates, std::vector<double> & energy );
+
+		/*! apply the transformation to the uv and write them back to the vertices of the mesh,
+		 *  which has been collected by _build
+		 */
+		template<typename M, typename V>
+		void _normalize( M * pMesh, CMobius & mob );
+
+		/*! vertex uv, in the order of MeshVertexIterator */
+		CComplexArray & uv() { return m_uv; };
+
+	protected:
+		/*! energy of the transformed uv in the buffers */
+		double _energy( CMobius & mob, double * re, double * im );
+
+		CComplexArray       m_uv;
+		/*! vertex indices, 3 per face */
+		std::vector<int>    m_faces;
+		/*! normalized 3D face areas */
+		std::vector<double> m_weight;
+	};
+
+	//collect the vertex uv, the faces and the normalized 3D face areas
+	template<typename M, typename V, typename F>
+	void CMobiusDistortion::_build( M * pMesh )
+	{
+		std::map<V*,int> index;
+		std::vector<V*>  verts;
+		for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); ++ viter )
+		{
+			V * v = *viter;
+			index[v] = (int) verts.size();
+			verts.push_back( v );
+		}
+
+		m_uv.resize( (int) verts.size() );
+		for( size_t i = 0; i < verts.size(); i ++ )
+			m_uv.set( (int) i, Complex( verts[i]->uv()[0], verts[i]->uv()[1] ) );
+
+		m_faces.clear();
+		m_weight.clear();
+		double total = 0;
+		for( typename M::MeshFaceIterator fiter( pMesh ); !fiter.end(); ++ fiter )
+		{
+			F * f = *fiter;
+			CPoint p[3];
+			int k = 0;
+			for( typename M::FaceVertexIterator fviter( f ); !fviter.end(); ++ fviter, ++ k )
+			{
+				V * v = *fviter;
+				m_faces.push_back( index[v] );
+				p[k] = v->point();
+			}
+			double a = ( ( p[1] - p[0] ) ^ ( p[2] - p[0] ) ).norm() / 2.0;
+			m_weight.push_back( a );
+			total += a;
+		}
+		if( total > 0 )
+			for( size_t i = 0; i < m_weight.size(); i ++ ) m_weight[i] /= total;
+	};
+
+	//transform the uv and write them back to the vertices
+	template<typename M, typename V>
+	void CMobiusDistortion::_normalize( M * pMesh, CMobius & mob )
+	{
+		_mobius( mob, m_uv );
+
+		int i = 0;
+		for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); ++ viter, ++ i )
+		{
+			V * v = *viter;
+			v->uv() = CPoint2( m_uv.re()[i], m_uv.im()[i] );
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,237 @@
+#include "MobiusTiling.h"
+#include "../Geometry/HyperbolicBatch.h"
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace MeshLib;
+
+CMobiusTiling::CMobiusTiling()
+{
+	m_domain_center = Complex( 0, 0 );
+	m_domain_radius = 0;
+	m_tolerance = 0.4;
+	m_separation = 0;
+	m_scale = 0;
+	m_min_pixels = 0;
+}
+
+int CMobiusTiling::add_generator( CMobius & mob )
+{
+	m_generators.push_back( mob );
+	m_tiles.clear();
+	m_levels.clear();
+	return (int) m_generators.size() - 1;
+}
+
+//centroid of the uv, and the largest hyperbolic distance from it
+void CMobiusTiling::_bound( CComplexArray & uv )
+{
+	int n = uv.size();
+	if( n == 0 ) return;
+
+	Complex c( 0, 0 );
+	for( int i = 0; i < n; i ++ ) c += uv.get( i );
+	c /= (double) n;
+
+	std::vector<double> d( n );
+	_hyperbolic_distance( c, uv.re(), uv.im(), &d[0], n );
+
+	double r = 0;
+	for( int i = 0; i < n; i ++ ) if( d[i] > r ) r = d[i];
+
+	domain( c, r );
+}
+
+void CMobiusTiling::_circle( CMobius & mob, Complex & center, double & radius )
+{
+	_hyperbolic_circle( mob * m_domain_center, m_domain_radius, center, radius );
+}
+
+//hyperbolic distance by which mob moves the domain center
+double CMobiusTiling::_displacement( CMobius & mob )
+{
+	return _hyperbolic_distance( mob * m_domain_center, m_domain_center );
+}
+
+//two transformations are the same if they move the domain center and one more point to the same places,
+//up to the tolerance times the shorter displacement of the two
+bool CMobiusTiling::_same( CMobius & a, CMobius & b )
+{
+	Complex c  = m_domain_center;
+	Complex c2 = c + Complex( 0.5 * ( 1.0 - std::abs( c ) ), 0 );
+	double da  = _displacement( a );
+	double db  = _displacement( b );
+	double tol = m_tolerance * ( ( da < db )? da: db );
+
+	return _hyperbolic_distance( a * c, b * c ) < tol && _hyperbolic_distance( a * c2, b * c2 ) < tol;
+}
+
+int CMobiusTiling::find_generator( CMobius & mob )
+{
+	for( size_t i = 0; i < m_generators.size(); i ++ )
+		if( _same( m_generators[i], mob ) ) return (int) i;
+	return -1;
+}
+
+//g h is the identity if it moves the domain center and one more point by less than the tolerance times
+//the displacement of g; the shortest displacement of the generators is the separation of the tiles
+void CMobiusTiling::_inverses()
+{
+	Complex c  = m_domain_center;
+	Complex c2 = c + Complex( 0.5 * ( 1.0 - std::abs( c ) ), 0 );
+
+	int ng = (int) m_generators.size();
+	m_inverse.assign( ng, -1 );
+
+	for( int i = 0; i < ng; i ++ )
+	{
+		if( m_inverse[i] >= 0 ) continue;
+		double tol = m_tolerance * _displacement( m_generators[i] );
+		for( int j = 0; j < ng; j ++ )
+		{
+			if( m_inverse[j] >= 0 ) continue;
+			CMobius m = m_generators[i] * m_generators[j];
+			if( _hyperbolic_distance( m * c, c ) < tol && _hyperbolic_distance( m * c2, c2 ) < tol )
+			{
+				m_inverse[i] = j;
+				m_inverse[j] = i;
+				break;
+			}
+		}
+		if( m_inverse[i] >= 0 ) continue;
+
+		m_generators.push_back( inverse( m_generators[i] ) );
+		m_inverse.push_back( i );
+		m_inverse[i] = (int) m_generators.size() - 1;
+	}
+
+	m_separation = 0;
+	for( size_t i = 0; i < m_generators.size(); i ++ )
+	{
+		double d = _displacement( m_generators[i] );
+		if( i == 0 || d < m_separation ) m_separation = d;
+	}
+}
+
+//tiles are hashed by the image of the domain center, with cells of half the tolerance;
+//the Euclidean distance is at most half the hyperbolic one, so a duplicate is in a neighboring cell
+int CMobiusTiling::_insert( CTile & tile )
+{
+	double tol  = m_tolerance * m_separation;
+	double cell = tol / 2.0;
+	if( cell <= 0 ) cell = 1e-9;
+
+	Complex z = tile.m_mobius * m_domain_center;
+	long long x = (long long) floor( z.real() / cell );
+	long long y = (long long) floor( z.imag() / cell );
+
+	for( long long i = x - 1; i <= x + 1; i ++ )
+	for( long long j = y - 1; j <= y + 1; j ++ )
+	{
+		std::map< std::pair<long long,long long>, std::vector<int> >::iterator iter = m_grid.find( std::make_pair( i, j ) );
+		if( iter == m_grid.end() ) continue;
+		std::vector<int> & ids = iter->second;
+		for( size_t k = 0; k < ids.size(); k ++ )
+		{
+			Complex w = m_tiles[ ids[k] ].m_mobius * m_domain_center;
+			if( _hyperbolic_distance( z, w ) < tol ) return -1;
+		}
+	}
+
+	int id = (int) m_tiles.size();
+	m_tiles.push_back( tile );
+	m_grid[ std::make_pair( x, y ) ].push_back( id );
+	return id;
+}
+
+void CMobiusTiling::_write( FILE * fp, int id )
+{
+	CTile & t = m_tiles[id];
+	fprintf( fp, "Tile %d %d %d %d %.17g %.17g %.17g %.17g %.17g %.17g %.17g\n", id, t.m_parent, t.m_generator, t.m_depth,
+		t.m_mobius.z().real(), t.m_mobius.z().imag(), t.m_mobius.theta().real(), t.m_mobius.theta().imag(),
+		t.m_center.real(), t.m_center.imag(), t.m_radius );
+}
+
+void CMobiusTiling::word( int tile, std::vector<int> & w )
+{
+	w.clear();
+	for( int t = tile; t >= 0 && m_tiles[t].m_generator >= 0; t = m_tiles[t].m_parent )
+		w.push_back( m_tiles[t].m_generator );
+	std::reverse( w.begin(), w.end() );
+}
+
+//expand one word length at a time, the candidates are composed in parallel and merged in order
+int CMobiusTiling::_enumerate( int depth, double scale, double min_pixels, FILE * fp )
+{
+	if( m_tiles.empty() || scale != m_scale || min_pixels != m_min_pixels )
+	{
+		m_tiles.clear();
+		m_levels.clear();
+		m_grid.clear();
+		m_scale = scale;
+		m_min_pixels = min_pixels;
+
+		_inverses();
+
+		CTile root;
+		_circle( root.m_mobius, root.m_center, root.m_radius );
+		_insert( root );
+		m_levels.push_back( 0 );
+		m_levels.push_back( 1 );
+
+		if( fp != NULL )
+		{
+			for( size_t i = 0; i < m_generators.size(); i ++ )
+				fprintf( fp, "Generator %d %d %.17g %.17g %.17g %.17g\n", (int) i, m_inverse[i],
+					m_generators[i].z().real(), m_generators[i].z().imag(), m_generators[i].theta().real(), m_generators[i].theta().imag() );
+			_write( fp, 0 );
+		}
+	}
+
+	int ng = (int) m_generators.size();
+
+	for( int d = (int) m_levels.size() - 1; d <= depth; d ++ )
+	{
+		int begin = m_levels[d-1];
+		int end   = m_levels[d];
+		if( begin == end ) break;
+
+		int np = end - begin;
+		std::vector<CTile> candidates( np * ng );
+		std::vector<int>   valid( np * ng, 0 );
+
+#pragma omp parallel for schedule(static)
+		for( int i = 0; i < np; i ++ )
+		{
+			CTile & parent = m_tiles[ begin + i ];
+			for( int g = 0; g < ng; g ++ )
+			{
+				//reduced words only
+				if( parent.m_generator >= 0 && g == m_inverse[ parent.m_generator ] ) continue;
+
+				CTile & c = candidates[ i * ng + g ];
+				c.m_parent    = begin + i;
+				c.m_generator = g;
+				c.m_depth     = d;
+				c.m_mobius    = parent.m_mobius * m_generators[g];
+				_circle( c.m_mobius, c.m_center, c.m_radius );
+
+				valid[ i * ng + g ] = ( 2.0 * c.m_radius * scale >= min_pixels );
+			}
+		}
+
+		for( int k = 0; k < np * ng; k ++ )
+		{
+			if( !valid[k] ) continue;
+			int id = _insert( candidates[k] );
+			if( id >= 0 && fp != NULL ) _write( fp, id );
+		}
+		m_levels.push_back( (int) m_tiles.size() );
+	}
+
+	return (int) m_tiles.size();
+}
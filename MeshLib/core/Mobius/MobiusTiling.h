@@ -0,0 +1,133 @@
+/*! \file MobiusTiling.h
+*   \brief Tiling of the Poincare disk by the orbit of a fundamental domain
+*
+*   Group words of the deck transformations are enumerated breadth first, each
+*   tile stores its composed Mobius transformation, such that a word is composed
+*   from its prefix by one multiplication.
+*/
+#ifndef  _MOBIUS_TILING_H_
+#define  _MOBIUS_TILING_H_
+
+#include <map>
+#include <vector>
+#include <stdio.h>
+
+#include "Mobius.h"
+#include "MobiusBatch.h"
+
+namespace MeshLib
+{
+	/*!	CTile class
+	 *
+	 *	Node of the word trie, one image of the fundamental domain. The word of a
+	 *	tile is the word of its parent followed by its generator, the transformation
+	 *	is the product of the parent transformation and the generator.
+	 */
+	class CTile
+	{
+	public:
+		CTile() { m_parent = -1; m_generator = -1; m_depth = 0; m_radius = 0; };
+	public:
+		/*! parent tile, -1 for the fundamental domain */
+		int     m_parent;
+		/*! last generator of the word, -1 for the fundamental domain */
+		int     m_generator;
+		/*! word length */
+		int     m_depth;
+		/*! composed transformation */
+		CMobius m_mobius;
+		/*! Euclidean bounding circle of the tile */
+		Complex m_center;
+		double  m_radius;
+	};
+
+	/*!	CMobiusTiling class
+	 *
+	 *	Covering space tiling generator. The tiles of one word length are expanded
+	 *	in parallel, then the candidates are culled and merged in order, so the tiles
+	 *	do not depend on the number of threads. A candidate is dropped if
+	 *	-	its word ends with g g^{-1},
+	 *	-	its bounding circle is smaller than the pixel threshold, its subtree is not expanded,
+	 *	-	it is an existing tile, reached by another word because of the group relations.
+	 *	Calling _enumerate again with a larger depth and the same threshold extends the
+	 *	existing trie.
+	 *
+	 *	The output is instanced: the fundamental domain mesh is written once by the
+	 *	caller, the tiles are streamed as transformations while they are generated.
+	 */
+	class CMobiusTiling
+	{
+	public:
+		CMobiusTiling();
+		~CMobiusTiling() {};
+
+		/*! add a deck transformation, the missing inverses are added by _enumerate
+		 *  \return the generator index
+		 */
+		int  add_generator( CMobius & mob );
+		/*! hyperbolic bounding circle of the fundamental domain */
+		void domain( Complex center, double radius ) { m_domain_center = center; m_domain_radius = radius; m_tiles.clear(); m_levels.clear(); };
+		/*! bounding circle of the fundamental domain from its uv, centered at the centroid */
+		void _bound( CComplexArray & uv );
+
+		/*! enumerate the tiles
+		 *  \param depth maximal word length
+		 *  \param scale pixels per unit length of the disk
+		 *  \param min_pixels tiles whose bounding circle diameter is below min_pixels are culled
+		 *  \param fp if not NULL, the new tiles are written to it as they are generated
+		 *  \return number of tiles
+		 */
+		int  _enumerate( int depth, double scale, double min_pixels, FILE * fp = NULL );
+
+		/*! tolerance for identifying transformations and tiles, relative to how far they move the
+		 *  domain center; the deck transformations computed from a mesh carry its discretization
+		 *  error, which grows with the word length
+		 */
+		double & tolerance() { return m_tolerance; };
+		/*! whether two transformations agree on the domain, up to the tolerance */
+		bool _same( CMobius & a, CMobius & b );
+		/*! index of the generator which is the same as mob, -1 if none */
+		int  find_generator( CMobius & mob );
+
+		/*! generators */
+		std::vector<CMobius> & generators() { return m_generators; };
+		/*! tiles, in the breadth first order */
+		std::vector<CTile>   & tiles()      { return m_tiles; };
+		/*! word of a tile, as generator indices */
+		void word( int tile, std::vector<int> & w );
+
+	protected:
+		/*! distance by which mob moves the domain center */
+		double _displacement( CMobius & mob );
+		/*! pair each generator with its inverse */
+		void _inverses();
+		/*! Euclidean bounding circle of the image of the domain under mob */
+		void _circle( CMobius & mob, Complex & center, double & radius );
+		/*! add the tile if it is not a duplicate, returns the tile index or -1 */
+		int  _insert( CTile & tile );
+		/*! write one tile */
+		void _write( FILE * fp, int id );
+
+		std::vector<CMobius> m_generators;
+		/*! index of the inverse generator */
+		std::vector<int>     m_inverse;
+
+		Complex m_domain_center;
+		double  m_domain_radius;
+		double  m_tolerance;
+		/*! shortest displacement of the domain center by a generator */
+		double  m_separation;
+
+		std::vector<CTile>   m_tiles;
+		/*! tiles of word length k are m_tiles[ m_levels[k] .. m_levels[k+1] ) */
+		std::vector<int>     m_levels;
+		/*! culling threshold of the current trie */
+		double m_scale;
+		double m_min_pixels;
+
+		/*! tiles hashed by the grid cell of their centers */
+		std::map< std::pair<long long,long long>, std::vector<int> > m_grid;
+	};
+};
+
+#endif
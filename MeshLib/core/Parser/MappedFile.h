@@ -0,0 +1,238 @@
+/*!
+*      \file MappedFile.h
+*      \brief Memory mapped input file, split into line aligned chunks for parallel parsing
+*
+*/
+
+#ifndef _MESHLIB_MAPPED_FILE_H_
+#define _MESHLIB_MAPPED_FILE_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MeshLib
+{
+
+/*!
+ *	\brief CMappedFile class
+ *
+ *  Read only view of a whole file. The text is not terminated by a zero, the scanning
+ *  functions below take the end of the text and never read past it.
+ */
+class CMappedFile
+{
+public:
+	/*!
+	 *	CMappedFile constructor
+	 *  \param name input file name
+	 */
+	CMappedFile( const char * name )
+	{
+		m_data = NULL;
+		m_size = 0;
+#ifdef _WIN32
+		m_file = CreateFileA( name, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+		m_mapping = NULL;
+		if( m_file == INVALID_HANDLE_VALUE ) return;
+		LARGE_INTEGER size;
+		if( !GetFileSizeEx( m_file, &size ) || size.QuadPart == 0 ) return;
+		m_mapping = CreateFileMappingA( m_file, NULL, PAGE_READONLY, 0, 0, NULL );
+		if( m_mapping == NULL ) return;
+		m_data = (const char *) MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 );
+		if( m_data != NULL ) m_size = (size_t) size.QuadPart;
+#else
+		m_fd = open( name, O_RDONLY );
+		if( m_fd < 0 ) return;
+		struct stat st;
+		if( fstat( m_fd, &st ) != 0 || st.st_size == 0 ) return;
+		void * p = mmap( NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0 );
+		if( p == MAP_FAILED ) return;
+		madvise( p, (size_t) st.st_size, MADV_WILLNEED );
+		m_data = (const char *) p;
+		m_size = (size_t) st.st_size;
+#endif
+	};
+	/*! unmap and close the file */
+	~CMappedFile()
+	{
+#ifdef _WIN32
+		if( m_data != NULL ) UnmapViewOfFile( m_data );
+		if( m_mapping != NULL ) CloseHandle( m_mapping );
+		if( m_file != INVALID_HANDLE_VALUE ) CloseHandle( m_file );
+#else
+		if( m_data != NULL ) munmap( (void *) m_data, m_size );
+		if( m_fd >= 0 ) close( m_fd );
+#endif
+	};
+
+	/*! whether the file is open and not empty */
+	bool valid() const { return m_data != NULL; };
+	/*! first character */
+	const char * begin() const { return m_data; };
+	/*! one past the last character */
+	const char * end() const { return m_data + m_size; };
+	/*! file size in bytes */
+	size_t size() const { return m_size; };
+
+	/*!
+	 *	split the text into n chunks of about equal size, every chunk but the last ends
+	 *	right after a newline, so no line is cut
+	 *  \param n number of chunks
+	 *  \param bounds chunk k is [bounds[k], bounds[k+1])
+	 */
+	void chunks( int n, std::vector<const char*> & bounds ) const
+	{
+		bounds.assign( n + 1, end() );
+		bounds[0] = begin();
+		for( int k = 1; k < n; k ++ )
+		{
+			const char * p = begin() + m_size / n * k;
+			if( p < bounds[k-1] ) p = bounds[k-1];
+			while( p < end() && *p != '\n' ) p ++;
+			bounds[k] = ( p < end() )? p + 1: end();
+		}
+	};
+
+	/*! number of chunks for a parallel parse, several per thread to balance lines of unequal cost */
+	static int parallel_chunks( size_t size )
+	{
+		int threads = 1;
+#ifdef _OPENMP
+		threads = omp_get_max_threads();
+#endif
+		size_t n = size / ( 1 << 20 ) + 1;
+		if( n > (size_t) ( 4 * threads ) ) n = 4 * threads;
+		return (int) n;
+	};
+
+protected:
+	const char * m_data;
+	size_t       m_size;
+#ifdef _WIN32
+	HANDLE       m_file;
+	HANDLE       m_mapping;
+#else
+	int          m_fd;
+#endif
+};
+
+/*! skip spaces and tabs */
+inline const char * skip_blank( const char * p, const char * end )
+{
+	while( p < end && ( *p == ' ' || *p == '\t' ) ) p ++;
+	return p;
+}
+
+/*! first character of the next line */
+inline const char * next_line( const char * p, const char * end )
+{
+	const char * q = (const char *) memchr( p, '\n', end - p );
+	return ( q == NULL )? end: q + 1;
+}
+
+/*! whether the text at p starts with the keyword followed by a blank */
+inline bool match_keyword( const char * p, const char * end, const char * key, size_t len )
+{
+	return (size_t)( end - p ) > len && memcmp( p, key, len ) == 0 && ( p[len] == ' ' || p[len] == '\t' );
+}
+
+/*! read a decimal integer after optional blanks, p is moved past it */
+inline bool scan_int( const char * & p, const char * end, int & value )
+{
+	p = skip_blank( p, end );
+	bool neg = false;
+	if( p < end && ( *p == '-' || *p == '+' ) ) neg = ( *p++ == '-' );
+	if( p == end || *p < '0' || *p > '9' ) return false;
+	long long v = 0;
+	while( p < end && *p >= '0' && *p <= '9' ) v = v * 10 + ( *p++ - '0' );
+	value = (int)( neg? -v: v );
+	return true;
+}
+
+/*!
+ *	read a floating point number after optional blanks, p is moved past it. Numbers with at
+ *	most 15 significant digits and a small exponent are exact in double arithmetic and are
+ *	converted directly, the others go through strtod, so the result is always that of strtod.
+ */
+inline bool scan_double( const char * & p, const char * end, double & value )
+{
+	static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+	p = skip_blank( p, end );
+	const char * start = p;
+	const char * q = p;
+
+	bool neg = false;
+	if( q < end && ( *q == '-' || *q == '+' ) ) neg = ( *q++ == '-' );
+
+	unsigned long long m = 0;
+	int digits = 0, scale = 0, seen = 0;
+	while( q < end && *q >= '0' && *q <= '9' )
+	{
+		if( m || *q != '0' ) digits ++;
+		m = m * 10 + ( *q++ - '0' );
+		seen ++;
+		if( digits > 15 ) break;
+	}
+	if( q < end && *q == '.' )
+	{
+		q ++;
+		while( q < end && *q >= '0' && *q <= '9' && digits <= 15 )
+		{
+			if( m || *q != '0' ) digits ++;
+			m = m * 10 + ( *q++ - '0' );
+			scale --;
+			seen ++;
+		}
+	}
+	bool fast = seen > 0 && digits <= 15 && !( q < end && *q >= '0' && *q <= '9' );
+	if( fast && q < end && ( *q == 'e' || *q == 'E' ) )
+	{
+		const char * r = q + 1;
+		int e;
+		if( scan_int( r, end, e ) && r - q - 1 < 6 && q[1] != ' ' && q[1] != '\t' ) { scale += e; q = r; }
+		else fast = false;
+	}
+	if( fast && q < end && ( ( *q >= 'a' && *q <= 'z' ) || ( *q >= 'A' && *q <= 'Z' ) ) ) fast = false;
+
+	if( fast && scale >= -22 && scale <= 22 )
+	{
+		double v = (double) m;
+		v = ( scale < 0 )? v / pow10[-scale]: v * pow10[scale];
+		value = neg? -v: v;
+		p = q;
+		return true;
+	}
+
+	/* long mantissa, large exponent, inf or nan */
+	char buffer[128];
+	size_t n = 0;
+	while( start + n < end && n + 1 < sizeof(buffer) && start[n] != ' ' && start[n] != '\t' &&
+		start[n] != '\n' && start[n] != '\r' && start[n] != ')' && start[n] != '}' ) n ++;
+	memcpy( buffer, start, n );
+	buffer[n] = 0;
+	char * stop;
+	value = strtod( buffer, &stop );
+	if( stop == buffer ) return false;
+	p = start + ( stop - buffer );
+	return true;
+}
+
+}
+#endif
@@ -48,21 +48,20 @@ inline std::string trim(const std::string& str, const std::string & delimitor)
     return t;
 };
  
-/*
 inline	std::string toLower(const std::string& str)
 {
     string t = str;
-    transform(t.begin(), t.end(), t.begin(), tolower);
+    transform(t.begin(), t.end(), t.begin(), ::tolower);
     return t;
 };
 
 inline  std::string toUpper(const std::string& str)
 {
     string t = str;
-    transform(t.begin(), t.end(), t.begin(), toupper);
+    transform(t.begin(), t.end(), t.begin(), ::toupper);
     return t;
 };
-*/
+
 inline  bool startsWith(const std::string& str, const std::string& substr)
 {
 	return str.find(substr) == 0;
@@ -73,12 +72,11 @@ inline bool endsWith(const std::string& str, const std::string& substr)
 	return str.rfind(substr) == (str.length() - substr.length());
 };
 
-/*
 inline bool equalsIgnoreCase(const std::string& str1, const std::string& str2)
 {
   return toLower(str1) == toLower(str2);
 };
-*/
+
 
 inline    std::string toString(const bool& value)
 {
@@ -140,10 +138,10 @@ namespace strutil {
     {
     public:
         Tokenizer(const std::string& str)
-        : m_String(str), m_Offset(0), m_Delimiters("  ") {};
+        : m_Offset(0), m_String(str), m_Delimiters("  ") {};
 
         Tokenizer(const std::string& str, const std::string& delimiters)
-		: m_String(str), m_Offset(0), m_Delimiters(delimiters) {};
+		: m_Offset(0), m_String(str), m_Delimiters(delimiters) {};
         
 		bool nextToken() { return nextToken(m_Delimiters); };
 		
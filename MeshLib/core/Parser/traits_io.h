@@ -10,14 +10,16 @@
 
 #include <map>
 #include <vector>
+#include <complex>
+#include <sstream>
 
 #include "Mesh/BaseMesh.h"
 #include "Mesh/Vertex.h"
 #include "Mesh/HalfEdge.h"
 #include "Mesh/Edge.h"
 #include "Mesh/Face.h"
-#include "mesh/iterators.h"
-#include "mesh/boundary.h"
+#include "Mesh/iterators.h"
+#include "Mesh/boundary.h"
 #include "Parser/parser.h"
 
 #define VERTEX_RGB     (0x01<<0)
@@ -42,7 +44,7 @@ namespace MeshLib
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_vertex_uv( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CPoint2 uv = pV->uv();
@@ -68,7 +70,7 @@ void _write_vertex_uv( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_vertex_uv( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -89,7 +91,7 @@ void _read_vertex_uv( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_vertex_z( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -110,7 +112,7 @@ void _read_vertex_z( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_vertex_father( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -132,7 +134,7 @@ void _read_vertex_father( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_vertex_mu( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -153,7 +155,7 @@ void _read_vertex_mu( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_vertex_normal( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -175,7 +177,7 @@ void _read_vertex_normal( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_vertex_rgb( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -196,7 +198,7 @@ void _read_vertex_rgb( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_edge_length( M * pMesh )
 {
-	for( M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
+	for( typename M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
 	{
 		E * pE = *eiter;
 
@@ -218,7 +220,7 @@ void _read_edge_length( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _read_edge_sharp( M * pMesh )
 {
-	for( M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
+	for( typename M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
 	{
 		E * pE = *eiter;
 
@@ -239,7 +241,7 @@ void _read_edge_sharp( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_vertex_z( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -263,7 +265,7 @@ void _write_vertex_z( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_vertex_mu( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CParser parser( pV->string() );
@@ -286,7 +288,7 @@ void _write_vertex_mu( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_vertex_u( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CPoint rgb = pV->rgb();
@@ -310,7 +312,7 @@ void _write_vertex_u( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_vertex_rgb( M * pMesh )
 {
-	for( M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
+	for( typename M::MeshVertexIterator viter( pMesh ); !viter.end(); viter ++ )
 	{
 		V * pV = *viter;
 		CPoint rgb = pV->rgb();
@@ -333,10 +335,36 @@ void _write_vertex_rgb( M * pMesh )
 };
 
 
+template<typename M, typename V, typename E, typename F, typename H>
+void _write_face_rgb( M * pMesh )
+{
+	for( typename M::MeshFaceIterator fiter( pMesh ); !fiter.end(); fiter ++ )
+	{
+		F * pF = *fiter;
+		CPoint rgb = pF->rgb();
+
+		CParser parser( pF->string() );
+		parser._removeToken( "rgb" );
+		
+		parser._toString( pF->string() );
+		
+		std::stringstream iss;
+		
+		iss << "rgb=(" << rgb[0] << " " << rgb[1] << " " << rgb[2] << ")";
+
+		if( pF->string().size() > 0 )
+		{
+		  pF->string() += " ";
+		}
+		pF->string() += iss.str();
+	}
+};
+
+
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_edge_sharp( M * pMesh )
 {
-	for( M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
+	for( typename M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
 	{
 		E * pE = *eiter;
 		CParser parser( pE->string() );
@@ -364,7 +392,7 @@ void _write_edge_sharp( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _write_edge_du( M * pMesh )
 {
-	for( M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
+	for( typename M::MeshEdgeIterator eiter( pMesh ); !eiter.end(); eiter ++ )
 	{
 		E * pE = *eiter;
 		CParser parser( pE->string() );
@@ -388,29 +416,29 @@ void _write_edge_du( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _input_traits( M * pMesh )
 {
-	if( M->m_input_traits |= VERTEX_UV )
+	if( M::m_input_traits & VERTEX_UV )
 	{
 		_read_vertex_uv<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_input_traits |= VERTEX_NORMAL )
+	if( M::m_input_traits & VERTEX_NORMAL )
 	{
 		_read_vertex_normal<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_input_traits |= VERTEX_RGB )
+	if( M::m_input_traits & VERTEX_RGB )
 	{
-		_read_vertex_rgb( pMesh );
+		_read_vertex_rgb<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_input_traits |= EDGE_LENGTH )
+	if( M::m_input_traits & EDGE_LENGTH )
 	{
-		_read_edge_length( pMesh );
+		_read_edge_length<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_input_traits |= EDGE_SHARP )
+	if( M::m_input_traits & EDGE_SHARP )
 	{
-		_read_edge_sharp( pMesh );
+		_read_edge_sharp<M,V,E,F,H>( pMesh );
 	}
 
 };
@@ -418,32 +446,32 @@ void _input_traits( M * pMesh )
 template<typename M, typename V, typename E, typename F, typename H>
 void _output_traits( M * pMesh )
 {
-	if( M->m_m_output_traits |= VERTEX_UV )
+	if( M::m_output_traits & VERTEX_UV )
 	{
 		_write_vertex_uv<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_m_output_traits |= VERTEX_MU )
+	if( M::m_output_traits & VERTEX_MU )
 	{
 		_write_vertex_mu<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_m_output_traits |= VERTEX_RGB )
+	if( M::m_output_traits & VERTEX_RGB )
 	{
 		_write_vertex_rgb<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_m_output_traits |= VERTEX_U )
+	if( M::m_output_traits & VERTEX_U )
 	{
 		_write_vertex_u<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_m_output_traits |= EDGE_DU )
+	if( M::m_output_traits & EDGE_DU )
 	{
 		_write_edge_du<M,V,E,F,H>( pMesh );
 	}
 
-	if( M->m_m_output_traits |= EDGE_SHARP )
+	if( M::m_output_traits & EDGE_SHARP )
 	{
 		_write_edge_sharp<M,V,E,F,H>( pMesh );
 	}
@@ -451,4 +479,4 @@ void _output_traits( M * pMesh )
 
 }
 
-#endif  _TRAITS_IO_H_
\ No newline at end of file
+#endif  //_TRAITS_IO_H_
\ No newline at end of file
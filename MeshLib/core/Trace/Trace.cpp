@@ -0,0 +1,277 @@
+/*!
+*      \file Trace.cpp
+*      \brief Implement CTrace class
+*
+*/
+
+#ifdef MESHLIB_TRACE
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+
+#include "Trace.h"
+
+using namespace MeshLib;
+
+//buffers of all the threads, kept until exit
+
+static std::mutex & _registry_mutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+static std::vector< std::unique_ptr<CTraceBuffer> > & _registry()
+{
+	static std::vector< std::unique_ptr<CTraceBuffer> > buffers;
+	return buffers;
+}
+
+//write the events to the file named by MESHLIB_TRACE, registered with atexit by _enable,
+//the write functions expect the other threads to be done with their events
+
+static void _write_at_exit()
+{
+	const char * name = getenv( "MESHLIB_TRACE" );
+	if( name == NULL ) return;
+
+	size_t len = strlen( name );
+	if( strcmp( name, "-" ) == 0 )
+	{
+		CTrace::write_summary( stderr );
+	}
+	else if( len > 5 && strcmp( name + len - 5, ".json" ) == 0 )
+	{
+		CTrace::write_chrome( name );
+	}
+	else
+	{
+		FILE * fp = fopen( name, "w" );
+		if( fp == NULL )
+		{
+			fprintf( stderr, "Error in opening file %s\n", name );
+			return;
+		}
+		CTrace::write_summary( fp );
+		fclose( fp );
+	}
+}
+
+bool CTrace::_enable()
+{
+	const char * name = getenv( "MESHLIB_TRACE" );
+	if( name == NULL || name[0] == 0 ) return false;
+
+	//the registry is constructed before the handler is registered, so it is still alive when the handler runs
+	_registry();
+	atexit( _write_at_exit );
+	return true;
+}
+
+CTraceBuffer * CTrace::_buffer()
+{
+	std::lock_guard<std::mutex> lock( _registry_mutex() );
+	std::vector< std::unique_ptr<CTraceBuffer> > & buffers = _registry();
+
+	CTraceBuffer * buffer = new CTraceBuffer;
+	buffer->m_thread  = (int) buffers.size();
+	buffer->m_dropped = 0;
+	buffer->m_events.reserve( 4096 );
+	buffers.push_back( std::unique_ptr<CTraceBuffer>( buffer ) );
+	return buffer;
+}
+
+void CTrace::clear()
+{
+	std::lock_guard<std::mutex> lock( _registry_mutex() );
+	std::vector< std::unique_ptr<CTraceBuffer> > & buffers = _registry();
+	for( size_t i = 0; i < buffers.size(); i ++ )
+	{
+		buffers[i]->m_events.clear();
+		buffers[i]->m_dropped = 0;
+	}
+}
+
+//names are literals without quotes in practice, escape them anyway
+
+static void _write_json_string( FILE * fp, const char * s )
+{
+	fputc( '"', fp );
+	for( ; *s; s ++ )
+	{
+		if( *s == '"' || *s == '\\' ) fputc( '\\', fp );
+		if( (unsigned char) *s < 0x20 ) fprintf( fp, "\\u%04x", (unsigned char) *s );
+		else fputc( *s, fp );
+	}
+	fputc( '"', fp );
+}
+
+//events of all the threads in time order, with the thread of each
+
+static void _gather( std::vector< std::pair<CTraceEvent, int> > & events, long long & dropped )
+{
+	std::lock_guard<std::mutex> lock( _registry_mutex() );
+	std::vector< std::unique_ptr<CTraceBuffer> > & buffers = _registry();
+
+	dropped = 0;
+	for( size_t i = 0; i < buffers.size(); i ++ )
+	{
+		CTraceBuffer * buffer = buffers[i].get();
+		for( size_t j = 0; j < buffer->m_events.size(); j ++ )
+			events.push_back( std::pair<CTraceEvent, int>( buffer->m_events[j], buffer->m_thread ) );
+		dropped += buffer->m_dropped;
+	}
+
+	std::stable_sort( events.begin(), events.end(),
+		[]( const std::pair<CTraceEvent, int> & a, const std::pair<CTraceEvent, int> & b )
+		{
+			return a.first.m_start < b.first.m_start;
+		} );
+}
+
+//scopes are complete events, counters are shown as their running totals and gauges as their samples
+
+bool CTrace::write_chrome( const char * name )
+{
+	std::vector< std::pair<CTraceEvent, int> > events;
+	long long dropped;
+	_gather( events, dropped );
+
+	FILE * fp = fopen( name, "w" );
+	if( fp == NULL )
+	{
+		fprintf( stderr, "Error in opening file %s\n", name );
+		return false;
+	}
+
+	fprintf( fp, "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%lld},\"traceEvents\":[\n", dropped );
+	fprintf( fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"meshlib\"}}" );
+
+	int threads = 0;
+	for( size_t i = 0; i < events.size(); i ++ ) threads = std::max( threads, events[i].second + 1 );
+	for( int t = 0; t < threads; t ++ )
+	{
+		fprintf( fp, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}", t, t );
+	}
+
+	std::map<std::string, double> totals;
+	for( size_t i = 0; i < events.size(); i ++ )
+	{
+		CTraceEvent & e = events[i].first;
+		int tid = events[i].second;
+
+		fprintf( fp, ",\n{\"name\":" );
+		_write_json_string( fp, e.m_name );
+		switch( e.m_kind )
+		{
+		case TRACE_KIND_SCOPE:
+			fprintf( fp, ",\"cat\":\"meshlib\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				tid, e.m_start / 1000.0, e.m_duration / 1000.0 );
+			break;
+		case TRACE_KIND_COUNTER:
+			{
+				double & total = totals[e.m_name];
+				total += e.m_value;
+				fprintf( fp, ",\"ph\":\"C\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"total\":%.17g}}",
+					tid, e.m_start / 1000.0, total );
+			}
+			break;
+		default:
+			fprintf( fp, ",\"ph\":\"C\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%.17g}}",
+				tid, e.m_start / 1000.0, e.m_value );
+			break;
+		}
+	}
+
+	fprintf( fp, "\n]}\n" );
+	fclose( fp );
+	return true;
+}
+
+/*!	statistics of one name in the summary
+ */
+struct CTraceStatistics
+{
+	CTraceStatistics() : m_kind( 0 ), m_count( 0 ), m_total( 0 ), m_min( 0 ), m_max( 0 ), m_first( 0 ), m_last( 0 ) {};
+	int       m_kind;
+	long long m_count;
+	double    m_total;
+	double    m_min;
+	double    m_max;
+	double    m_first;
+	double    m_last;
+};
+
+void CTrace::write_summary( FILE * fp )
+{
+	std::vector< std::pair<CTraceEvent, int> > events;
+	long long dropped;
+	_gather( events, dropped );
+
+	std::map<std::string, CTraceStatistics> statistics;
+	for( size_t i = 0; i < events.size(); i ++ )
+	{
+		CTraceEvent & e = events[i].first;
+		double value = ( e.m_kind == TRACE_KIND_SCOPE ) ? e.m_duration / 1e6 : e.m_value;
+
+		CTraceStatistics & s = statistics[e.m_name];
+		if( s.m_count == 0 )
+		{
+			s.m_kind  = e.m_kind;
+			s.m_min   = value;
+			s.m_max   = value;
+			s.m_first = value;
+		}
+		s.m_count ++;
+		s.m_total += value;
+		s.m_min    = std::min( s.m_min, value );
+		s.m_max    = std::max( s.m_max, value );
+		s.m_last   = value;
+	}
+
+	//scopes by total time, nested scopes count in their parents as well
+	std::vector< std::pair<std::string, CTraceStatistics> > scopes;
+	for( std::map<std::string, CTraceStatistics>::iterator iter = statistics.begin(); iter != statistics.end(); iter ++ )
+	{
+		if( iter->second.m_kind == TRACE_KIND_SCOPE ) scopes.push_back( *iter );
+	}
+	std::stable_sort( scopes.begin(), scopes.end(),
+		[]( const std::pair<std::string, CTraceStatistics> & a, const std::pair<std::string, CTraceStatistics> & b )
+		{
+			return a.second.m_total > b.second.m_total;
+		} );
+
+	fprintf( fp, "%-56s %10s %12s %12s %12s %12s\n", "# scope", "calls", "total ms", "mean ms", "min ms", "max ms" );
+	for( size_t i = 0; i < scopes.size(); i ++ )
+	{
+		CTraceStatistics & s = scopes[i].second;
+		fprintf( fp, "%-56s %10lld %12.3f %12.3f %12.3f %12.3f\n", scopes[i].first.c_str(),
+			s.m_count, s.m_total, s.m_total / s.m_count, s.m_min, s.m_max );
+	}
+
+	fprintf( fp, "%-56s %10s %12s\n", "# counter", "calls", "total" );
+	for( std::map<std::string, CTraceStatistics>::iterator iter = statistics.begin(); iter != statistics.end(); iter ++ )
+	{
+		CTraceStatistics & s = iter->second;
+		if( s.m_kind != TRACE_KIND_COUNTER ) continue;
+		fprintf( fp, "%-56s %10lld %12.6g\n", iter->first.c_str(), s.m_count, s.m_total );
+	}
+
+	fprintf( fp, "%-56s %10s %12s %12s %12s %12s\n", "# gauge", "samples", "first", "last", "min", "max" );
+	for( std::map<std::string, CTraceStatistics>::iterator iter = statistics.begin(); iter != statistics.end(); iter ++ )
+	{
+		CTraceStatistics & s = iter->second;
+		if( s.m_kind != TRACE_KIND_GAUGE ) continue;
+		fprintf( fp, "%-56s %10lld %12.6g %12.6g %12.6g %12.6g\n", iter->first.c_str(),
+			s.m_count, s.m_first, s.m_last, s.m_min, s.m_max );
+	}
+
+	if( dropped > 0 ) fprintf( fp, "# %lld events dropped, the buffers were full\n", dropped );
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*!
+*      \file Trace.h
+*      \brief Scoped timers, counters and gauges of the solvers and of the mesh input and output
+*
+*	TRACE_SCOPE( "name" )           times the enclosing scope
+*	TRACE_COUNTER( "name", n )      adds n to a counter
+*	TRACE_GAUGE( "name", value )    samples a value, the error of an iteration for example
+*
+*	The macros are empty unless MESHLIB_TRACE is defined, their arguments are not even evaluated.
+*	The names are string literals, the events go to a buffer of the calling thread without locking.
+*	At exit the events are written to the file named by the environment variable MESHLIB_TRACE,
+*	a Chrome trace if the name ends with .json (chrome://tracing or ui.perfetto.dev), a flat summary
+*	otherwise, MESHLIB_TRACE=- prints the summary to stderr. Without the variable nothing is recorded.
+*/
+
+#ifndef _MESHLIB_TRACE_H_
+#define _MESHLIB_TRACE_H_
+
+#ifdef MESHLIB_TRACE
+
+#include <stdio.h>
+#include <vector>
+#include <chrono>
+
+namespace MeshLib
+{
+
+/*!	kind of a trace event
+ */
+enum TRACE_KIND { TRACE_KIND_SCOPE, TRACE_KIND_COUNTER, TRACE_KIND_GAUGE };
+
+/*!
+ *	\brief CTraceEvent
+ *
+ *  A timed scope, from start to start + duration, or a counter increment or a gauge sample at start.
+ */
+struct CTraceEvent
+{
+	const char * m_name;
+	int          m_kind;
+	long long    m_start;
+	long long    m_duration;
+	double       m_value;
+};
+
+/*!
+ *	\brief CTraceBuffer
+ *
+ *  Events of one thread, owned by CTrace so that they outlive the thread.
+ */
+struct CTraceBuffer
+{
+	std::vector<CTraceEvent> m_events;
+	int                      m_thread;
+	/*! events lost once the buffer is full */
+	long long                m_dropped;
+};
+
+/*!
+ *	\brief CTrace class
+ *
+ *  Records the events of the macros and writes them out.
+ */
+class CTrace
+{
+public:
+	/*!	nanoseconds since the first event of the process
+	 */
+	static long long now()
+	{
+		static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+		return (long long) std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - epoch ).count();
+	};
+	/*!	whether MESHLIB_TRACE is set, read once
+	 */
+	static bool enabled()
+	{
+		static bool on = _enable();
+		return on;
+	};
+	/*!	time the scope of name, from start to end
+	 */
+	static void scope( const char * name, long long start, long long end )
+	{
+		_record( name, TRACE_KIND_SCOPE, start, end - start, 0 );
+	};
+	/*!	add value to the counter name
+	 */
+	static void counter( const char * name, double value )
+	{
+		if( enabled() ) _record( name, TRACE_KIND_COUNTER, now(), 0, value );
+	};
+	/*!	sample the gauge name
+	 */
+	static void gauge( const char * name, double value )
+	{
+		if( enabled() ) _record( name, TRACE_KIND_GAUGE, now(), 0, value );
+	};
+
+	/*!	write the events of all the threads as a Chrome trace
+	 *  \param name output .json file name
+	 */
+	static bool write_chrome( const char * name );
+	/*!	write the calls and times of the scopes, the totals of the counters and the range of the gauges
+	 */
+	static void write_summary( FILE * fp );
+	/*!	drop the events recorded so far
+	 */
+	static void clear();
+
+protected:
+	static bool _enable();
+	/*!	the buffer of the calling thread, registered on first use
+	 */
+	static CTraceBuffer * _buffer();
+	static void _record( const char * name, int kind, long long start, long long duration, double value )
+	{
+		static thread_local CTraceBuffer * buffer = _buffer();
+		if( buffer->m_events.size() >= s_capacity )
+		{
+			buffer->m_dropped ++;
+			return;
+		}
+		CTraceEvent e = { name, kind, start, duration, value };
+		buffer->m_events.push_back( e );
+	};
+	/*!	most events kept per thread */
+	static const size_t s_capacity = 1 << 22;
+};
+
+/*!
+ *	\brief CTraceScope
+ *
+ *  Times its own lifetime, the clock is not read when tracing is off at run time.
+ */
+class CTraceScope
+{
+public:
+	CTraceScope( const char * name ) : m_name( name ), m_start( CTrace::enabled() ? CTrace::now() : -1 ) {};
+	~CTraceScope()
+	{
+		if( m_start >= 0 ) CTrace::scope( m_name, m_start, CTrace::now() );
+	};
+protected:
+	const char * m_name;
+	long long    m_start;
+};
+
+}
+
+#define TRACE_CONCAT_( a, b ) a##b
+#define TRACE_CONCAT( a, b )  TRACE_CONCAT_( a, b )
+
+#define TRACE_SCOPE( name )          MeshLib::CTraceScope TRACE_CONCAT( _trace_scope_, __LINE__ )( name )
+#define TRACE_COUNTER( name, value ) MeshLib::CTrace::counter( name, (double) ( value ) )
+#define TRACE_GAUGE( name, value )   MeshLib::CTrace::gauge( name, (double) ( value ) )
+
+#else
+
+//the values are not evaluated, sizeof only keeps the variables that feed them in use
+
+#define TRACE_SCOPE( name )
+#define TRACE_COUNTER( name, value ) ( (void) sizeof( value ) )
+#define TRACE_GAUGE( name, value )   ( (void) sizeof( value ) )
+
+#endif
+
+#endif
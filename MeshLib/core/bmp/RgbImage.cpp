@@ -6,9 +6,16 @@
 */
 
 #include "RgbImage.h"
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #ifndef RGBIMAGE_DONT_USE_OPENGL
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include "GL/gl.h"
 #endif
 
@@ -20,6 +27,9 @@ RgbImage::RgbImage( int numRows, int numCols )
 {
 	NumRows = numRows;
 	NumCols = numCols;
+	ErrorCode = 0;
+	Wrap = Repeat;
+	MipDirty = true;
 	ImagePtr = new unsigned char[NumRows*GetNumBytesPerRow()];
 	if ( !ImagePtr ) {
 		fprintf(stderr, "Unable to allocate memory for %ld x %ld bitmap.\n", 
@@ -296,11 +306,162 @@ void RgbImage::SetRgbPixelc( long row, long col,
 {
 	assert ( row<NumRows && col<NumCols );
 	unsigned char* thePixel = GetRgbPixel( row, col );
+	MipDirty = true;
 	*(thePixel++) = red;
 	*(thePixel++) = green;
 	*(thePixel) = blue;
 }
 
+/*********************************************************************
+ * Mip chain and texture lookups.                                    *
+ *********************************************************************/
+/*! build the tiled mip chain; level 0 is the image, every level halves the size rounding
+	* down and each texel of it averages the 2 x 2 texels below, so the last row or column of
+	* an odd sized level is left out; once a side is 1 its texel is repeated
+	*/
+void RgbImage::BuildMipmaps()
+{
+	if ( !MipDirty ) {
+		return;
+	}
+	MipData.clear();
+	MipOffset.clear();
+	MipCols.clear();
+	MipRows.clear();
+	MipTiles.clear();
+	MipDirty = false;
+	if ( ImagePtr==0 || NumRows<=0 || NumCols<=0 ) {
+		return;
+	}
+
+	// sizes and offsets of the levels, each padded to whole tiles
+	long cols = NumCols, rows = NumRows, size = 0;
+	while ( true ) {
+		long tiles = ( cols+7 )>>3;
+		MipOffset.push_back( size );
+		MipCols.push_back( cols );
+		MipRows.push_back( rows );
+		MipTiles.push_back( tiles );
+		size += 4*64*tiles*( ( rows+7 )>>3 );
+		if ( cols==1 && rows==1 ) break;
+		cols = cols>1 ? cols/2 : 1;
+		rows = rows>1 ? rows/2 : 1;
+	}
+	MipData.assign( size, 0 );
+
+	// GetTexel only reads, the texels are written through the same addresses
+	int numLevels = (int) MipCols.size();
+	for ( int level=0; level<numLevels; level++ ) {
+		int levelRows = (int) MipRows[level];
+		long levelCols = MipCols[level];
+#pragma omp parallel for
+		for ( int y=0; y<levelRows; y++ ) {
+			for ( long x=0; x<levelCols; x++ ) {
+				unsigned char* t = (unsigned char*) GetTexel( level, x, y );
+				if ( level==0 ) {
+					const unsigned char* p = GetRgbPixel( y, x );
+					t[0] = p[0];
+					t[1] = p[1];
+					t[2] = p[2];
+					t[3] = 255;
+					continue;
+				}
+				long sx = 2*x, sy = 2*y;
+				long sx1 = sx+1<MipCols[level-1] ? sx+1 : sx;
+				long sy1 = sy+1<MipRows[level-1] ? sy+1 : sy;
+				const unsigned char* p00 = GetTexel( level-1, sx,  sy );
+				const unsigned char* p01 = GetTexel( level-1, sx1, sy );
+				const unsigned char* p10 = GetTexel( level-1, sx,  sy1 );
+				const unsigned char* p11 = GetTexel( level-1, sx1, sy1 );
+				for ( int i=0; i<4; i++ ) {
+					t[i] = (unsigned char)( ( p00[i]+p01[i]+p10[i]+p11[i]+2 )>>2 );
+				}
+			}
+		}
+	}
+}
+
+/*! bilinear lookup in one level, texel centers at half integers
+	*/
+void RgbImage::SampleLevel( int level, double u, double v, double* rgb ) const
+{
+	double x = u*MipCols[level] - 0.5;
+	double y = v*MipRows[level] - 0.5;
+	double fx = floor( x ), fy = floor( y );
+	double ax = x-fx, ay = y-fy;
+	long x0 = (long) fx, y0 = (long) fy;
+
+	const unsigned char* p00 = GetTexel( level, x0,   y0 );
+	const unsigned char* p01 = GetTexel( level, x0+1, y0 );
+	const unsigned char* p10 = GetTexel( level, x0,   y0+1 );
+	const unsigned char* p11 = GetTexel( level, x0+1, y0+1 );
+	for ( int i=0; i<3; i++ ) {
+		double a = p00[i] + ax*( p01[i]-p00[i] );
+		double b = p10[i] + ax*( p11[i]-p10[i] );
+		rgb[i] = ( a + ay*( b-a ) )/255.0;
+	}
+}
+
+void RgbImage::Sample( double u, double v, double* rgb )
+{
+	BuildMipmaps();
+	if ( MipCols.empty() ) {
+		rgb[0] = rgb[1] = rgb[2] = 0;
+		return;
+	}
+	SampleLevel( 0, u, v, rgb );
+}
+
+void RgbImage::SampleLod( double u, double v, double lod, double* rgb )
+{
+	BuildMipmaps();
+	if ( MipCols.empty() ) {
+		rgb[0] = rgb[1] = rgb[2] = 0;
+		return;
+	}
+	int last = (int) MipCols.size()-1;
+	if ( !( lod>0 ) ) lod = 0;					// also for nan
+	if ( lod>last ) lod = last;
+	int level = (int) lod;
+	double t = lod-level;
+	SampleLevel( level, u, v, rgb );
+	if ( t>0 && level<last ) {
+		double c[3];
+		SampleLevel( level+1, u, v, c );
+		for ( int i=0; i<3; i++ ) {
+			rgb[i] += t*( c[i]-rgb[i] );
+		}
+	}
+}
+
+void RgbImage::Sample( int n, const double* u, const double* v, double* rgb )
+{
+	BuildMipmaps();
+#pragma omp parallel for schedule(static)
+	for ( int i=0; i<n; i++ ) {
+		Sample( u[i], v[i], rgb+3*i );
+	}
+}
+
+void RgbImage::SampleLod( int n, const double* u, const double* v, const double* lod, double* rgb )
+{
+	BuildMipmaps();
+#pragma omp parallel for schedule(static)
+	for ( int i=0; i<n; i++ ) {
+		SampleLod( u[i], v[i], lod[i], rgb+3*i );
+	}
+}
+
+/*! log2 of the longer of the two pixel axes, measured in texels
+	*/
+double RgbImage::GetLod( double dudx, double dvdx, double dudy, double dvdy ) const
+{
+	double sx = sqrt( dudx*dudx*NumCols*NumCols + dvdx*dvdx*NumRows*NumRows );
+	double sy = sqrt( dudy*dudy*NumCols*NumCols + dvdy*dvdy*NumRows*NumRows );
+	double rho = sx>sy ? sx : sy;
+	return rho>0 ? log( rho )/log( 2.0 ) : 0;
+}
+
 /*!	convert a double to unsigned char
 	* \param x input double number
 	* \return output unsigned char
@@ -373,6 +534,7 @@ bool RgbImage::LoadFromOpenglBuffer()					// Load the bitmap from the current Op
 
 	// Get the frame buffer data.
 	glReadPixels( 0, 0, NumCols, NumRows, GL_RGB, GL_UNSIGNED_BYTE, ImagePtr);
+	MipDirty = true;
 
 	// Restore the row length in glPixelStorei  (really ought to restore alignment too).
 	if ( vWidth>=NumCols ) {
@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <vector>
 
 // Include the next line to turn off the routines that use OpenGL
 // #define RGBIMAGE_DONT_USE_OPENGL
@@ -16,6 +17,12 @@
  *	\brief RgbImage class
  *
  *  24 bit bmp image class.
+ *
+ *  The pixels are kept row by row as in the bmp file, ImageData() is passed to glTexImage2D.
+ *  For texture lookups the image is copied into a mip chain in a tiled layout: every level is
+ *  cut into 8 x 8 tiles of 4 byte texels, with the texels of a tile in Morton order, so the
+ *  four texels of a bilinear lookup and the lookups of nearby uv share a few cache lines.
+ *  The chain is built by BuildMipmaps, or by the first lookup after the pixels changed.
  */
 class RgbImage
 {
@@ -116,6 +123,37 @@ public:
 	 */
 	void SetRgbPixelc( long row, long col, 
 					   unsigned char red, unsigned char green, unsigned char blue );
+
+	/*! wrap modes of the texture lookups, as GL_REPEAT and GL_CLAMP_TO_EDGE */
+	enum { Repeat = 0, ClampToEdge = 1 };
+	/*! set the wrap mode of the texture lookups */
+	void SetWrap( int mode ) { Wrap = mode; }
+	/*! number of levels of the mip chain, 0 before it is built */
+	long GetNumLevels() const { return (long) MipCols.size(); }
+	/*! build the mip chain from the pixels if they changed; call it before looking up from
+	 *  several threads, the lookups build the chain themselves otherwise
+	 */
+	void BuildMipmaps();
+	/*! the pixels were changed through GetRgbPixel, the mip chain is built again on the next lookup */
+	void InvalidateMipmaps() { MipDirty = true; }
+
+	/*! bilinear lookup in the full resolution image, as GL_LINEAR; pixel row 0 is v = 0
+	 * \param u,v texture coordinates, the image covers [0,1] x [0,1]
+	 * \param rgb output color in [0,1]
+	 */
+	void Sample( double u, double v, double* rgb );
+	/*! trilinear lookup, as GL_LINEAR_MIPMAP_LINEAR
+	 * \param u,v texture coordinates
+	 * \param lod level of detail, log2 of the texels per pixel, clamped to the chain
+	 * \param rgb output color in [0,1]
+	 */
+	void SampleLod( double u, double v, double lod, double* rgb );
+	/*! bilinear lookups of n points in parallel, rgb holds 3n values */
+	void Sample( int n, const double* u, const double* v, double* rgb );
+	/*! trilinear lookups of n points in parallel, rgb holds 3n values */
+	void SampleLod( int n, const double* u, const double* v, const double* lod, double* rgb );
+	/*! level of detail of a pixel from the screen derivatives of the texture coordinates, as OpenGL */
+	double GetLod( double dudx, double dvdx, double dudy, double dvdy ) const;
 	/*! get the error code
 	 */
 
@@ -168,12 +206,12 @@ private:
 	\param data the long integter to write
 	\param outfile output file
 	*/
-	static void RgbImage::writeLong( long data, FILE* outfile );
+	static void writeLong( long data, FILE* outfile );
 	/*!	write a short integer to the file
 	\param data the short integter to write
 	\param outfile output file
 	*/
-	static void RgbImage::writeShort( short data, FILE* outfile );
+	static void writeShort( short data, FILE* outfile );
 	
 	/*!	convert a double to unsigned char
 	* \param x input double number
@@ -181,6 +219,24 @@ private:
 	*/
 	static unsigned char doubleToUnsignedChar( double x );
 
+	/*! wrap mode of the lookups */
+	int Wrap;
+	/*! true if the mip chain is out of date */
+	bool MipDirty;
+	/*! tiled texels of all the levels, 4 bytes each, and per level the offset, size and tiles per row */
+	std::vector<unsigned char> MipData;
+	std::vector<long> MipOffset;
+	std::vector<long> MipCols;
+	std::vector<long> MipRows;
+	std::vector<long> MipTiles;
+
+	/*! texel ( x, y ) of a level, the coordinates are wrapped */
+	const unsigned char* GetTexel( int level, long x, long y ) const;
+	/*! wrap a texel coordinate into [0,n) */
+	long WrapCoord( long x, long n ) const;
+	/*! bilinear lookup in one level, without building the chain */
+	void SampleLevel( int level, double u, double v, double* rgb ) const;
+
 };
 
 /*!	RgbImage constructor
@@ -191,6 +247,8 @@ inline RgbImage::RgbImage()
 	NumCols = 0;
 	ImagePtr = 0;
 	ErrorCode = 0;
+	Wrap = Repeat;
+	MipDirty = true;
 }
 /*!	RgbImage constructor
 	* \param filename the input file nmae
@@ -201,6 +259,8 @@ inline RgbImage::RgbImage( const char* filename )
 	NumCols = 0;
 	ImagePtr = 0;
 	ErrorCode = 0;
+	Wrap = Repeat;
+	MipDirty = true;
 	LoadBmpFile( filename );
 }
 /*!	RgbImage destructor
@@ -279,7 +339,35 @@ inline void RgbImage::Reset()
 	delete[] ImagePtr;
 	ImagePtr = 0;
 	ErrorCode = 0;
+	MipDirty = true;
+	MipData.clear();
+	MipOffset.clear();
+	MipCols.clear();
+	MipRows.clear();
+	MipTiles.clear();
 }
 
+/*! wrap a texel coordinate into [0,n)
+ */
+inline long RgbImage::WrapCoord( long x, long n ) const
+{
+	if ( Wrap==ClampToEdge ) {
+		return x<0 ? 0 : ( x>=n ? n-1 : x );
+	}
+	x %= n;
+	return x<0 ? x+n : x;
+}
+/*! texel ( x, y ) of a level: tile ( x/8, y/8 ), then the Morton index of ( x%8, y%8 ) in the tile
+ */
+inline const unsigned char* RgbImage::GetTexel( int level, long x, long y ) const
+{
+	// the bits of a 3 bit number spread to the even positions
+	static const unsigned char spread[8] = { 0, 1, 4, 5, 16, 17, 20, 21 };
+	x = WrapCoord( x, MipCols[level] );
+	y = WrapCoord( y, MipRows[level] );
+	long tile = ( y>>3 )*MipTiles[level] + ( x>>3 );
+	long i = MipOffset[level] + 4*( 64*tile + ( spread[x&7] | ( spread[y&7]<<1 ) ) );
+	return &MipData[i];
+}
 
 #endif // RGBIMAGE_H
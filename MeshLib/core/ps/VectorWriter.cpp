@@ -0,0 +1,658 @@
+#include "VectorWriter.h"
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace MeshLib;
+
+/*-------------------------------------------------------------------------------------------------------------------------
+
+	Buffer
+
+--------------------------------------------------------------------------------------------------------------------------*/
+
+CVectorBuffer::CVectorBuffer( FILE * fp, size_t capacity )
+{
+	m_fp = fp;
+	m_capacity = capacity;
+	if( m_fp != NULL ) m_text.reserve( m_capacity + 4096 );
+}
+
+void CVectorBuffer::flush()
+{
+	if( m_fp == NULL || m_text.empty() ) return;
+	fwrite( m_text.data(), 1, m_text.size(), m_fp );
+	m_text.clear();
+}
+
+void CVectorBuffer::append( const char * s, size_t n )
+{
+	m_text.append( s, n );
+	if( m_fp != NULL && m_text.size() >= m_capacity ) flush();
+}
+
+CVectorBuffer & CVectorBuffer::operator<<( const char * s )
+{
+	append( s, strlen( s ) );
+	return *this;
+}
+
+CVectorBuffer & CVectorBuffer::operator<<( int v )
+{
+	char s[16];
+	char * p = s + sizeof( s );
+	unsigned int u = ( v < 0 )? 0u - (unsigned int) v: (unsigned int) v;
+	do { *--p = (char)( '0' + u % 10 ); u /= 10; } while( u );
+	if( v < 0 ) *--p = '-';
+	append( p, s + sizeof( s ) - p );
+	return *this;
+}
+
+//hundredths are rounded, the printf family is avoided since it dominates the output time
+CVectorBuffer & CVectorBuffer::operator<<( double v )
+{
+	long long n = (long long) floor( v * 100.0 + 0.5 );
+	bool negative = ( n < 0 );
+	unsigned long long u = negative? 0ULL - (unsigned long long) n: (unsigned long long) n;
+
+	char s[32];
+	char * p = s + sizeof( s );
+	int frac = (int)( u % 100 );
+	u /= 100;
+	if( frac != 0 )
+	{
+		if( frac % 10 != 0 ) *--p = (char)( '0' + frac % 10 );
+		*--p = (char)( '0' + frac / 10 );
+		*--p = '.';
+	}
+	do { *--p = (char)( '0' + u % 10 ); u /= 10; } while( u );
+	if( negative ) *--p = '-';
+	append( p, s + sizeof( s ) - p );
+	return *this;
+}
+
+//nearly straight geodesics have radii of millions of points, two decimals of the angles would move their end points
+CVectorBuffer & CVectorBuffer::precise( double v )
+{
+	char s[32];
+	int n = snprintf( s, sizeof( s ), "%.17g", v );
+	append( s, (size_t) n );
+	return *this;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------
+
+	Writer
+
+--------------------------------------------------------------------------------------------------------------------------*/
+
+CVectorWriter::CVectorWriter( double width, double height )
+{
+	m_width  = width;
+	m_height = height;
+	m_xscale = m_yscale = 1;
+	m_xoffset = m_yoffset = 0;
+	m_pixel = 1.0;
+	m_tolerance = 0.25;
+
+	m_current.m_rgb[0] = m_current.m_rgb[1] = m_current.m_rgb[2] = 0;
+	m_current.m_width = 0.3;
+	m_current_used = false;
+
+	m_written = m_merged = m_culled = 0;
+}
+
+void CVectorWriter::view( double xscale, double yscale, double xoffset, double yoffset )
+{
+	m_xscale  = xscale;
+	m_yscale  = yscale;
+	m_xoffset = xoffset;
+	m_yoffset = yoffset;
+}
+
+void CVectorWriter::color( double r, double g, double b )
+{
+	m_current.m_rgb[0] = r;
+	m_current.m_rgb[1] = g;
+	m_current.m_rgb[2] = b;
+	m_current_used = false;
+}
+
+void CVectorWriter::line_width( double w )
+{
+	m_current.m_width = w;
+	m_current_used = false;
+}
+
+int CVectorWriter::_style()
+{
+	if( !m_current_used )
+	{
+		m_styles.push_back( m_current );
+		m_current_used = true;
+	}
+	return (int) m_styles.size() - 1;
+}
+
+void CVectorWriter::line( CPoint2 p, CPoint2 q )
+{
+	CVectorPrimitive l;
+	l.m_type  = CVectorPrimitive::LINE;
+	l.m_style = _style();
+	l.m_x0 = p[0] * m_xscale + m_xoffset;
+	l.m_y0 = p[1] * m_yscale + m_yoffset;
+	l.m_x1 = q[0] * m_xscale + m_xoffset;
+	l.m_y1 = q[1] * m_yscale + m_yoffset;
+	l.m_r = l.m_start = l.m_end = 0;
+	m_primitives.push_back( l );
+}
+
+//the radius is scaled by xscale, as the arcs of the PostScript output
+void CVectorWriter::arc( CPoint2 c, double r, double start, double end )
+{
+	CVectorPrimitive a;
+	a.m_type  = CVectorPrimitive::ARC;
+	a.m_style = _style();
+	a.m_x0 = c[0] * m_xscale + m_xoffset;
+	a.m_y0 = c[1] * m_yscale + m_yoffset;
+	a.m_x1 = a.m_y1 = 0;
+	a.m_r  = fabs( r * m_xscale );
+	a.m_start = start;
+	a.m_end   = end;
+	m_primitives.push_back( a );
+}
+
+int CVectorWriter::format( const char * filename )
+{
+	const char * dot = strrchr( filename, '.' );
+	if( dot != NULL && ( strcmp( dot, ".svg" ) == 0 || strcmp( dot, ".SVG" ) == 0 ) ) return SVG;
+	if( dot != NULL && ( strcmp( dot, ".eps" ) == 0 || strcmp( dot, ".EPS" ) == 0 ) ) return EPS;
+	return PS;
+}
+
+void CVectorWriter::_head( CVectorBuffer & out, int fmt )
+{
+	int w = (int) ceil( m_width );
+	int h = (int) ceil( m_height );
+
+	if( fmt == SVG )
+	{
+		out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+		out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << w << "\" height=\"" << h << "\" viewBox=\"0 0 " << w << " " << h << "\">\n";
+		out << "<g fill=\"none\" stroke-linecap=\"round\" stroke-linejoin=\"round\">\n";
+		return;
+	}
+
+	out << ( ( fmt == EPS )? "%!PS-Adobe-3.0 EPSF-3.0\n": "%!PS-Adobe-2.0\n" );
+	out << "%%BoundingBox: 0 0 " << w << " " << h << "\n";
+	out << "%%Creator: CCGL\n";
+	out << "%%EndComments\n\n";
+	out << "1 setlinecap\n1 setlinejoin\n";
+	out << "/m { moveto } bind def\n/l { lineto } bind def\n/s { stroke } bind def\n/a { newpath arc stroke } bind def\n";
+	out << "0 0 moveto " << w << " 0 lineto " << w << " " << h << " lineto 0 " << h << " lineto\n";
+	out << "closepath\nclip\nnewpath\n";
+}
+
+void CVectorWriter::_tail( CVectorBuffer & out, int fmt )
+{
+	if( fmt == SVG ) out << "</g>\n</svg>\n";
+	else if( fmt == PS ) out << "showpage\n";
+}
+
+void CVectorWriter::_begin_style( CVectorBuffer & out, int fmt, int style )
+{
+	CStyle & s = m_styles[style];
+	if( fmt == SVG )
+	{
+		out << "<g stroke=\"rgb(" << (int) floor( s.m_rgb[0] * 255 + 0.5 ) << "," << (int) floor( s.m_rgb[1] * 255 + 0.5 ) << ","
+			<< (int) floor( s.m_rgb[2] * 255 + 0.5 ) << ")\" stroke-width=\"" << s.m_width << "\">\n";
+		return;
+	}
+	out << s.m_rgb[0] << " " << s.m_rgb[1] << " " << s.m_rgb[2] << " setrgbcolor\n" << s.m_width << " setlinewidth\n";
+}
+
+void CVectorWriter::_end_style( CVectorBuffer & out, int fmt )
+{
+	if( fmt == SVG ) out << "</g>\n";
+}
+
+//SVG has y pointing down
+void CVectorWriter::_polyline( CVectorBuffer & out, int fmt, std::vector<double> & xy )
+{
+	int n = (int) xy.size() / 2;
+	if( n == 0 ) return;
+
+	if( fmt == SVG )
+	{
+		out << "<path d=\"M" << xy[0] << " " << m_height - xy[1] << "L";
+		if( n == 1 ) out << xy[0] << " " << m_height - xy[1];
+		for( int i = 1; i < n; i ++ )
+		{
+			if( i > 1 ) out << " ";
+			out << xy[2*i] << " " << m_height - xy[2*i+1];
+		}
+		out << "\"/>\n";
+		return;
+	}
+
+	out << xy[0] << " " << xy[1] << " m ";
+	if( n == 1 ) out << xy[0] << " " << xy[1] << " l ";
+	for( int i = 1; i < n; i ++ )
+	{
+		out << xy[2*i] << " " << xy[2*i+1] << " l";
+		out << ( ( i % 8 == 0 )? "\n": " " );
+	}
+	out << "s\n";
+}
+
+static const double s_d2r = 3.14159265358979323846 / 180.0;
+
+//counterclockwise extent of an arc in degrees, 360 for a full circle
+static double _arc_extent( const CVectorPrimitive & a )
+{
+	double extent = a.m_end - a.m_start;
+	if( extent < 0 ) extent = fmod( extent, 360.0 ) + 360.0;
+	return std::min( extent, 360.0 );
+}
+
+//end points of an arc
+static void _arc_ends( const CVectorPrimitive & a, double extent, double & sx, double & sy, double & ex, double & ey )
+{
+	sx = a.m_x0 + a.m_r * cos( a.m_start * s_d2r );
+	sy = a.m_y0 + a.m_r * sin( a.m_start * s_d2r );
+	ex = a.m_x0 + a.m_r * cos( ( a.m_start + extent ) * s_d2r );
+	ey = a.m_y0 + a.m_r * sin( ( a.m_start + extent ) * s_d2r );
+}
+
+//sagitta r ( 1 - cos( extent / 2 ) ), without the cancellation
+static double _arc_sagitta( const CVectorPrimitive & a, double extent )
+{
+	double h = sin( extent * s_d2r / 4 );
+	return 2.0 * a.m_r * h * h;
+}
+
+//bounding box xmin, ymin, xmax, ymax of a primitive: the end points of an arc and the
+//axis points of its circle within the sweep
+static void _bounds( const CVectorPrimitive & p, double * box )
+{
+	if( p.m_type == CVectorPrimitive::LINE )
+	{
+		box[0] = std::min( p.m_x0, p.m_x1 ); box[2] = std::max( p.m_x0, p.m_x1 );
+		box[1] = std::min( p.m_y0, p.m_y1 ); box[3] = std::max( p.m_y0, p.m_y1 );
+		return;
+	}
+
+	double extent = _arc_extent( p );
+	double sx, sy, ex, ey;
+	_arc_ends( p, extent, sx, sy, ex, ey );
+	box[0] = std::min( sx, ex ); box[2] = std::max( sx, ex );
+	box[1] = std::min( sy, ey ); box[3] = std::max( sy, ey );
+
+	for( int q = 0; q < 4; q ++ )
+	{
+		double delta = fmod( 90.0 * q - p.m_start, 360.0 );
+		if( delta < 0 ) delta += 360.0;
+		if( delta > extent ) continue;
+		double x = p.m_x0 + ( ( q == 0 )? p.m_r: ( q == 2 )? -p.m_r: 0 );
+		double y = p.m_y0 + ( ( q == 1 )? p.m_r: ( q == 3 )? -p.m_r: 0 );
+		box[0] = std::min( box[0], x ); box[2] = std::max( box[2], x );
+		box[1] = std::min( box[1], y ); box[3] = std::max( box[3], y );
+	}
+}
+
+//PostScript arcs go counterclockwise, adding 360 to end until it is not less than start
+void CVectorWriter::_arc( CVectorBuffer & out, int fmt, CVectorPrimitive & a )
+{
+	double extent = _arc_extent( a );
+
+	if( extent >= 360.0 )
+	{
+		if( fmt == SVG )
+		{
+			out << "<circle cx=\"" << a.m_x0 << "\" cy=\"" << m_height - a.m_y0 << "\" r=\"";
+			out.precise( a.m_r ) << "\"/>\n";
+			return;
+		}
+		out << a.m_x0 << " " << a.m_y0 << " ";
+		out.precise( a.m_r ) << " ";
+		out.precise( a.m_start ) << " ";
+		out.precise( a.m_end ) << " a\n";
+		return;
+	}
+
+	double sx, sy, ex, ey;
+	_arc_ends( a, extent, sx, sy, ex, ey );
+
+	if( fmt != SVG )
+	{
+		out << a.m_x0 << " " << a.m_y0 << " ";
+		out.precise( a.m_r ) << " ";
+		out.precise( a.m_start ) << " ";
+		out.precise( a.m_end ) << " a\n";
+		return;
+	}
+
+	//counterclockwise with y up is the negative sweep with y down
+	out << "<path d=\"M" << sx << " " << m_height - sy << "A";
+	out.precise( a.m_r ) << " ";
+	out.precise( a.m_r ) << " 0 " << ( ( extent > 180.0 )? 1: 0 ) << " 0 " << ex << " " << m_height - ey << "\"/>\n";
+}
+
+//sub-pixel primitive, the dot kept by the grid pass
+class CVectorDot
+{
+public:
+	long long m_cx, m_cy;
+	int       m_order;
+	double    m_x, m_y;
+
+	bool operator<( const CVectorDot & d ) const
+	{
+		if( m_cx != d.m_cx ) return m_cx < d.m_cx;
+		if( m_cy != d.m_cy ) return m_cy < d.m_cy;
+		return m_order < d.m_order;
+	}
+};
+
+static bool _dot_order( const CVectorDot & a, const CVectorDot & b ) { return a.m_order < b.m_order; }
+
+//end point of a line segment, snapped to 1/64 pixel for chaining
+class CVectorEnd
+{
+public:
+	long long m_x, m_y;
+	int       m_end;
+
+	bool operator<( const CVectorEnd & e ) const
+	{
+		if( m_x != e.m_x ) return m_x < e.m_x;
+		if( m_y != e.m_y ) return m_y < e.m_y;
+		return m_end < e.m_end;
+	}
+};
+
+//distance from (px,py) to the segment from (ax,ay) to (bx,by)
+static double _segment_distance( double px, double py, double ax, double ay, double bx, double by )
+{
+	double dx = bx - ax, dy = by - ay;
+	double l2 = dx * dx + dy * dy;
+	double t  = ( l2 > 0 )? ( ( px - ax ) * dx + ( py - ay ) * dy ) / l2: 0;
+	if( t < 0 ) t = 0;
+	if( t > 1 ) t = 1;
+	double x = ax + t * dx - px;
+	double y = ay + t * dy - py;
+	return sqrt( x * x + y * y );
+}
+
+/*!	the primitives are of one style; the segments are chained through shared end points in the order
+ *	they were added, each chain is simplified, then the sub-pixel ones are reduced to one dot per pixel;
+ *	an arc closer to its chord than the tolerance is chained as the chord, an arc whose bounding box
+ *	is smaller than a pixel is a dot, whatever its radius
+ */
+void CVectorWriter::_generate( std::vector<int> & ids, CVectorBuffer & out, int fmt, int * stats )
+{
+	std::vector<CVectorPrimitive> lines;
+	std::vector<CVectorDot> dots;
+	double box[4];
+
+	for( size_t k = 0; k < ids.size(); k ++ )
+	{
+		CVectorPrimitive & p = m_primitives[ ids[k] ];
+		if( p.m_type == CVectorPrimitive::LINE )
+		{
+			lines.push_back( p );
+			continue;
+		}
+
+		double extent = _arc_extent( p );
+		if( extent < 360.0 && _arc_sagitta( p, extent ) < m_tolerance * m_pixel )
+		{
+			CVectorPrimitive chord = p;
+			chord.m_type = CVectorPrimitive::LINE;
+			_arc_ends( p, extent, chord.m_x0, chord.m_y0, chord.m_x1, chord.m_y1 );
+			lines.push_back( chord );
+			continue;
+		}
+
+		_bounds( p, box );
+		if( box[2] - box[0] >= m_pixel || box[3] - box[1] >= m_pixel )
+		{
+			_arc( out, fmt, p );
+			stats[0] ++;
+			continue;
+		}
+		CVectorDot d;
+		d.m_x = ( box[0] + box[2] ) / 2;
+		d.m_y = ( box[1] + box[3] ) / 2;
+		d.m_order = (int) k;
+		dots.push_back( d );
+	}
+
+	//end point e = 2 * segment + 0/1, grouped by the snapped position
+	int nl = (int) lines.size();
+	double snap = 64.0 / m_pixel;
+	std::vector<CVectorEnd> ends( 2 * nl );
+	for( int i = 0; i < nl; i ++ )
+	{
+		CVectorPrimitive & p = lines[i];
+		ends[2*i].m_x   = (long long) floor( p.m_x0 * snap + 0.5 );
+		ends[2*i].m_y   = (long long) floor( p.m_y0 * snap + 0.5 );
+		ends[2*i].m_end = 2 * i;
+		ends[2*i+1].m_x   = (long long) floor( p.m_x1 * snap + 0.5 );
+		ends[2*i+1].m_y   = (long long) floor( p.m_y1 * snap + 0.5 );
+		ends[2*i+1].m_end = 2 * i + 1;
+	}
+	std::sort( ends.begin(), ends.end() );
+
+	std::vector<int> where( 2 * nl ), group( 2 * nl + 1 );
+	for( int k = 0; k < 2 * nl; k ++ )
+	{
+		where[ ends[k].m_end ] = k;
+		group[k] = ( k > 0 && ends[k].m_x == ends[k-1].m_x && ends[k].m_y == ends[k-1].m_y )? group[k-1]: k;
+	}
+
+	std::vector<char>   used( nl, 0 );
+	std::vector<int>    chain, back;
+	std::vector<double> xy;
+
+	for( int s = 0; s < nl; s ++ )
+	{
+		if( used[s] ) continue;
+		used[s] = 1;
+
+		//walk forward from the end of s, then backward from its start
+		chain.clear();
+		back.clear();
+		for( int dir = 0; dir < 2; dir ++ )
+		{
+			std::vector<int> & walk = ( dir == 0 )? chain: back;
+			int e = ( dir == 0 )? 2 * s + 1: 2 * s;
+			walk.push_back( e );
+			while( true )
+			{
+				int k = group[ where[e] ];
+				int next = -1;
+				for( ; k < 2 * nl && group[k] == group[ where[e] ]; k ++ )
+				{
+					if( used[ ends[k].m_end / 2 ] ) continue;
+					next = ends[k].m_end;
+					break;
+				}
+				if( next < 0 ) break;
+				used[ next / 2 ] = 1;
+				e = next ^ 1;
+				walk.push_back( e );
+			}
+		}
+
+		xy.clear();
+		for( int k = (int) back.size() - 1; k >= 0; k -- )
+		{
+			CVectorPrimitive & p = lines[ back[k] / 2 ];
+			xy.push_back( ( back[k] & 1 )? p.m_x1: p.m_x0 );
+			xy.push_back( ( back[k] & 1 )? p.m_y1: p.m_y0 );
+		}
+		for( size_t k = 0; k < chain.size(); k ++ )
+		{
+			CVectorPrimitive & p = lines[ chain[k] / 2 ];
+			xy.push_back( ( chain[k] & 1 )? p.m_x1: p.m_x0 );
+			xy.push_back( ( chain[k] & 1 )? p.m_y1: p.m_y0 );
+		}
+
+		//drop a vertex if the segment from the last kept vertex to the next one stays within the
+		//tolerance of all the dropped vertices, at most 64 in a row
+		int n = (int) xy.size() / 2;
+		double tol = m_tolerance * m_pixel;
+		int kept = 1, anchor = 0;
+		for( int i = 1; i < n; i ++ )
+		{
+			bool drop = ( i < n - 1 ) && ( i - anchor <= 64 );
+			for( int j = anchor + 1; drop && j <= i; j ++ )
+				drop = _segment_distance( xy[2*j], xy[2*j+1], xy[2*anchor], xy[2*anchor+1], xy[2*i+2], xy[2*i+3] ) <= tol;
+			if( drop )
+			{
+				stats[1] ++;
+				continue;
+			}
+			//kept vertices are compacted to the front, never past the ones still to be read
+			anchor = i;
+			xy[2*kept]   = xy[2*i];
+			xy[2*kept+1] = xy[2*i+1];
+			kept ++;
+		}
+		xy.resize( 2 * kept );
+
+		double xmin = xy[0], xmax = xy[0], ymin = xy[1], ymax = xy[1];
+		for( int i = 1; i < kept; i ++ )
+		{
+			xmin = std::min( xmin, xy[2*i] ); xmax = std::max( xmax, xy[2*i] );
+			ymin = std::min( ymin, xy[2*i+1] ); ymax = std::max( ymax, xy[2*i+1] );
+		}
+		if( xmax - xmin >= m_pixel || ymax - ymin >= m_pixel )
+		{
+			_polyline( out, fmt, xy );
+			stats[0] ++;
+			continue;
+		}
+		CVectorDot d;
+		d.m_x = ( xmin + xmax ) / 2;
+		d.m_y = ( ymin + ymax ) / 2;
+		d.m_order = (int) ids.size() + s;
+		dots.push_back( d );
+	}
+
+	//grid pass, the first dot of each pixel is kept
+	for( size_t k = 0; k < dots.size(); k ++ )
+	{
+		dots[k].m_cx = (long long) floor( dots[k].m_x / m_pixel );
+		dots[k].m_cy = (long long) floor( dots[k].m_y / m_pixel );
+	}
+	std::sort( dots.begin(), dots.end() );
+
+	std::vector<CVectorDot> keep;
+	for( size_t k = 0; k < dots.size(); k ++ )
+	{
+		if( k > 0 && dots[k].m_cx == dots[k-1].m_cx && dots[k].m_cy == dots[k-1].m_cy )
+		{
+			stats[2] ++;
+			continue;
+		}
+		keep.push_back( dots[k] );
+	}
+	std::sort( keep.begin(), keep.end(), _dot_order );
+
+	for( size_t k = 0; k < keep.size(); k ++ )
+	{
+		xy.resize( 2 );
+		xy[0] = keep[k].m_x;
+		xy[1] = keep[k].m_y;
+		_polyline( out, fmt, xy );
+		stats[0] ++;
+	}
+}
+
+//runs of one style are written in order; within a run the tiles are generated in parallel
+int CVectorWriter::_write( const char * filename, int fmt, int tiles )
+{
+	printf("Writing %s\n", filename );
+
+	FILE * fp = fopen( filename, "wb" );
+	if( fp == NULL )
+	{
+		printf("  Error:  Could not open %s\n", filename );
+		return 1;
+	}
+	if( tiles < 1 ) tiles = 1;
+	m_written = m_merged = m_culled = 0;
+
+	{
+		CVectorBuffer out( fp );
+		_head( out, fmt );
+
+		int n  = (int) m_primitives.size();
+		int nt = tiles * tiles;
+		double tw = m_width  / tiles;
+		double th = m_height / tiles;
+
+		for( int begin = 0; begin < n; )
+		{
+			int style = m_primitives[begin].m_style;
+			int end = begin;
+			while( end < n && m_primitives[end].m_style == style ) end ++;
+
+			_begin_style( out, fmt, style );
+
+			std::vector< std::vector<int> > bins( nt );
+			for( int k = begin; k < end; k ++ )
+			{
+				double box[4];
+				_bounds( m_primitives[k], box );
+				double x = ( box[0] + box[2] ) / 2;
+				double y = ( box[1] + box[3] ) / 2;
+				int tx = std::max( 0, std::min( tiles - 1, (int) floor( x / tw ) ) );
+				int ty = std::max( 0, std::min( tiles - 1, (int) floor( y / th ) ) );
+				bins[ ty * tiles + tx ].push_back( k );
+			}
+
+			std::vector<int> stats( 3 * nt, 0 );
+			if( nt == 1 )
+			{
+				_generate( bins[0], out, fmt, &stats[0] );
+			}
+			else
+			{
+				std::vector<CVectorBuffer> buffers( nt );
+#pragma omp parallel for schedule(dynamic)
+				for( int t = 0; t < nt; t ++ )
+					_generate( bins[t], buffers[t], fmt, &stats[3*t] );
+
+				for( int t = 0; t < nt; t ++ )
+				{
+					std::string & text = buffers[t].str();
+					out.append( text.data(), text.size() );
+					std::string().swap( text );
+				}
+			}
+			for( int t = 0; t < nt; t ++ )
+			{
+				m_written += stats[3*t];
+				m_merged  += stats[3*t+1];
+				m_culled  += stats[3*t+2];
+			}
+
+			_end_style( out, fmt );
+			begin = end;
+		}
+
+		_tail( out, fmt );
+	}
+
+	fclose( fp );
+	return 0;
+}
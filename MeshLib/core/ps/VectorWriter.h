@@ -0,0 +1,176 @@
+/*! \file VectorWriter.h
+*   \brief Streaming PostScript and SVG output with level of detail culling
+*
+*   Line segments and circular arcs are collected in screen coordinates, simplified
+*   at the output resolution and written through large buffers.
+*/
+#ifndef  _VECTOR_WRITER_H_
+#define  _VECTOR_WRITER_H_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "../Geometry/Point.h"
+#include "../Geometry/Point2.h"
+
+namespace MeshLib
+{
+	/*!	CVectorBuffer class
+	 *
+	 *	Text buffer, flushed to the file by one fwrite whenever it exceeds the capacity.
+	 *	Without a file it only grows, the per-tile buffers are concatenated by the caller.
+	 */
+	class CVectorBuffer
+	{
+	public:
+		CVectorBuffer( FILE * fp = NULL, size_t capacity = 1 << 22 );
+		~CVectorBuffer() { flush(); };
+
+		/*! write the buffer to the file */
+		void flush();
+		/*! append n characters */
+		void append( const char * s, size_t n );
+		/*! append a string */
+		CVectorBuffer & operator<<( const char * s );
+		/*! append a number in fixed point, two decimals, trailing zeros removed */
+		CVectorBuffer & operator<<( double v );
+		/*! append a number with all its significant digits, for arc radii and angles */
+		CVectorBuffer & precise( double v );
+		/*! append an integer */
+		CVectorBuffer & operator<<( int v );
+		/*! buffered text */
+		std::string & str() { return m_text; };
+
+	protected:
+		FILE      * m_fp;
+		size_t      m_capacity;
+		std::string m_text;
+	};
+
+	/*!	CVectorPrimitive class
+	 *
+	 *	Line segment from (x0,y0) to (x1,y1), or circular arc centered at (x0,y0) with radius r
+	 *	from angle start to end in degrees, counterclockwise. Screen coordinates, y up.
+	 */
+	class CVectorPrimitive
+	{
+	public:
+		enum { LINE, ARC };
+
+		int    m_type;
+		int    m_style;
+		double m_x0, m_y0;
+		double m_x1, m_y1;
+		double m_r, m_start, m_end;
+	};
+
+	/*!	CVectorWriter class
+	 *
+	 *	Vector output of a planar drawing, as PostScript, EPS or SVG. The primitives are kept
+	 *	until _write, which processes them in runs of the same color and line width:
+	 *	-	arcs closer to their chord than the tolerance are replaced by the chord, so the nearly
+	 *		straight geodesics are treated as line segments,
+	 *	-	line segments sharing end points are chained into polylines, and the vertices whose
+	 *		removal moves the polyline by less than the tolerance are dropped, so collinear and
+	 *		sub-pixel edges merge into longer segments,
+	 *	-	polylines and arcs whose bounding boxes are smaller than one pixel go through a screen
+	 *		space grid pass, which keeps one dot per pixel,
+	 *	-	with tiles > 1 the screen is split into tiles x tiles tiles, the primitives of each run are
+	 *		binned by the centers of their bounding boxes and the tiles are generated in parallel into their own buffers,
+	 *		which are concatenated in tile order; the output does not depend on the number of threads.
+	 *	Runs are written in the order of the calls, so later styles are drawn on top.
+	 *
+	 *	Usage
+	 *	\code
+	 *		CVectorWriter writer( 600, 600 );
+	 *		writer.view( 280, 280, 298, 298 );
+	 *		writer.color( 0, 0, 1 );
+	 *		writer.line( p, q );
+	 *		writer._write( "output.svg", CVectorWriter::format( "output.svg" ), 8 );
+	 *	\endcode
+	 */
+	class CVectorWriter
+	{
+	public:
+		enum { PS, EPS, SVG };
+
+		/*! page of width x height points, the origin is the lower left corner */
+		CVectorWriter( double width = 600, double height = 600 );
+		~CVectorWriter() {};
+
+		/*! screen = ( x * xscale + xoffset, y * yscale + yoffset ) for the following primitives */
+		void view( double xscale, double yscale, double xoffset, double yoffset );
+		/*! stroke color of the following primitives */
+		void color( double r, double g, double b );
+		/*! line width of the following primitives, in points */
+		void line_width( double w );
+
+		/*! line segment from p to q */
+		void line( CPoint2 p, CPoint2 q );
+		/*! circular arc, angles in degrees, counterclockwise from start to end */
+		void arc( CPoint2 c, double r, double start = 0, double end = 360 );
+
+		/*! size of one output pixel in points */
+		double & pixel() { return m_pixel; };
+		/*! largest displacement of a merged polyline, in pixels */
+		double & tolerance() { return m_tolerance; };
+
+		/*! write all the primitives
+		 *  \param filename output file
+		 *  \param fmt PS, EPS or SVG
+		 *  \param tiles tiles per side of the screen, 1 for serial generation
+		 *  \return 0 on success
+		 */
+		int  _write( const char * filename, int fmt, int tiles = 1 );
+		/*! SVG for the ".svg" extension, EPS for ".eps", PS otherwise */
+		static int format( const char * filename );
+		/*! remove the primitives, the view and the style are kept */
+		void clear() { m_primitives.clear(); };
+
+		/*! number of primitives added */
+		int  primitives() { return (int) m_primitives.size(); };
+		/*! statistics of the last _write: paths written, vertices merged away, sub-pixel primitives dropped */
+		int  written() { return m_written; };
+		int  merged()  { return m_merged; };
+		int  culled()  { return m_culled; };
+
+	protected:
+		/*! stroke color and width */
+		class CStyle
+		{
+		public:
+			double m_rgb[3];
+			double m_width;
+		};
+
+		/*! style of the next primitive, a new style is created once it is used */
+		int  _style();
+		void _head( CVectorBuffer & out, int fmt );
+		void _tail( CVectorBuffer & out, int fmt );
+		void _begin_style( CVectorBuffer & out, int fmt, int style );
+		void _end_style( CVectorBuffer & out, int fmt );
+		/*! generate the primitives ids, all of one style; the statistics are added to stats */
+		void _generate( std::vector<int> & ids, CVectorBuffer & out, int fmt, int * stats );
+		/*! polyline, or a dot if it has one point */
+		void _polyline( CVectorBuffer & out, int fmt, std::vector<double> & xy );
+		void _arc( CVectorBuffer & out, int fmt, CVectorPrimitive & a );
+
+		double m_width;
+		double m_height;
+		double m_xscale, m_yscale, m_xoffset, m_yoffset;
+		double m_pixel;
+		double m_tolerance;
+
+		CStyle m_current;
+		bool   m_current_used;
+		std::vector<CStyle>           m_styles;
+		std::vector<CVectorPrimitive> m_primitives;
+
+		int m_written;
+		int m_merged;
+		int m_culled;
+	};
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "ps.h"
+#include "../Trace/Trace.h"
 
 using namespace MeshLib;
 
@@ -24,97 +25,46 @@ float initial_line_width = 0.3;
 
 int count = 0; 
 
-int print_head(const char * fname, FILE ** file, int eps)
+//the page is XMAX x YMAX points, the unit disk is centered at (XCENTER,YCENTER)
+static void begin_page( CVectorWriter & writer )
 {
-  printf("Writing %s\n", fname);
-
-  *file = fopen(fname, "w");
- 
-  if (*file == (FILE *) NULL) {
-    printf("  Error:  Could not open %s\n", fname);
-    return 1;
-  }
-  if (eps) {
-    fprintf(*file, "%%!PS-Adobe-3.0 EPSF-3.0\n");
-  } else {
-    fprintf(*file, "%%!PS-Adobe-2.0\n");
-  }
-  fprintf(*file, "%%%%BoundingBox: %d %d %d %d\n", XMIN,YMIN,XMAX,YMAX);
-  fprintf(*file, "%%%%Creator: CCGL\n");
-  fprintf(*file, "%%%%EndComments\n\n");
-  fprintf(*file, "1 setlinecap\n");
-  fprintf(*file, "1 setlinejoin\n");
-  fprintf(*file, "%f setlinewidth\n", initial_line_width);
-  fprintf(*file, "%d %d moveto\n", XMIN, YMIN);
-  fprintf(*file, "%d %d lineto\n", XMAX, XMIN);
-  fprintf(*file, "%d %d lineto\n", XMAX, YMAX);
-  fprintf(*file, "%d %d lineto\n", XMIN, YMAX);
-  fprintf(*file, "closepath\nclip\nnewpath\n");
-  return 0;
+	writer.view( XSCALE, YSCALE, XCENTER, YCENTER );
+	writer.line_width( initial_line_width );
 }
 
+static int page_format( const char * fname, int eps )
+{
+	int format = CVectorWriter::format( fname );
+	if( format == CVectorWriter::PS && eps ) format = CVectorWriter::EPS;
+	return format;
+}
 
-void print_edge_eps( FILE * edgefile, CPoint2  point1, CPoint2  point2, double   xscale,double   yscale, double   xoffset, double   yoffset)
+void print_edge_eps( CVectorWriter & writer, CPoint2  point1, CPoint2  point2 )
 {
-      fprintf(edgefile, "%d %d moveto\n",
-              (int) ( point1[0] * xscale + xoffset),
-              (int) ( point1[1] * yscale + yoffset));
-      fprintf(edgefile, "%d %d lineto\nstroke\n",
-              (int) ( point2[0] * xscale + xoffset),
-              (int) ( point2[1] * yscale + yoffset));
+	writer.line( point1, point2 );
 }
 
 //miao
-void print_circle_eps(FILE *   circlefile, 
+void print_circle_eps( CVectorWriter & writer, 
 				      CPoint2  center,
 					  double   radius,
-					  double   xscale, 
-				      double   yscale, 
-				      double   xoffset, 
-				      double   yoffset,
 					  double   start,
 					  double   end )
 {
-	fprintf(circlefile,"newpath\n");
-
-
-		fprintf(circlefile, "%f %f %f %f %f arc\nstroke\n", 
-             ( center[0] * xscale + xoffset),
-             ( center[1] * yscale + yoffset),
- 			 ( radius * xscale), start, end );
-	
+	writer.arc( center, radius, start, end );
 }
 
 int compute_geodesic_center( CPoint2 start, CPoint2 end , CPoint2 & center)
 {
-	double m[2][2];
-	double v[2];
-	double im[2][2];
-
-
-	m[0][0] = 2 * start[0]; 	m[0][1] = 2 * start[1];
-	m[1][0] = 2 * end[0]; 		m[1][1] = 2 * end[1];
-	
-	v[0] = start[0] * start[0] + start[1] * start[1] + 1.0;
-	v[1] = end[0] * end[0] + end[1] * end[1] + 1.0;
-
-	double det = m[0][0] * m[1][1] - m[1][0] * m[0][1];
-
-	if( abs(det) < 1e-5 ) return 0; //straight line
-
-	im[0][0] =  m[1][1]/det;
-	im[1][1] =  m[0][0]/det;
-	im[0][1] = -m[0][1]/det;
-	im[1][0] = -m[1][0]/det;
-
-
-	center[0] = im[0][0] * v[0] + im[0][1] * v[1];
-	center[1] = im[1][0] * v[0] + im[1][1] * v[1];
+	Complex C;
+	double  R;
+	if( !_hyperbolic_geodesic( Complex( start[0], start[1] ), Complex( end[0], end[1] ), C, R ) ) return 0; //straight line
 
+	center = CPoint2( C.real(), C.imag() );
 	return 1;
 }
 
-void print_circle( FILE * psfile, CPoint2 start, CPoint2 end )
+void print_circle( CVectorWriter & writer, CPoint2 start, CPoint2 end )
 {
 	
 	CPoint2 center;
@@ -155,16 +105,12 @@ void print_circle( FILE * psfile, CPoint2 start, CPoint2 end )
 		double sd = ( sa *  180.0 / PI );
 		double ed = ( ea *  180.0 / PI );
 
-        fprintf(psfile, "%f %f moveto\n",
-                 (start[0] * XSCALE + XCENTER),
-                 (start[1] * YSCALE + YCENTER));
-
-		print_circle_eps( psfile, center, radius, XSCALE,YSCALE,XCENTER,YCENTER, sd,ed );
+		print_circle_eps( writer, center, radius, sd, ed );
  }
 	else
 	{
 		count++;
-		print_edge_eps( psfile, start, end , XSCALE,YSCALE, XCENTER,YCENTER );
+		print_edge_eps( writer, start, end );
 	}
 
 }
@@ -174,12 +120,8 @@ void print_circle( FILE * psfile, CPoint2 start, CPoint2 end )
 
 void CPs::print(  const char * psfilename )
 {
-  FILE *psfile;
-  
-  if (print_head(psfilename, &psfile,  m_eps)) 
-  {
-    return;
-  }
+  CVectorWriter writer( XMAX - XMIN, YMAX - YMIN );
+  begin_page( writer );
 
   //print ideal circle
 
@@ -201,8 +143,8 @@ for( CRFMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
 		
 	  CPoint2  point1 = v1->huv();
 	  CPoint2  point2 = v2->huv();
-	  //print_edge_eps( psfile, point1, point2, XSCALE, YSCALE, XCENTER, YCENTER );
-      //print_circle( psfile, point1, point2 );
+	  //print_edge_eps( writer, point1, point2 );
+      //print_circle( writer, point1, point2 );
   }
 
 
@@ -212,14 +154,14 @@ for( CRFMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
 
 	  CPoint2 c = pV->huv();
 	  double  r = exp( pV->u() ) * 2.0;
-	  print_circle_eps( psfile, c, r, XSCALE, YSCALE, XCENTER, YCENTER, 0.0, 360.0 );
+	  print_circle_eps( writer, c, r, 0.0, 360.0 );
 
 /*
 	  CPoint2 C;
 	  double  R;
 	  _hyperbolic_euclidean( c, r, C, R );
 
-	  print_circle_eps( psfile, C, R, XSCALE, YSCALE, XCENTER, YCENTER, 0.0, 360.0 );
+	  print_circle_eps( writer, C, R, 0.0, 360.0 );
 */
   }
 	
@@ -234,79 +176,69 @@ for( CRFMesh::MeshVertexIterator viter( m_pMesh ); !viter.end(); viter ++ )
 		Vertex v2 = mesh.idvertex(3393+id*3700);		
 		Point  point1 = mesh.point(v1);
 		Point  point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3393+id*3700);
 		 v2 = mesh.idvertex(3396+id*3700);		
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3396+id*3700);
 		 v2 = mesh.idvertex(3395+id*3700);		
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3395+id*3700);
 		 v2 = mesh.idvertex(3394+id*3700);	
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3394+id*3700);
 		 v2 = mesh.idvertex(3397+id*3700);	
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3397+id*3700);
 		 v2 = mesh.idvertex(3400+id*3700);
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3400+id*3700);
 		 v2 = mesh.idvertex(3399+id*3700);
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3399+id*3700);
 		 v2 = mesh.idvertex(3398+id*3700);
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 		id = id+6;
 
 		}
 */
-  if (!m_eps) {
-    fprintf(psfile, "showpage\n");
-  }
- 
-  fprintf(psfile, "0 0 1 setrgbcolor\n");
-  print_circle_eps( psfile, CPoint2(0,0), 1.0, XSCALE, YSCALE, XCENTER,YCENTER, 0, 360 ); 
+  writer.color( 0, 0, 1 );
+  print_circle_eps( writer, CPoint2(0,0), 1.0, 0, 360 ); 
 
   printf("count  %d\n", count);
-  fclose(psfile);
+  writer._write( psfilename, page_format( psfilename, m_eps ) );
+  TRACE_GAUGE( "CPs::print paths", writer.written() );
+  TRACE_GAUGE( "CPs::print merged vertices", writer.merged() );
+  TRACE_GAUGE( "CPs::print culled", writer.culled() );
 }
 
 
 void  CPs::_hyperbolic_euclidean( CPoint2 c, double r, CPoint2 & C, double & R ) //converting a hyperbolic circle (c,r) to a Euclidean circle (C,R)
 {
-	double norm = c[0]*c[0]+c[1]*c[1];
-	double mu = (exp(r)-1.0)/(exp(r)+1.0);
-	mu = mu * mu;
-	double a = 1 - mu * norm;
-
-	double B = 2.0 * ( mu - 1.0) * c[0]/a;
-	double E = 2.0 * ( mu - 1.0) * c[1]/a;
-	double D = (norm - mu)/a;
-
-	C[0] = -B/2.0;
-	C[1] = -E/2.0;
-	R    = sqrt( B*B/4.0+E*E/4.0-D);
+	Complex center;
+	_hyperbolic_circle( Complex( c[0], c[1] ), r, center, R );
+	C = CPoint2( center.real(), center.imag() );
 }
 
 
@@ -314,12 +246,8 @@ void  CPs::_hyperbolic_euclidean( CPoint2 c, double r, CPoint2 & C, double & R )
 
 void CPs::hyperbolic_print( const  char * psfilename )
 {
-  FILE *psfile;
-  
-  if (print_head(psfilename, &psfile,  m_eps)) 
-  {
-    return;
-  }
+  CVectorWriter writer( XMAX - XMIN, YMAX - YMIN );
+  begin_page( writer );
 
 
   for( CRFMesh::MeshEdgeIterator eiter( m_pMesh); !eiter.end(); eiter ++ )
@@ -332,7 +260,7 @@ void CPs::hyperbolic_print( const  char * psfilename )
 	  CPoint2  point1 = v1->huv();
 	  CPoint2  point2 = v2->huv();
 	
-      print_circle( psfile, point1, point2 );
+      print_circle( writer, point1, point2 );
   }
 
 
@@ -348,7 +276,7 @@ void CPs::hyperbolic_print( const  char * psfilename )
 	  double  R;
 	  _hyperbolic_euclidean( c, r, C, R );
 
-	  print_circle_eps( psfile, C, R, XSCALE, YSCALE, XCENTER, YCENTER, 0.0, 360.0 );
+	  print_circle_eps( writer, C, R, 0.0, 360.0 );
 
   }
 	
@@ -363,63 +291,62 @@ void CPs::hyperbolic_print( const  char * psfilename )
 		Vertex v2 = mesh.idvertex(3393+id*3700);		
 		Point  point1 = mesh.point(v1);
 		Point  point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3393+id*3700);
 		 v2 = mesh.idvertex(3396+id*3700);		
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3396+id*3700);
 		 v2 = mesh.idvertex(3395+id*3700);		
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3395+id*3700);
 		 v2 = mesh.idvertex(3394+id*3700);	
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3394+id*3700);
 		 v2 = mesh.idvertex(3397+id*3700);	
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3397+id*3700);
 		 v2 = mesh.idvertex(3400+id*3700);
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3400+id*3700);
 		 v2 = mesh.idvertex(3399+id*3700);
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 
 		 v1 = mesh.idvertex(3399+id*3700);
 		 v2 = mesh.idvertex(3398+id*3700);
 	    point1 = mesh.point(v1);
 		point2 = mesh.point(v2);
-		print_circle( psfile, point1,point2 );
+		print_circle( writer, point1,point2 );
 		id = id+6;
 
 		}
 */
-  if (!m_eps) {
-    fprintf(psfile, "showpage\n");
-  }
-
-  fprintf(psfile, "1 0 0 setrgbcolor\n");
-  print_circle_eps( psfile, CPoint2(0,0), 0.005, XSCALE, YSCALE, XCENTER,YCENTER, 0, 360 ); 
+  writer.color( 1, 0, 0 );
+  print_circle_eps( writer, CPoint2(0,0), 0.005, 0, 360 ); 
 
-  fprintf(psfile, "0 0 1 setrgbcolor\n");
-  print_circle_eps( psfile, CPoint2(0,0), 1.0, XSCALE, YSCALE, XCENTER,YCENTER, 0, 360 ); 
+  writer.color( 0, 0, 1 );
+  print_circle_eps( writer, CPoint2(0,0), 1.0, 0, 360 ); 
 
   printf("count  %d\n", count);
-  fclose(psfile);
+  writer._write( psfilename, page_format( psfilename, m_eps ) );
+  TRACE_GAUGE( "CPs::hyperbolic_print paths", writer.written() );
+  TRACE_GAUGE( "CPs::hyperbolic_print merged vertices", writer.merged() );
+  TRACE_GAUGE( "CPs::hyperbolic_print culled", writer.culled() );
 }
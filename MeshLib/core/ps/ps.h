@@ -6,6 +6,8 @@
 
 #include "Riemannian/RicciFlow/RicciFlowMesh.h"
 #include "Geometry/Point2.h"
+#include "Geometry/HyperbolicBatch.h"
+#include "VectorWriter.h"
 
 namespace MeshLib
 {
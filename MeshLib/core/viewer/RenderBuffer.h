@@ -0,0 +1,92 @@
+/*!
+*      \file RenderBuffer.h
+*      \brief Interleaved corner arrays for drawing with vertex arrays
+*
+*/
+
+#ifndef _RENDER_BUFFER_H_
+#define _RENDER_BUFFER_H_
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "SoftRenderer.h"
+
+namespace MeshLib
+{
+/*!
+ *	\brief CRenderBuffer class
+ *
+ *  The corners of a triangle list, three per face in face order, packed once per load or edit
+ *  into one float array: uv, rgb, normal and point of each corner, STRIDE floats apart. The
+ *  array is passed to glTexCoordPointer, glColorPointer, glNormalPointer and glVertexPointer,
+ *  or copied into a buffer object. The corners written since the last clean() are kept as
+ *  ranges, so that only those are uploaded again.
+ */
+class CRenderBuffer
+{
+public:
+	/*! offsets of the attributes in a corner, and the corner size, in floats */
+	enum { UV = 0, RGB = 2, NORMAL = 5, POINT = 8, STRIDE = 11 };
+
+	CRenderBuffer() { m_corners = 0; };
+
+	/*! resize to n corners, all of them dirty */
+	void resize( int n )
+	{
+		m_corners = n;
+		m_data.resize( STRIDE * n );
+		m_ranges.clear();
+		dirty( 0, n );
+	};
+	/*! number of corners */
+	int corners() { return m_corners; };
+
+	/*! write corner i, the caller marks it dirty */
+	void set( int i, const CRenderCorner & c )
+	{
+		float * p = &m_data[ STRIDE * i ];
+		p[UV]   = (float) c.m_uv[0];
+		p[UV+1] = (float) c.m_uv[1];
+		for( int k = 0; k < 3; k ++ )
+		{
+			p[RGB+k]    = (float) c.m_rgb[k];
+			p[NORMAL+k] = (float) c.m_normal[k];
+			p[POINT+k]  = (float) c.m_point[k];
+		}
+	};
+
+	/*! first float of the attribute of corner 0 */
+	const float * data( int attribute = 0 ) { return m_data.empty()? NULL: &m_data[attribute]; };
+	/*! distance between two corners in bytes */
+	int stride() { return STRIDE * sizeof(float); };
+
+	/*! mark the corners first .. first + count - 1 as changed, merged with the last range if they touch */
+	void dirty( int first, int count )
+	{
+		if( count <= 0 ) return;
+		if( !m_ranges.empty() )
+		{
+			std::pair<int,int> & r = m_ranges.back();
+			if( first >= r.first && first <= r.first + r.second )
+			{
+				r.second = std::max( r.second, first + count - r.first );
+				return;
+			}
+		}
+		m_ranges.push_back( std::pair<int,int>( first, count ) );
+	};
+	/*! changed corners as ( first, count ) */
+	std::vector< std::pair<int,int> > & ranges() { return m_ranges; };
+	/*! all the changes are uploaded */
+	void clean() { m_ranges.clear(); };
+
+protected:
+	int m_corners;
+	std::vector<float> m_data;
+	std::vector< std::pair<int,int> > m_ranges;
+};
+
+}
+#endif
@@ -0,0 +1,329 @@
+/*!
+*      \file SoftRenderer.h
+*      \brief Offscreen software rasterizer
+*
+*/
+
+#ifndef _SOFT_RENDERER_H_
+#define _SOFT_RENDERER_H_
+
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#include "../Geometry/Point.h"
+#include "../Geometry/Point2.h"
+#include "../bmp/RgbImage.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* tile size of the rasterizer in pixels */
+#define SOFT_RENDERER_TILE 32
+
+namespace MeshLib
+{
+/*!
+ *	\brief CRenderCorner class
+ *
+ *  Attributes of one triangle corner, as passed to glNormal, glTexCoord, glColor and glVertex
+ */
+class CRenderCorner
+{
+public:
+	CPoint  m_point;
+	CPoint  m_normal;
+	CPoint  m_rgb;
+	CPoint2 m_uv;
+};
+
+/*!
+ *	\brief CSoftRenderer class
+ *
+ *  CPU replacement of the fixed function OpenGL pipeline used by the viewer, for rendering
+ *  without a GPU or a display:
+ *  - per vertex lighting by directional lights in eye coordinates, with a global ambient term
+ *    and the color used as ambient and diffuse material,
+ *  - back faces culled, counterclockwise front faces,
+ *  - perspective correct color and texture coordinates, bilinear lookup in the tiled texels of
+ *    the RgbImage with repeat wrapping, replace or modulate mode,
+ *  - z-buffer with the less test, so of two coplanar triangles the first one wins.
+ *  Triangles are binned to tiles of SOFT_RENDERER_TILE pixels, the tiles are rasterized in parallel,
+ *  each thread owns the color and depth of its tile, so the image does not depend on the number of threads.
+ *  Triangles crossing the near plane are dropped.
+ */
+class CSoftRenderer
+{
+public:
+	/*!
+	 *	CSoftRenderer constructor
+	 *  \param width  image width
+	 *  \param height image height
+	 */
+	CSoftRenderer( int width, int height )
+	{
+		m_width  = width;
+		m_height = height;
+		m_ambient = 0;
+		m_texture = NULL;
+		m_texture_mode = 0;
+		m_background = CPoint( 1, 1, 1 );
+		for( int i = 0; i < 16; i ++ ) m_modelview[i] = m_projection[i] = ( i % 5 == 0 )? 1: 0;
+	};
+
+	/*! projection as gluPerspective */
+	void perspective( double fovy, double aspect, double znear, double zfar )
+	{
+		double f = 1.0 / tan( fovy * 3.14159265358979323846 / 360.0 );
+		for( int i = 0; i < 16; i ++ ) m_projection[i] = 0;
+		m_projection[0]  = f / aspect;
+		m_projection[5]  = f;
+		m_projection[10] = ( zfar + znear ) / ( znear - zfar );
+		m_projection[11] = -1;
+		m_projection[14] = 2 * zfar * znear / ( znear - zfar );
+	};
+	/*! model view matrix, column major as glMultMatrixd */
+	void modelview( const double * m ) { for( int i = 0; i < 16; i ++ ) m_modelview[i] = m[i]; };
+	/*! add a directional light of unit diffuse intensity, the direction to the light in eye coordinates */
+	void light( CPoint direction ) { m_lights.push_back( direction / direction.norm() ); };
+	/*! global ambient intensity */
+	double & ambient() { return m_ambient; };
+	/*! clear color */
+	CPoint & background() { return m_background; };
+	/*! texture image, mode 0 off, 1 replace, 2 modulate */
+	void texture( RgbImage * image, int mode ) { m_texture = image; m_texture_mode = ( image != NULL && image->ImageLoaded() )? mode: 0; };
+
+	/*! queue a triangle */
+	void triangle( const CRenderCorner & c0, const CRenderCorner & c1, const CRenderCorner & c2 )
+	{
+		m_corners.push_back( c0 );
+		m_corners.push_back( c1 );
+		m_corners.push_back( c2 );
+	};
+	/*! remove the queued triangles */
+	void clear() { m_corners.clear(); };
+
+	/*! rasterize the queued triangles */
+	void _render();
+	/*! write the image, bottom row first as glReadPixels */
+	bool write( const char * filename );
+
+	/*! rendered color of pixel (x,y), y upward */
+	const float * pixel( int x, int y ) const { return &m_color[ 3 * ( y * m_width + x ) ]; };
+
+protected:
+	/*! triangle in screen coordinates, the attributes are divided by w */
+	class CScreenTriangle
+	{
+	public:
+		double m_x[3], m_y[3], m_z[3];
+		double m_w[3];
+		double m_attr[3][5];
+	};
+
+	void _vertex( const CRenderCorner & c, double * screen, double & w, double * attr );
+	void _tile( int tx, int ty, std::vector<int> & bin, std::vector<CScreenTriangle> & tris );
+
+	int m_width;
+	int m_height;
+	double m_modelview[16];
+	double m_projection[16];
+	std::vector<CPoint> m_lights;
+	double m_ambient;
+	CPoint m_background;
+	RgbImage * m_texture;
+	int m_texture_mode;
+
+	std::vector<CRenderCorner> m_corners;
+	std::vector<float> m_color;
+	std::vector<float> m_depth;
+};
+
+/*! transform and light one corner; screen gets x, y in pixels and z in [0,1], attr the lit rgb and uv */
+inline void CSoftRenderer::_vertex( const CRenderCorner & c, double * screen, double & w, double * attr )
+{
+	const double * m = m_modelview;
+	double e[4], n[3];
+	for( int i = 0; i < 4; i ++ )
+		e[i] = m[i] * c.m_point[0] + m[4+i] * c.m_point[1] + m[8+i] * c.m_point[2] + m[12+i];
+	//the model view has no scaling, as the viewer's rotation and translation
+	for( int i = 0; i < 3; i ++ )
+		n[i] = m[i] * c.m_normal[0] + m[4+i] * c.m_normal[1] + m[8+i] * c.m_normal[2];
+	double len = sqrt( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+	if( len > 0 ) for( int i = 0; i < 3; i ++ ) n[i] /= len;
+
+	double intensity = m_ambient;
+	for( size_t k = 0; k < m_lights.size(); k ++ )
+	{
+		double d = n[0] * m_lights[k][0] + n[1] * m_lights[k][1] + n[2] * m_lights[k][2];
+		if( d > 0 ) intensity += d;
+	}
+	for( int i = 0; i < 3; i ++ ) attr[i] = std::min( 1.0, c.m_rgb[i] * intensity );
+	attr[3] = c.m_uv[0];
+	attr[4] = c.m_uv[1];
+
+	const double * p = m_projection;
+	double clip[4];
+	for( int i = 0; i < 4; i ++ )
+		clip[i] = p[i] * e[0] + p[4+i] * e[1] + p[8+i] * e[2] + p[12+i] * e[3];
+
+	w = clip[3];
+	screen[0] = ( clip[0] / w + 1.0 ) * 0.5 * m_width;
+	screen[1] = ( clip[1] / w + 1.0 ) * 0.5 * m_height;
+	screen[2] = ( clip[2] / w + 1.0 ) * 0.5;
+}
+
+/*! rasterize the triangles of one tile with edge functions, pixel centers at half integers,
+ *  the top left rule decides the pixels on shared edges */
+inline void CSoftRenderer::_tile( int tx, int ty, std::vector<int> & bin, std::vector<CScreenTriangle> & tris )
+{
+	int x0 = tx * SOFT_RENDERER_TILE, x1 = std::min( m_width,  x0 + SOFT_RENDERER_TILE );
+	int y0 = ty * SOFT_RENDERER_TILE, y1 = std::min( m_height, y0 + SOFT_RENDERER_TILE );
+
+	for( size_t k = 0; k < bin.size(); k ++ )
+	{
+		CScreenTriangle & t = tris[ bin[k] ];
+
+		double xmin = std::min( t.m_x[0], std::min( t.m_x[1], t.m_x[2] ) );
+		double xmax = std::max( t.m_x[0], std::max( t.m_x[1], t.m_x[2] ) );
+		double ymin = std::min( t.m_y[0], std::min( t.m_y[1], t.m_y[2] ) );
+		double ymax = std::max( t.m_y[0], std::max( t.m_y[1], t.m_y[2] ) );
+		int px0 = std::max( x0, (int) ceil( xmin - 0.5 ) );
+		int px1 = std::min( x1 - 1, (int) floor( xmax - 0.5 ) );
+		int py0 = std::max( y0, (int) ceil( ymin - 0.5 ) );
+		int py1 = std::min( y1 - 1, (int) floor( ymax - 0.5 ) );
+		if( px0 > px1 || py0 > py1 ) continue;
+
+		//edge i is opposite to corner i, e_i(x,y) = a_i x + b_i y + c_i, positive inside
+		double a[3], b[3], c[3];
+		bool   top_left[3];
+		for( int i = 0; i < 3; i ++ )
+		{
+			int j = ( i + 1 ) % 3, l = ( i + 2 ) % 3;
+			a[i] = t.m_y[j] - t.m_y[l];
+			b[i] = t.m_x[l] - t.m_x[j];
+			c[i] = t.m_x[j] * t.m_y[l] - t.m_x[l] * t.m_y[j];
+			top_left[i] = ( a[i] > 0 ) || ( a[i] == 0 && b[i] < 0 );
+		}
+		double area = c[0] + c[1] + c[2];
+		if( area <= 0 ) continue;
+		double inv = 1.0 / area;
+
+		for( int y = py0; y <= py1; y ++ )
+		{
+			double cy = y + 0.5;
+			for( int x = px0; x <= px1; x ++ )
+			{
+				double cx = x + 0.5;
+				double e[3];
+				bool inside = true;
+				for( int i = 0; i < 3 && inside; i ++ )
+				{
+					e[i] = a[i] * cx + b[i] * cy + c[i];
+					inside = ( e[i] > 0 ) || ( e[i] == 0 && top_left[i] );
+				}
+				if( !inside ) continue;
+
+				double l0 = e[0] * inv, l1 = e[1] * inv, l2 = e[2] * inv;
+				double z = l0 * t.m_z[0] + l1 * t.m_z[1] + l2 * t.m_z[2];
+				int id = y * m_width + x;
+				if( !( z < m_depth[id] ) ) continue;
+				m_depth[id] = (float) z;
+
+				double q = l0 * t.m_w[0] + l1 * t.m_w[1] + l2 * t.m_w[2];
+				double attr[5];
+				for( int i = 0; i < 5; i ++ )
+					attr[i] = ( l0 * t.m_attr[0][i] + l1 * t.m_attr[1][i] + l2 * t.m_attr[2][i] ) / q;
+
+				if( m_texture_mode != 0 )
+				{
+					double texel[3];
+					m_texture->Sample( attr[3], attr[4], texel );
+					for( int i = 0; i < 3; i ++ )
+						attr[i] = ( m_texture_mode == 1 )? texel[i]: attr[i] * texel[i];
+				}
+				for( int i = 0; i < 3; i ++ ) m_color[ 3 * id + i ] = (float) attr[i];
+			}
+		}
+	}
+}
+
+/*! the vertex stage runs in parallel over the triangles, the binning is serial to keep the
+ *  triangle order in each tile, then the tiles are rasterized in parallel */
+inline void CSoftRenderer::_render()
+{
+	int nt = (int) m_corners.size() / 3;
+	std::vector<CScreenTriangle> tris( nt );
+	std::vector<char> visible( nt, 0 );
+
+#pragma omp parallel for schedule(static)
+	for( int f = 0; f < nt; f ++ )
+	{
+		CScreenTriangle & t = tris[f];
+		bool valid = true;
+		for( int j = 0; j < 3; j ++ )
+		{
+			double s[3], w;
+			_vertex( m_corners[ 3 * f + j ], s, w, t.m_attr[j] );
+			//behind the near plane, z_ndc < -1
+			if( w <= 0 || s[2] < 0 ) valid = false;
+			t.m_x[j] = s[0];
+			t.m_y[j] = s[1];
+			t.m_z[j] = s[2];
+			t.m_w[j] = 1.0 / w;
+			for( int i = 0; i < 5; i ++ ) t.m_attr[j][i] *= t.m_w[j];
+		}
+		if( !valid ) continue;
+		//counterclockwise with y upward is front facing
+		double area = ( t.m_x[1] - t.m_x[0] ) * ( t.m_y[2] - t.m_y[0] ) - ( t.m_y[1] - t.m_y[0] ) * ( t.m_x[2] - t.m_x[0] );
+		visible[f] = ( area > 0 );
+	}
+
+	int ntx = ( m_width  + SOFT_RENDERER_TILE - 1 ) / SOFT_RENDERER_TILE;
+	int nty = ( m_height + SOFT_RENDERER_TILE - 1 ) / SOFT_RENDERER_TILE;
+	std::vector< std::vector<int> > bins( ntx * nty );
+
+	for( int f = 0; f < nt; f ++ )
+	{
+		if( !visible[f] ) continue;
+		CScreenTriangle & t = tris[f];
+		double xmin = std::min( t.m_x[0], std::min( t.m_x[1], t.m_x[2] ) );
+		double xmax = std::max( t.m_x[0], std::max( t.m_x[1], t.m_x[2] ) );
+		double ymin = std::min( t.m_y[0], std::min( t.m_y[1], t.m_y[2] ) );
+		double ymax = std::max( t.m_y[0], std::max( t.m_y[1], t.m_y[2] ) );
+		if( xmax < 0 || ymax < 0 || xmin > m_width || ymin > m_height ) continue;
+
+		int bx0 = std::max( 0, (int) floor( xmin ) / SOFT_RENDERER_TILE ), bx1 = std::min( ntx - 1, (int) floor( xmax ) / SOFT_RENDERER_TILE );
+		int by0 = std::max( 0, (int) floor( ymin ) / SOFT_RENDERER_TILE ), by1 = std::min( nty - 1, (int) floor( ymax ) / SOFT_RENDERER_TILE );
+		for( int by = by0; by <= by1; by ++ )
+		for( int bx = bx0; bx <= bx1; bx ++ )
+			bins[ by * ntx + bx ].push_back( f );
+	}
+
+	m_color.resize( 3 * m_width * m_height );
+	m_depth.assign( m_width * m_height, 1.0f );
+	for( int i = 0; i < m_width * m_height; i ++ )
+		for( int j = 0; j < 3; j ++ ) m_color[ 3 * i + j ] = (float) m_background[j];
+	//the tiled texels are built once, the tiles only read them
+	if( m_texture_mode != 0 ) m_texture->BuildMipmaps();
+
+#pragma omp parallel for schedule(dynamic)
+	for( int b = 0; b < ntx * nty; b ++ )
+		_tile( b % ntx, b / ntx, bins[b], tris );
+}
+
+inline bool CSoftRenderer::write( const char * filename )
+{
+	RgbImage image( m_height, m_width );
+	for( int y = 0; y < m_height; y ++ )
+	for( int x = 0; x < m_width; x ++ )
+	{
+		const float * c = pixel( x, y );
+		image.SetRgbPixelf( y, x, c[0], c[1], c[2] );
+	}
+	return image.WriteBmpFile( filename );
+}
+
+}
+#endif
@@ -8,6 +8,8 @@
 *
 */
 
+#include <string.h>
+
 #include "Structure/Structure.h"
 //for Extremal Lengths
 #include "Riemannian/RicciFlow/TangentialRicciExtremalLength.h"
@@ -23,8 +25,9 @@ unsigned int CRicciFlowVertex::traits = 0;
 *
 *******************************************************************************************************************************/
 
-//-tangent_ricci_extremal_length sophie.remesh.m sophie.uv.m
-void _tangent_ricci_extremal_length( const char * _input_mesh, const char * _mesh_with_uv )
+//-tangent_ricci_extremal_length sophie.remesh.m sophie.uv.m [-parallel]
+//with -parallel the faces on the same level of the embedding are embedded in parallel
+void _tangent_ricci_extremal_length( const char * _input_mesh, const char * _mesh_with_uv, bool _parallel )
 {
 	CRicciFlowVertex::traits = CRicciFlowVertex::traits | TRAIT_UV;
 
@@ -35,6 +38,7 @@ void _tangent_ricci_extremal_length( const char * _input_mesh, const char * _mes
 	mapper._calculate_metric();
 
 	CRFEmbed embed( &mesh );
+	embed.parallel() = _parallel;
 	embed._embed();
 	mesh.write_m( _mesh_with_uv );
 }
@@ -54,10 +58,10 @@ int main( int argc, char * argv[] )
 -------------------------------------------------------------------------------*/
 	
 
-//-tangent_ricci_extremal_length sophie.remesh.m sophie.uv.m
-if( strcmp( argv[1] , "-tangent_ricci_extremal_length") == 0 && argc == 4)
+//-tangent_ricci_extremal_length sophie.remesh.m sophie.uv.m [-parallel]
+if( strcmp( argv[1] , "-tangent_ricci_extremal_length") == 0 && ( argc == 4 || ( argc == 5 && strcmp( argv[4], "-parallel" ) == 0 ) ) )
 {
-	_tangent_ricci_extremal_length( argv[2], argv[3] );
+	_tangent_ricci_extremal_length( argv[2], argv[3], argc == 5 );
 	return 0;
 }
 
@@ -138,7 +138,7 @@ void _slit_map( int argc, char * argv[] )
 
 	std::vector<CSMMesh*> meshes;
 
-	printf("meshes size %d\n", meshes.size() );
+	printf("meshes size %d\n", (int) meshes.size() );
 
 	for( int i = 2; i < argc-3; i ++ )
 	{
@@ -227,3 +227,155 @@ void _fill_puncture( const char * _mesh_with_hole, const char * _filled_mesh )
 	cmesh.write_m( _filled_mesh );
 }
 
+
+
+/*! Tile the universal covering space by the fundamental domain on the Poincare disk, a 1024 x 1024 view of the disk
+ *
+ */
+void _covering_space( const char * _fundamental_domain, int _depth, double _min_pixels, const char * _tiles )
+{
+	CCSMesh mesh;
+	mesh.read_m( _fundamental_domain );
+
+	_read_vertex_father<CCSMesh, CCoveringSpaceVertex, CEdge, CFace, CHalfEdge>( &mesh );
+	_read_vertex_uv<CCSMesh, CCoveringSpaceVertex, CEdge, CFace, CHalfEdge>( &mesh );
+
+	CCoveringSpace cover( & mesh );
+	cover._deck_transformations();
+	int num = cover._tiling( _depth, 512, _min_pixels, _tiles );
+
+	printf("%d deck transformations, %d tiles\n", (int) cover.tiling().generators().size(), num );
+}
+
+
+
+/**********************************************************************************************************************************************
+*
+*	Resampling
+*	
+*
+**********************************************************************************************************************************************/
+
+//vertex color channel of the geometry image
+static void _geometry_image_rgb( CGeometryImageVertex * v, double * value )
+{
+	for( int j = 0; j < 3; j ++ ) value[j] = v->rgb()[j];
+}
+
+/*!	Resample the mesh with uv to a geometry image, positions, normals and vertex colors
+ *
+ */
+int _geometry_image( const char * _uv_mesh, const char * _size, const char * _prefix )
+{
+	char * end = NULL;
+	long size = strtol( _size, &end, 10 );
+	if( end == _size || *end != 0 || size < 2 || size > 65536 )
+	{
+		fprintf( stderr, "Error: the geometry image size should be an integer between 2 and 65536, not %s\n", _size );
+		return 1;
+	}
+
+	CGIMesh mesh;
+	mesh.read_m( _uv_mesh );
+
+	_read_vertex_uv<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+	_read_vertex_normal<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+	_read_vertex_rgb<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+
+	CGeometryImage<CGIMesh, CGeometryImageVertex, CFace> image( &mesh, (int) size );
+	image.add_channel( "rgb", 3, _geometry_image_rgb );
+	image._rasterize();
+
+	if( !image._write_raw( _prefix ) || !image._write_preview( _prefix ) ) return 2;
+	return 0;
+}
+
+/*!	Draw the uv of the mesh edges as PostScript or SVG, the uv is fit to a 600 x 600 page,
+ *	the boundary is drawn on top of the interior edges
+ */
+void _vector_uv( const char * _uv_mesh, const char * _output, int _tiles )
+{
+	CGIMesh mesh;
+	mesh.read_m( _uv_mesh );
+	_read_vertex_uv<CGIMesh, CGeometryImageVertex, CEdge, CFace, CHalfEdge>( &mesh );
+
+	CPoint2 lo( 1e30, 1e30 ), hi( -1e30, -1e30 );
+	for( CGIMesh::MeshVertexIterator viter( &mesh ); !viter.end(); viter ++ )
+	{
+		CPoint2 uv = (*viter)->uv();
+		for( int j = 0; j < 2; j ++ )
+		{
+			lo[j] = ( uv[j] < lo[j] )? uv[j]: lo[j];
+			hi[j] = ( uv[j] > hi[j] )? uv[j]: hi[j];
+		}
+	}
+	double size  = std::max( hi[0] - lo[0], hi[1] - lo[1] );
+	double scale = ( size > 0 )? 580.0 / size: 1.0;
+
+	CVectorWriter writer( 600, 600 );
+	writer.view( scale, scale, 300 - scale * ( lo[0] + hi[0] ) / 2, 300 - scale * ( lo[1] + hi[1] ) / 2 );
+
+	for( int boundary = 0; boundary < 2; boundary ++ )
+	{
+		if( boundary )
+		{
+			writer.color( 1, 0, 0 );
+			writer.line_width( 1.0 );
+		}
+		for( CGIMesh::MeshEdgeIterator eiter( &mesh ); !eiter.end(); eiter ++ )
+		{
+			CEdge * e = *eiter;
+			if( (int) mesh.isBoundary( e ) != boundary ) continue;
+			writer.line( mesh.edgeVertex1( e )->uv(), mesh.edgeVertex2( e )->uv() );
+		}
+	}
+
+	writer._write( _output, CVectorWriter::format( _output ), _tiles );
+	printf("%d edges, %d paths, %d vertices merged, %d sub-pixel primitives culled\n", writer.primitives(), writer.written(), writer.merged(), writer.culled() );
+}
+
+
+
+/**********************************************************************************************************************************************
+*
+*	Quality
+*	
+*
+**********************************************************************************************************************************************/
+
+/*!	Measure the distortion of the uv, report it and optionally color the faces
+ *
+ */
+int _distortion( const char * _uv_mesh, const char * _report, const char * _colored_mesh, const char * _measure )
+{
+	typedef CDistortion<CDMesh, CVertex, CDistortionFace> CDistortionMeasure;
+
+	int measure = -1;
+	if( strcmp( _measure, "mu" ) == 0 )         measure = CDistortionMeasure::MU;
+	if( strcmp( _measure, "dilatation" ) == 0 ) measure = CDistortionMeasure::DILATATION;
+	if( strcmp( _measure, "angle" ) == 0 )      measure = CDistortionMeasure::ANGLE;
+	if( strcmp( _measure, "area" ) == 0 )       measure = CDistortionMeasure::AREA;
+	if( measure < 0 )
+	{
+		fprintf( stderr, "Error: unknown measure %s, it should be mu, dilatation, angle or area\n", _measure );
+		return 1;
+	}
+
+	CDMesh mesh;
+	mesh.read_m( _uv_mesh );
+	_read_vertex_uv<CDMesh, CVertex, CEdge, CDistortionFace, CHalfEdge>( &mesh );
+
+	CDistortionMeasure distortion( &mesh );
+	distortion._measure();
+	if( !distortion._write_report( _report, _uv_mesh ) ) return 1;
+
+	CDistortionHistogram & mu = distortion.histogram( CDistortionMeasure::MU );
+	printf("%d flips, %d degenerate faces, mean |mu| %g, max |mu| %g\n", distortion.flips(), distortion.degenerate(), mu.mean(), ( mu.m_count > 0 )? mu.m_max: 0 );
+
+	if( _colored_mesh == NULL ) return 0;
+
+	distortion._color( measure );
+	_write_face_rgb<CDMesh, CVertex, CEdge, CDistortionFace, CHalfEdge>( &mesh );
+	mesh.write_m( _colored_mesh );
+	return 0;
+}
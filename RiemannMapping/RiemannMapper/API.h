@@ -3,7 +3,7 @@
 /*!
  *	Trait IO 
  */
-#include "parser/traits_io.h"
+#include "Parser/traits_io.h"
 
 /*************************************************************************************************************************
 *
@@ -48,12 +48,26 @@
 #include "Topology/Cohomology/DomainCohomology.h" 
 /*! Puncture a hole in the center of the mesh
  */
-#include "Topology/puncture/puncture.h" //Puncture a hole in the center of the mesh
+#include "Topology/Puncture/Puncture.h" //Puncture a hole in the center of the mesh
+/*! Tile the universal covering space by the fundamental domain
+ */
+#include "Topology/CoveringSpace/CoveringSpace.h" //Tile the universal covering space
 
 /*!	Shortest Path
  */
 #include "Riemannian/ShortestPath/ShortestPath.h" //shortest path
 
+/*!	Geometry Image
+ */
+#include "Resample/GeometryImage/GeometryImageMesh.h"
+#include "Resample/GeometryImage/GeometryImage.h" //resample the uv domain to a geometry image
+#include "ps/VectorWriter.h" //PostScript and SVG output
+
+/*!	Distortion measures
+ */
+#include "Conformal/Distortion/DistortionMesh.h"
+#include "Conformal/Distortion/Distortion.h" //angle and area distortion of a parameterization
+
 
 /************************************************************************************************************************************
 *
@@ -135,6 +149,40 @@ void _puncture( const char * _input_mesh, const char * _mesh_with_hole );
  *
  */
 void _fill_puncture( const char * _mesh_with_hole, const char * _filled_mesh );
+/*! Tile the universal covering space by the fundamental domain on the Poincare disk
+ *
+ */
+void _covering_space( const char * _fundamental_domain, int _depth, double _min_pixels, const char * _tiles );
+
+
+/************************************************************************************************************************************
+*
+*	Resampling
+*
+************************************************************************************************************************************/
+
+/*!	Resample the mesh with uv to a geometry image, positions, normals and vertex colors
+ *	\param _size image size, a decimal integer between 2 and 65536
+ *	\return 0 on success, 1 for an invalid size, 2 if the images could not be written
+ */
+int  _geometry_image( const char * _uv_mesh, const char * _size, const char * _prefix );
+/*!	Draw the uv of the mesh edges as PostScript or SVG, tiles per side for the parallel generation
+ *
+ */
+void _vector_uv( const char * _uv_mesh, const char * _output, int _tiles );
+
+
+/************************************************************************************************************************************
+*
+*	Quality
+*
+************************************************************************************************************************************/
+
+/*!	Measure the angle and area distortion of the uv, write the json report, and the mesh with the faces
+ *	colored by one measure, mu, dilatation, angle or area, if _colored_mesh is not NULL
+ *	\return 0 on success, 1 for an unknown measure or a report that could not be written
+ */
+int  _distortion( const char * _uv_mesh, const char * _report, const char * _colored_mesh, const char * _measure );
 
 
-#endif _API_H_
+#endif //_API_H_
@@ -704,17 +704,25 @@ void help(char * exe )
 	//linear combination of holomorphic 1-forms
 	printf("%s -linear_combination  output_mesh holomorphic_form_1 lambda_1 holomorphic_form_2 lambda_2 ... holomorphic_form_n lambda_n\n", exe );
 	//shortest non-separating loop through the root vertex
-	printf("%s -shortest_loop mesh_file mesh_file root_id loop_file\n");
+	printf("%s -shortest_loop mesh_file mesh_file root_id loop_file\n", exe );
 	//shortest non-separting loop connecting two corresponding boundary vertices
-	printf("%s -essential_loop previous_mesh_file current_mesh_file loop_file\n");
+	printf("%s -essential_loop previous_mesh_file current_mesh_file loop_file\n", exe );
 	//slice the mesh along the loops
-	printf("%s -surgery mesh_file loop_file_0 loop_file_1 ... loop_file_n open_mesh_file\n");
+	printf("%s -surgery mesh_file loop_file_0 loop_file_1 ... loop_file_n open_mesh_file\n", exe );
 	//double covering
-	printf("%s -double_covering mesh_with_boundaries closed_symmetric_mesh\n");
+	printf("%s -double_covering mesh_with_boundaries closed_symmetric_mesh\n", exe );
 	//fill center hole
-	printf("%s -fill_center_hole mesh_with_boundaries_uv mesh_with_center_hole_filled\n");
+	printf("%s -fill_center_hole mesh_with_boundaries_uv mesh_with_center_hole_filled\n", exe );
 	//remove segment
-	printf("%s -remove_segment mesh_with_segment_id segment_id mesh_with_segment_removed\n");
+	printf("%s -remove_segment mesh_with_segment_id segment_id mesh_with_segment_removed\n", exe );
+	//covering space
+	printf("%s -covering_space fundamental_domain_mesh depth min_pixels output_tiles\n", exe );
+	//geometry image
+	printf("%s -geometry_image uv_mesh size output_prefix\n", exe );
+	//vector drawing of the uv
+	printf("%s -vector_uv uv_mesh output.ps|output.svg [tiles]\n", exe );
+	//distortion of the uv
+	printf("%s -distortion uv_mesh report.json [colored_mesh [mu|dilatation|angle|area]]\n", exe );
 };
 
 
@@ -862,6 +870,55 @@ int main( int argc, char * argv[] )
 	return 0;
   }
 
+	/*! Tile the universal covering space by the fundamental domain
+	 *
+	 */
+  if( strcmp( argv[1], "-covering_space" ) == 0 && argc > 5 )
+  {
+	_covering_space( argv[2], atoi( argv[3] ), atof( argv[4] ), argv[5] );
+	return 0;
+  }
+
+/*---------------------------------------------------------------------------------------------------------------------------------------
+
+	Resampling
+
+---------------------------------------------------------------------------------------------------------------------------------------*/
+
+	/*! Resample the uv domain to a geometry image
+	 *
+	 */
+  if( strcmp( argv[1], "-geometry_image" ) == 0 && argc > 4 )
+  {
+	int status = _geometry_image( argv[2], argv[3], argv[4] );
+	if( status == 1 ) help( argv[0] );
+	return status;
+  }
+
+	/*! Draw the uv of the edges as PostScript or SVG
+	 *
+	 */
+  if( strcmp( argv[1], "-vector_uv" ) == 0 && argc > 3 )
+  {
+	_vector_uv( argv[2], argv[3], ( argc > 4 )? atoi( argv[4] ): 1 );
+	return 0;
+  }
+
+
+/*---------------------------------------------------------------------------------------------------------------------------------------
+
+	Quality
+
+---------------------------------------------------------------------------------------------------------------------------------------*/
+
+	/*! Measure the angle and area distortion of the uv, with the faces colored by one measure
+	 *
+	 */
+  if( strcmp( argv[1], "-distortion" ) == 0 && argc > 3 )
+  {
+	return _distortion( argv[2], argv[3], ( argc > 4 )? argv[4]: NULL, ( argc > 5 )? argv[5]: "mu" );
+  }
+
 
 	help( argv[0] );
 	return 0;
@@ -1,13 +1,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#ifndef VIEW_MESH_HEADLESS
+#ifdef VIEW_MESH_USE_VBO
+#define GL_GLEXT_PROTOTYPES
+#endif
 #include<GL/glut.h>
+#endif
 #include "viewer/arcball.h"                           /*  Arc Ball  Interface         */
+#include "viewer/SoftRenderer.h"                      /*  Offscreen rendering         */
+#include "viewer/RenderBuffer.h"                      /*  Retained vertex arrays      */
 #include "Mesh/TriangleSoup.h"
+#include "Geometry/NormalKernel.h"                    /*  Normals and areas           */
 #include "bmp/RgbImage.h"
 
 //compiling command
 //g++ -lGL -lglut -lGLU -IMeshLib view_mesh.C -o view_mesh
+//with -DVIEW_MESH_USE_VBO the corners are kept in a buffer object, which needs OpenGL 1.5
+//without OpenGL, offscreen rendering only
+//g++ -O2 -fopenmp -DVIEW_MESH_HEADLESS -DRGBIMAGE_DONT_USE_OPENGL -IMeshLib/core view_mesh.cpp MeshLib/core/bmp/RgbImage.cpp -o view_mesh
 
 using namespace MeshLib::TriangleSoup;
 
@@ -37,9 +48,75 @@ int geometryFlag = 0;
 /* texture flag */
 int textureFlag =  2; 
 /* texture id and image */
+#ifndef VIEW_MESH_HEADLESS
 GLuint texName;
+#endif
 RgbImage image;
 
+/* corners of the current mesh, drawn by draw_mesh and draw_object */
+MeshLib::CRenderBuffer buffer;
+
+
+/*! attributes of the j-th corner of face pF, as drawn by draw_mesh and by the offscreen renderer */
+void mesh_corner( CFace * pF, int j, MeshLib::CRenderCorner & c )
+{
+	CVertex * pV = pF->m_v[j];
+
+	c.m_normal = ( shadeFlag == 1 )? pV->m_normal: pF->m_normal;
+
+	if( mesh.m_has_uv )
+		c.m_uv = pV->m_uv;
+
+	MeshLib::CPoint skin_rgb( 235/255.0,180/255.0,173/255.0);
+	c.m_rgb = ( mesh.m_has_rgb )? pV->m_rgb: skin_rgb;
+
+	if( geometryFlag && mesh.m_has_uv )
+		c.m_point = MeshLib::CPoint( pV->m_uv[0], pV->m_uv[1], 0 );
+	else
+		c.m_point = pV->m_point;
+}
+
+/*! attributes of the j-th corner of face pF, as drawn by draw_object and by the offscreen renderer */
+void object_corner( CObjFace & pF, int j, MeshLib::CRenderCorner & c )
+{
+	CObjVertex & pV = pF.m_v[j];
+
+	c.m_normal = ( shadeFlag == 1 )? object.normals()[ pV.m_inl ]: pF.m_normal;
+
+	if( object.m_has_uv )
+		c.m_uv = object.uvs()[pV.m_iuv];
+
+	c.m_rgb = MeshLib::CPoint( 235/255.0,180/255.0,173/255.0);
+
+	if( geometryFlag && object.m_has_uv )
+		c.m_point = MeshLib::CPoint( c.m_uv[0], c.m_uv[1], 0 );
+	else
+		c.m_point = object.points()[pV.m_ipt];
+}
+
+/*! pack the corners of the current mesh, after loading and whenever the shading or the geometry flag changes */
+void pack_buffer()
+{
+	int n = (int)( ( current_mesh_type == OBJ )? object.faces().size(): mesh.faces().size() );
+	buffer.resize( 3 * n );
+
+#pragma omp parallel for
+	for( int i = 0; i < n; i ++ )
+	{
+		MeshLib::CRenderCorner c;
+		for( int j = 0; j < 3; j ++ )
+		{
+			if( current_mesh_type == OBJ )
+				object_corner( object.faces()[i], j, c );
+			else
+				mesh_corner( mesh.faces()[i], j, c );
+			buffer.set( 3 * i + j, c );
+		}
+	}
+}
+
+#ifndef VIEW_MESH_HEADLESS
+
 
 /*! setup the object, transform from the world to the object coordinate system */
 void setupObject(void)
@@ -63,63 +140,78 @@ void setupLight()
 {
 	//MeshLib::CPoint position(0,0,-1);
 	MeshLib::CPoint position(0,0,1);
-	GLfloat lightOnePosition[4]={position[0], position[1], position[2], 0};
+	GLfloat lightOnePosition[4]={(GLfloat) position[0], (GLfloat) position[1], (GLfloat) position[2], 0};
 	glLightfv(GL_LIGHT1, GL_POSITION, lightOnePosition);
 	MeshLib::CPoint position2(0,0,-1);
-	GLfloat lightTwoPosition[4]={position2[0], position2[1], position2[2], 0};
+	GLfloat lightTwoPosition[4]={(GLfloat) position2[0], (GLfloat) position2[1], (GLfloat) position2[2], 0};
 	glLightfv(GL_LIGHT2, GL_POSITION, lightTwoPosition);
 }
 
-/*! draw mesh */
-void draw_mesh()
+/*! pointer to the attribute of the first corner, an offset into the buffer object with VIEW_MESH_USE_VBO */
+const GLvoid * buffer_pointer( int attribute )
 {
-	  glBindTexture(GL_TEXTURE_2D, texName);
+#ifdef VIEW_MESH_USE_VBO
+	return (const GLvoid *)( attribute * sizeof(float) );
+#else
+	return buffer.data( attribute );
+#endif
+}
 
-	//glColor3f( 1.0, 1.0, 1.0 );
-	//glDisable( GL_LIGHTING );
-	for( size_t i = 0; i < mesh.faces().size(); i ++ )
-	{
-		CFace * pF = mesh.faces()[i];
-  		glBegin(GL_TRIANGLES);
-		if( shadeFlag == 0 )
-		{
-			glNormal3f( pF->m_normal[0], pF->m_normal[1], pF->m_normal[2] );
-			//glNormal3f( -pF->m_normal[0], -pF->m_normal[1], -pF->m_normal[2] );
-			//std::cout << pF->m_normal[0] << " " << pF->m_normal[1] << " " << pF->m_normal[2] << std::endl;
-		}
-		for( int j = 0; j < 3; j ++ )
-		{
-			CVertex * pV = pF->m_v[j];
-			if( shadeFlag == 1 )
-				glNormal3f( pV->m_normal[0], pV->m_normal[1], pV->m_normal[2] );
+/*! draw the packed corners, uploading the changed ones first */
+void draw_buffer( bool has_uv )
+{
+#ifdef VIEW_MESH_USE_VBO
+	static GLuint vbo = 0;
+	static int    size = 0;
 
-	
-			if( mesh.m_has_uv )
-			{
-				MeshLib::CPoint2 uv = pV->m_uv;
-				glTexCoord2d( uv[0], uv[1] );
-			}
+	if( !vbo ) glGenBuffers( 1, &vbo );
+	glBindBuffer( GL_ARRAY_BUFFER, vbo );
+	if( size != buffer.corners() )
+	{
+		size = buffer.corners();
+		glBufferData( GL_ARRAY_BUFFER, size * buffer.stride(), buffer.data(), GL_DYNAMIC_DRAW );
+	}
+	else
+	{
+		std::vector< std::pair<int,int> > & ranges = buffer.ranges();
+		for( size_t i = 0; i < ranges.size(); i ++ )
+			glBufferSubData( GL_ARRAY_BUFFER, ranges[i].first * buffer.stride(), ranges[i].second * buffer.stride(),
+				buffer.data() + ranges[i].first * MeshLib::CRenderBuffer::STRIDE );
+	}
+#endif
+	buffer.clean();
+
+	glEnableClientState( GL_VERTEX_ARRAY );
+	glEnableClientState( GL_NORMAL_ARRAY );
+	glEnableClientState( GL_COLOR_ARRAY );
+	glVertexPointer( 3, GL_FLOAT, buffer.stride(), buffer_pointer( MeshLib::CRenderBuffer::POINT ) );
+	glNormalPointer( GL_FLOAT, buffer.stride(), buffer_pointer( MeshLib::CRenderBuffer::NORMAL ) );
+	glColorPointer( 3, GL_FLOAT, buffer.stride(), buffer_pointer( MeshLib::CRenderBuffer::RGB ) );
+	if( has_uv )
+	{
+		glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+		glTexCoordPointer( 2, GL_FLOAT, buffer.stride(), buffer_pointer( MeshLib::CRenderBuffer::UV ) );
+	}
 
-			MeshLib::CPoint skin_rgb( 235/255.0,180/255.0,173/255.0);
+	glDrawArrays( GL_TRIANGLES, 0, buffer.corners() );
 
-			if( mesh.m_has_rgb )
-				glColor3f( pV->m_rgb[0], pV->m_rgb[1], pV->m_rgb[2] );
-			else
-				//glColor3f( 1,1,1 );
-				glColor3f( skin_rgb[0], skin_rgb[1],skin_rgb[2] );
+	glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+	glDisableClientState( GL_COLOR_ARRAY );
+	glDisableClientState( GL_NORMAL_ARRAY );
+	glDisableClientState( GL_VERTEX_ARRAY );
+#ifdef VIEW_MESH_USE_VBO
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+#endif
+}
 
-			if( geometryFlag && mesh.m_has_uv )
-			{
-				glVertex3d( pV->m_uv[0], pV->m_uv[1] , 0);
-			}
-			else
-			{
-				glVertex3d( pV->m_point[0], pV->m_point[1], pV->m_point[2] );
-			}
-		}
-		glEnd();
-	}
+/*! draw mesh */
+void draw_mesh()
+{
+	  glBindTexture(GL_TEXTURE_2D, texName);
 
+	//glColor3f( 1.0, 1.0, 1.0 );
+	//glDisable( GL_LIGHTING );
+	draw_buffer( mesh.m_has_uv );
 }
 
 
@@ -129,46 +221,7 @@ void draw_object()
 {
 	  glBindTexture(GL_TEXTURE_2D, texName);
 
-	for( size_t i = 0; i < object.faces().size(); i ++ )
-	{
-		CObjFace & pF = object.faces()[i];
-  		glBegin(GL_TRIANGLES);
-		if( shadeFlag == 0 )
-		{
-			glNormal3f( pF.m_normal[0], pF.m_normal[1], pF.m_normal[2] );
-		}
-		for( int j = 0; j < 3; j ++ )
-		{
-			CObjVertex & pV = pF.m_v[j];
-			if( shadeFlag == 1 )
-			{
-				MeshLib::CPoint n = object.normals()[ pV.m_inl ];
-				glNormal3f( n[0], n[1], n[2] );
-			}
-	
-			if( object.m_has_uv )
-			{
-				MeshLib::CPoint2 uv = object.uvs()[pV.m_iuv];
-				glTexCoord2d( uv[0], uv[1] );
-			}
-
-			MeshLib::CPoint skin_rgb( 235/255.0,180/255.0,173/255.0);
-			glColor3f( skin_rgb[0], skin_rgb[1],skin_rgb[2] );
-
-			if( geometryFlag && object.m_has_uv )
-			{
-				MeshLib::CPoint2 uv = object.uvs()[pV.m_iuv];
-				glVertex3d( uv[0], uv[1] , 0);
-			}
-			else
-			{
-				MeshLib::CPoint p = object.points()[pV.m_ipt];
-				glVertex3d( p[0], p[1], p[2] );
-			}
-		}
-		glEnd();
-	}
-
+	draw_buffer( object.m_has_uv );
 }
 
 
@@ -250,11 +303,13 @@ void keyBoard(unsigned char key, int x, int y)
 		//Flat Shading
 		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 		shadeFlag = 0;
+		pack_buffer();
 		break;
 	case 's':
     		//Smooth Shading
 		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 		shadeFlag = 1;
+		pack_buffer();
 		break;
 	case 'w':
 	  	//Wireframe mode
@@ -281,6 +336,7 @@ void keyBoard(unsigned char key, int x, int y)
 
   case 'g':
 	  geometryFlag = (geometryFlag + 1)%2;
+	  pack_buffer();
 	  break;
 
   case 'r':
@@ -397,177 +453,215 @@ void mouseMove(int x, int y)
   }
 
 }
+#endif
 
 
-void normalize( CTriangleMesh & mesh )
+/*! center and scale the points into the cube [-1,1]^3, by one reduction pass and one scaling pass */
+void normalize( std::vector<MeshLib::CPoint*> & points )
 {
-	MeshLib::CPoint center(0,0,0);
-	for( size_t i = 0; i < mesh.vertices().size(); i ++ )
-	{
-		CVertex * pV = mesh.vertices()[i];
-		center += pV->m_point;
-	}
-	center /= (double)(mesh.vertices().size());
+	int n = (int) points.size();
+	if( n == 0 ) return;
+
+	//partial sums and bounds over fixed blocks, combined in block order, so the result does not depend on the threads
+	const int block = 4096;
+	int nb = ( n + block - 1 ) / block;
+	std::vector<double> part( 9 * nb );
 
-	for( size_t i = 0; i < mesh.vertices().size(); i ++ )
+#pragma omp parallel for
+	for( int b = 0; b < nb; b ++ )
 	{
-		CVertex * pV = mesh.vertices()[i];
-		pV->m_point -= center;
+		double * s = &part[9*b], * l = s + 3, * h = s + 6;
+		for( int j = 0; j < 3; j ++ ) { s[j] = 0; l[j] = HUGE_VAL; h[j] = -HUGE_VAL; }
+		int end = ( b + 1 ) * block < n? ( b + 1 ) * block: n;
+		for( int i = b * block; i < end; i ++ )
+		{
+			MeshLib::CPoint & p = *points[i];
+			for( int j = 0; j < 3; j ++ )
+			{
+				s[j] += p[j];
+				l[j] = ( l[j] < p[j] )? l[j]: p[j];
+				h[j] = ( h[j] > p[j] )? h[j]: p[j];
+			}
+		}
 	}
 
-	double len = -1;
-	for( size_t i = 0; i < mesh.vertices().size(); i ++ )
-	{
-		CVertex * pV = mesh.vertices()[i];
+	double sum[3] = { 0, 0, 0 };
+	double lo[3]  = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+	double hi[3]  = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL };
+	for( int b = 0; b < nb; b ++ )
 		for( int j = 0; j < 3; j ++ )
 		{
-			len = (len > fabs(pV->m_point[j]))? len: fabs(pV->m_point[j]);
+			sum[j] += part[9*b+j];
+			lo[j] = ( lo[j] < part[9*b+3+j] )? lo[j]: part[9*b+3+j];
+			hi[j] = ( hi[j] > part[9*b+6+j] )? hi[j]: part[9*b+6+j];
 		}
-	}
 
-	for( size_t i = 0; i < mesh.vertices().size(); i ++ )
+	//the largest |p[j] - center[j]| is at one end of the bounding box
+	MeshLib::CPoint center( sum[0] / n, sum[1] / n, sum[2] / n );
+	double len = 0;
+	for( int j = 0; j < 3; j ++ )
 	{
-		CVertex * pV = mesh.vertices()[i];
-		pV->m_point /= len;
+		len = ( len > hi[j] - center[j] )? len: hi[j] - center[j];
+		len = ( len > center[j] - lo[j] )? len: center[j] - lo[j];
 	}
+	if( len <= 0 ) len = 1;
 
+#pragma omp parallel for
+	for( int i = 0; i < n; i ++ )
+	{
+		*points[i] = ( *points[i] - center ) / len;
+	}
 }
 
-
+void normalize( CTriangleMesh & mesh )
+{
+	std::vector<MeshLib::CPoint*> points( mesh.vertices().size() );
+	for( size_t i = 0; i < points.size(); i ++ ) points[i] = &mesh.vertices()[i]->m_point;
+	normalize( points );
+}
 
 void normalize( CObject & object )
 {
-	MeshLib::CPoint center(0,0,0);
-	for( size_t i = 0; i < object.points().size(); i ++ )
-	{
-		center += object.points()[i];
-	}
-	center /= (double)(object.points().size());
-
-	for( size_t i = 0; i < object.points().size(); i ++ )
-	{
-		object.points()[i] -= center;
-	}
-
-	double len = -1;
-
-	for( size_t i = 0; i < object.points().size(); i ++ )
-	{
-		MeshLib::CPoint p = object.points()[i];
-		for( int j = 0; j < 3; j ++ )
-		{
-			len = (len > p[j])? len: fabs(p[j]);
-		}
-	}
-
-	for( size_t i = 0; i < object.points().size(); i ++ )
-	{
-		object.points()[i] /= len;
-	}
-
+	std::vector<MeshLib::CPoint*> points( object.points().size() );
+	for( size_t i = 0; i < points.size(); i ++ ) points[i] = &object.points()[i];
+	normalize( points );
 }
 
 
+/*! face normals and areas, area weighted vertex normals and barycentric vertex areas by the shared kernel;
+ *  the normals read from the file are kept
+ */
 void compute_normal( CTriangleMesh & mesh )
 {
-	for( size_t i = 0; i < mesh.faces().size(); i ++ )
-	{
-		CFace * pF = mesh.faces()[i];
-		MeshLib::CPoint p[3];
+	int nv = (int) mesh.vertices().size();
+	int nf = (int) mesh.faces().size();
+
+	MeshLib::CNormalKernel kernel;
+	kernel.resize( nv, nf );
+	int * fv = kernel.corners();
+
+#pragma omp parallel for
+	for( int i = 0; i < nv; i ++ )
+		kernel.set_point( i, mesh.vertices()[i]->m_point );
+#pragma omp parallel for
+	for( int i = 0; i < nf; i ++ )
 		for( int j = 0; j < 3; j ++ )
-		{
-			p[j] = pF->m_v[j]->m_point;
-		}
-		MeshLib::CPoint nor = (p[1]-p[0])^(p[2]-p[0]);
-		pF->m_area = nor.norm();
+			fv[3*i+j] = mesh.index( mesh.faces()[i]->m_v[j] );
 
-		nor /= nor.norm();
-		pF->m_normal = nor;
-	}
+	kernel._topology();
+	kernel._compute( MeshLib::CNormalKernel::BARYCENTRIC );
 
-	for( size_t i = 0; i < mesh.faces().size(); i ++ )
+#pragma omp parallel for
+	for( int i = 0; i < nf; i ++ )
 	{
 		CFace * pF = mesh.faces()[i];
-		MeshLib::CPoint p[3];
-		for( int j = 0; j < 3; j ++ )
-		{
-			p[j] = pF->m_v[j]->m_point;
-		}
-		MeshLib::CPoint nor = (p[1]-p[0])^(p[2]-p[0]);
-		nor /= nor.norm();
-		pF->m_normal = nor;
-
-		for( int j = 0; j < 3; j ++ )
-		{
-			pF->m_v[j]->m_normal += pF->m_normal * pF->m_area;
-		}
-	}
-
-	for( size_t i = 0; i < mesh.vertices().size(); i ++ )
-	{
-		CVertex * pV = mesh.vertices()[i];
-		pV->m_normal /= pV->m_normal.norm();
+		pF->m_normal = kernel.face_normal( i );
+		pF->m_area   = kernel.face_area( i );
 	}
-
-    for( size_t i = 0; i < mesh.vertices().size(); i ++ )
+#pragma omp parallel for
+	for( int i = 0; i < nv; i ++ )
 	{
 		CVertex * pV = mesh.vertices()[i];
-		pV->m_area = 0;
-	}
-
-    //compute the vertex area
-	for( size_t i = 0; i < mesh.faces().size(); i ++ )
-	{
-		CFace * pF = mesh.faces()[i];
-		for( int j = 0; j < 3; j ++ )
-		{
-			pF->m_v[j]->m_area += pF->m_area/3.0;
-		}
+		if( !mesh.m_has_normal ) pV->m_normal = kernel.vertex_normal( i );
+		pV->m_area = kernel.vertex_area( i );
 	}
 }
 
 
+/*! face normals and areas; without normals in the file, the vertex normals are computed
+ *  and the corners use the normals of their points
+ */
 void compute_normal( CObject & object )
 {
-	for( size_t i = 0; i < object.faces().size(); i ++ )
-	{
-		CObjFace * pF = & object.faces()[i];
-
-		MeshLib::CPoint p[3];
+	int nv = (int) object.points().size();
+	int nf = (int) object.faces().size();
+
+	MeshLib::CNormalKernel kernel;
+	kernel.resize( nv, nf );
+	int * fv = kernel.corners();
+
+#pragma omp parallel for
+	for( int i = 0; i < nv; i ++ )
+		kernel.set_point( i, object.points()[i] );
+#pragma omp parallel for
+	for( int i = 0; i < nf; i ++ )
 		for( int j = 0; j < 3; j ++ )
-		{
-			p[j] = object.points()[pF->m_v[j].m_ipt];
-		}
+			fv[3*i+j] = object.faces()[i].m_v[j].m_ipt;
 
-		MeshLib::CPoint nor = (p[1]-p[0])^(p[2]-p[0]);
-		pF->m_area = nor.norm();
+	kernel._topology();
+	kernel._compute( MeshLib::CNormalKernel::BARYCENTRIC );
 
-		nor /= nor.norm();
-		pF->m_normal = nor;
+#pragma omp parallel for
+	for( int i = 0; i < nf; i ++ )
+	{
+		CObjFace & pF = object.faces()[i];
+		pF.m_normal = kernel.face_normal( i );
+		pF.m_area   = kernel.face_area( i );
 	}
 
 	if( object.m_has_normal ) return;
 
-	object.normals().resize( object.points().size() );
+	object.normals().resize( nv );
+#pragma omp parallel for
+	for( int i = 0; i < nv; i ++ )
+		object.normals()[i] = kernel.vertex_normal( i );
+#pragma omp parallel for
+	for( int i = 0; i < nf; i ++ )
+		for( int j = 0; j < 3; j ++ )
+			object.faces()[i].m_v[j].m_inl = object.faces()[i].m_v[j].m_ipt;
+}
 
-	for( size_t i = 0; i < object.faces().size(); i ++ )
+/*! render the current view to a bmp file without OpenGL, with the same eye, light, shading,
+ *  texture and geometry flags as display
+ */
+bool render_offscreen( const char * output, int width, int height )
+{
+	MeshLib::CSoftRenderer renderer( width, height );
+	renderer.perspective( 40.0, (double) width / height, 1.0, 100.0 );
+
+	/* eye at z = +5, then the object transformation */
+	double rot[16];
+	ObjRot.convert( rot );
+	rot[12] = ObjTrans[0];
+	rot[13] = ObjTrans[1];
+	rot[14] = ObjTrans[2] - 5.0;
+	renderer.modelview( rot );
+
+	/* lights and material of setupGLstate and setupLight */
+	renderer.ambient() = 0.1;
+	renderer.light( MeshLib::CPoint(0,0,1) );
+	renderer.light( MeshLib::CPoint(0,0,-1) );
+	renderer.texture( &image, textureFlag );
+
+	MeshLib::CRenderCorner c[3];
+	switch( current_mesh_type )
 	{
-		CObjFace * pF = &object.faces()[i];
-
-		for( int j = 0; j < 3; j ++ )
+	case OBJ:
+		for( size_t i = 0; i < object.faces().size(); i ++ )
 		{
-			pF->m_v[j].m_inl = pF->m_v[j].m_ipt;
-			object.normals()[pF->m_v[j].m_inl] += pF->m_normal * pF->m_area;
+			for( int j = 0; j < 3; j ++ ) object_corner( object.faces()[i], j, c[j] );
+			renderer.triangle( c[0], c[1], c[2] );
 		}
+		break;
+	case M:
+		for( size_t i = 0; i < mesh.faces().size(); i ++ )
+		{
+			for( int j = 0; j < 3; j ++ ) mesh_corner( mesh.faces()[i], j, c[j] );
+			renderer.triangle( c[0], c[1], c[2] );
+		}
+		break;
 	}
 
-	for( size_t i = 0; i < object.normals().size(); i ++ )
+	renderer._render();
+	if( !renderer.write( output ) )
 	{
-		object.normals()[i] /= object.normals()[i].norm();
+		fprintf( stderr, "Error in writing %s\n", output );
+		return false;
 	}
-
+	return true;
 }
 
+#ifndef VIEW_MESH_HEADLESS
 /*! initialize bitmap image texture */
 
 void initialize_bmp_texture()
@@ -598,12 +692,44 @@ void initialize_bmp_texture()
 		  glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
     glEnable(GL_TEXTURE_2D);
 }
+#endif
+
+
+/*! command line of the viewer */
+void usage( const char * exe )
+{
+	printf("Usage:\n");
+	printf("%s mesh [texture.bmp] [-o output.bmp] [-size width height] [-smooth] [-uv] [-texture 0|1|2] [-rotate w x y z]\n", exe );
+}
 
+/*! image size argument, an integer between 1 and 65536 */
+bool parse_size( const char * arg, int & size )
+{
+	char * end = NULL;
+	long value = strtol( arg, &end, 10 );
+	if( end == arg || *end != 0 || value < 1 || value > 65536 )
+	{
+		fprintf( stderr, "Error: the image size should be an integer between 1 and 65536, not %s\n", arg );
+		return false;
+	}
+	size = (int) value;
+	return true;
+}
 
 /*! main function for viewer
+*
+*   view_mesh mesh [texture.bmp] [-o output.bmp] [-size width height] [-smooth] [-uv] [-texture 0|1|2] [-rotate w x y z]
+*
+*   with -o the view is rendered offscreen to output.bmp, without opening a window
 */
 int main( int argc, char * argv[] )
 {
+	if( argc < 2 )
+	{
+		usage( argv[0] );
+		return 1;
+	}
+
 	std::string name( argv[1] );
 
 	unsigned pos = name.find_last_of(".");
@@ -611,7 +737,7 @@ int main( int argc, char * argv[] )
 
 	if( type == "obj" )
 	{
-		object.read( argv[1] );
+		if( !object.read( argv[1] ) ) return 1;
 		normalize( object );
 		compute_normal( object );
 		current_mesh_type = OBJ;
@@ -619,7 +745,7 @@ int main( int argc, char * argv[] )
 	}
 	else if( type == "m" )
 	{
-		mesh.read_m( argv[1] );
+		if( !mesh.read_m( argv[1] ) ) return 1;
 		normalize( mesh );
 		compute_normal( mesh );
 		current_mesh_type = M;
@@ -627,11 +753,51 @@ int main( int argc, char * argv[] )
 
 	textureFlag = 0; 
 
-	if( argc > 2 )
+	const char * texture = NULL;
+	const char * output  = NULL;
+	int width = 600, height = 600;
+	int mode  = -1;
+
+	for( int i = 2; i < argc; i ++ )
 	{
-		image.LoadBmpFile( argv[2] );
+		if( strcmp( argv[i], "-o" ) == 0 && i + 1 < argc )            output = argv[++i];
+		else if( strcmp( argv[i], "-size" ) == 0 && i + 2 < argc )
+		{
+			if( !parse_size( argv[++i], width ) || !parse_size( argv[++i], height ) )
+			{
+				usage( argv[0] );
+				return 1;
+			}
+		}
+		else if( strcmp( argv[i], "-smooth" ) == 0 )                  shadeFlag = 1;
+		else if( strcmp( argv[i], "-uv" ) == 0 )                      geometryFlag = 1;
+		else if( strcmp( argv[i], "-texture" ) == 0 && i + 1 < argc ) mode = atoi( argv[++i] );
+		else if( strcmp( argv[i], "-rotate" ) == 0 && i + 4 < argc )
+		{
+			double q[4];
+			for( int j = 0; j < 4; j ++ ) q[j] = atof( argv[++i] );
+			ObjRot = MeshLib::CQrot( q[0], q[1], q[2], q[3] );
+		}
+		else if( argv[i][0] != '-' && texture == NULL )               texture = argv[i];
 	}
 
+	if( texture != NULL )
+	{
+		image.LoadBmpFile( texture );
+	}
+
+	if( output != NULL )
+	{
+		textureFlag = ( mode >= 0 )? mode: ( ( texture != NULL )? 2: 0 );
+		return render_offscreen( output, width, height )? 0: 1;
+	}
+
+#ifdef VIEW_MESH_HEADLESS
+	printf("built without OpenGL, use -o output.bmp\n");
+	return 1;
+#else
+	pack_buffer();
+
 	/* glut stuff */
 	glutInit(&argc, argv);                /* Initialize GLUT */
 	glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE | GLUT_DEPTH );
@@ -646,14 +812,15 @@ int main( int argc, char * argv[] )
 	glutKeyboardFunc(keyBoard);
 	setupGLstate();
 
-	if( argc > 2 )
+	if( texture != NULL )
 	{
+		textureFlag = ( mode >= 0 )? mode: 2; 
 		initialize_bmp_texture();
-		textureFlag = 2; 
 	}
 	glutMainLoop();                       /* Start GLUT event-processing loop */
 
 	return 0;
+#endif
 }
 
 
@@ -0,0 +1,94 @@
+#
+#	Times every tool on the sample meshes, run by the bench target
+#
+#	cmake -DHARMONIC_MAPPER=.. -DRICCI_FLOW=.. -DRIEMANN_MAPPER=.. -DSIMPLE_VIEWER=.. -DDATA=.. -DWORK=.. -P bench.cmake
+#
+#	each step runs in WORK/<case>, its output goes to <step>.log, and a table of the wall times is printed
+#	and written to WORK/bench.txt
+#
+cmake_minimum_required(VERSION 3.23)
+
+foreach(_var HARMONIC_MAPPER RICCI_FLOW RIEMANN_MAPPER SIMPLE_VIEWER DATA WORK)
+	if(NOT DEFINED ${_var})
+		message(FATAL_ERROR "bench.cmake: ${_var} is not set")
+	endif()
+endforeach()
+
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+
+set(_table "")
+set(_failed 0)
+set(_total 0)
+
+#	now in microseconds
+function(_now _out)
+	string(TIMESTAMP _t "%s%f" UTC)
+	set(${_out} ${_t} PARENT_SCOPE)
+endfunction()
+
+#	_step( case step command args... ), the time is appended to the table
+macro(_step _case _name)
+	file(MAKE_DIRECTORY ${WORK}/${_case})
+	_now(_t0)
+	execute_process(COMMAND ${ARGN}
+		WORKING_DIRECTORY ${WORK}/${_case}
+		OUTPUT_FILE ${WORK}/${_case}/${_name}.log
+		ERROR_FILE ${WORK}/${_case}/${_name}.log
+		RESULT_VARIABLE _rc)
+	_now(_t1)
+	math(EXPR _dt "(${_t1} - ${_t0}) / 1000")
+	math(EXPR _total "${_total} + ${_dt}")
+	set(_status "ok")
+	if(NOT _rc EQUAL 0)
+		set(_status "failed (${_rc})")
+		math(EXPR _failed "${_failed} + 1")
+	endif()
+	string(LENGTH "${_case}/${_name}" _len)
+	math(EXPR _pad "40 - ${_len}")
+	if(_pad LESS 1)
+		set(_pad 1)
+	endif()
+	string(REPEAT " " ${_pad} _sp)
+	set(_line "${_case}/${_name}${_sp}${_dt} ms  ${_status}")
+	message(STATUS "${_line}")
+	string(APPEND _table "${_line}\n")
+endmacro()
+
+#	Harmonic map of the topological disks
+_step(harmonic sophie_disk ${HARMONIC_MAPPER} -harmonic_map ${DATA}/Disk/sophie/sophie.open.m sophie_disk.uv.m)
+_step(harmonic sophie_quad ${HARMONIC_MAPPER} -harmonic_map ${DATA}/Quad/sophie/sophie.m sophie_quad.uv.m)
+_step(harmonic alex_quad ${HARMONIC_MAPPER} -harmonic_map ${DATA}/Quad/Alex/Alex.m alex_quad.uv.m)
+_step(harmonic sophie_remesh ${HARMONIC_MAPPER} -harmonic_map ${DATA}/Remesh/Sophie/Sophie.m sophie_remesh.uv.m)
+
+#	Ricci flow extremal length of the quadrilaterals
+_step(ricci sophie_quad ${RICCI_FLOW} -tangent_ricci_extremal_length ${DATA}/Quad/sophie/sophie.m sophie_quad.uv.m)
+_step(ricci alex_quad ${RICCI_FLOW} -tangent_ricci_extremal_length ${DATA}/Quad/Alex/Alex.m alex_quad.uv.m)
+
+#	Riemann mapping of the disk, step by step as in Disk/sophie
+file(COPY ${DATA}/Disk/sophie/sophie.m DESTINATION ${WORK}/riemann)
+_step(riemann puncture ${RIEMANN_MAPPER} -puncture sophie.m sophie.m)
+_step(riemann cut ${RIEMANN_MAPPER} -cut sophie.m sophie)
+_step(riemann slice ${RIEMANN_MAPPER} -slice sophie_0.cut.m sophie.open.m)
+_step(riemann exact_form ${RIEMANN_MAPPER} -exact_form sophie.m sophie)
+_step(riemann holomorphic_form ${RIEMANN_MAPPER} -holomorphic_form sophie_0.du.m)
+_step(riemann integration ${RIEMANN_MAPPER} -integration holomorphic_form_0.m sophie.open.m sophie.uv.m)
+_step(riemann polar_map ${RIEMANN_MAPPER} -polar_map sophie.m sophie.uv.m sophie.circ_uv.m)
+_step(riemann fill_hole ${RIEMANN_MAPPER} -fill_hole sophie.circ_uv.m sophie.final_uv.m)
+
+#	Resampling and quality of the reference uv
+_step(riemann distortion ${RIEMANN_MAPPER} -distortion ${DATA}/Disk/sophie/sophie.final_uv.m distortion.json)
+_step(riemann geometry_image ${RIEMANN_MAPPER} -geometry_image ${DATA}/Disk/sophie/sophie.final_uv.m 256 sophie_gi)
+_step(riemann vector_uv ${RIEMANN_MAPPER} -vector_uv ${DATA}/Disk/sophie/sophie.final_uv.m sophie_uv.svg)
+
+#	Offscreen rendering
+_step(viewer sophie ${SIMPLE_VIEWER} ${DATA}/Disk/sophie/sophie.m -o sophie.bmp -size 800 800 -smooth)
+_step(viewer sophie_uv ${SIMPLE_VIEWER} ${DATA}/Disk/sophie/sophie.final_uv.m -o sophie_uv.bmp -size 800 800 -uv)
+
+string(APPEND _table "total                                   ${_total} ms\n")
+file(WRITE ${WORK}/bench.txt "${_table}")
+message(STATUS "total ${_total} ms, the logs are in ${WORK}")
+
+if(_failed GREATER 0)
+	message(FATAL_ERROR "${_failed} step(s) failed")
+endif()
@@ -1,6 +1,6 @@
 #ifndef __FUNCS_H
 #define __FUNCS_H
-/*ar rvf libmesh.a edge.o face.o edgelist.o facelist.o halfedge.o loop.o solid.o vertex.o vertexlist.o
+/*ar rvf libmesh.a edge.o face.o edgelist.o facelist.o halfedge.o loop.o solid.o vertex.o vertexlist.o predicates.o meshbuffer.o normal.o coords3.o matrix4.o quat.o arcball.o
 ranlib libmesh.a
 */
 
@@ -58,6 +58,7 @@ int FaceOrientation( Face * , double, double, double  );
 int FaceOrientation2( Face * , double, double, double, double  );
 void FacePrint( Face * );
 void FaceNormal( Face * );
+double TriangleNormal( double *, double *, double *, double * );
 
 void LoopConstruct( Face **, Vertex *, Vertex *,Vertex *);
 void LoopDestruct( Loop ** );
@@ -76,9 +77,13 @@ void  FaceListOutput( Face * );
 
 void SolidConstruct( Solid ** , char * );
 void SolidCenter( Solid * s );
+void SolidScale( Solid * , double );
+struct matrix4;
+void SolidTransform( Solid * , struct matrix4 * );
 void SolidDestruct( Solid ** );
 int  SolidConvexity( Solid * s );
 void SolidConstructNoff( Solid **  , char *);
+void SolidNormal( Solid * );
 
 
 int  ListInsertNode( Node **, void *, int );
@@ -99,4 +104,13 @@ void  heapDownheap(void *);
 void  heapCheck();
 int   heapEmpty(); 
 double  Volumed( Face * f, double x, double y, double z );
+double  Orient3d( double *a, double *b, double *c, double *d );
+
+void  MeshBufferConstruct( MeshBuffer **, Solid *, float, float, float );
+void  MeshBufferDestruct( MeshBuffer ** );
+void  MeshBufferDirtyFace( MeshBuffer *, Face * );
+void  MeshBufferDirtyEdge( MeshBuffer *, Edge * );
+void  MeshBufferDirtyVertex( MeshBuffer *, Vertex * );
+void  MeshBufferHighlight( MeshBuffer *, Edge * );
+int   MeshBufferFlush( MeshBuffer * );
 #endif
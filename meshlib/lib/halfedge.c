@@ -499,8 +499,6 @@ int   HalfEdgeMergable( HalfEdge * halfedge){
   Vertex   * vhead;
   Vertex   * vert ;
   
-  Face     * hf, *tf;
-  int        l;
 
   HalfEdge * heade, *he;
   Edge     * edge;
@@ -98,24 +98,6 @@ int affine_matrix4_inverse (matrix4 * in, matrix4 * out)
 }
 
 
-/*------------------------------------------------------------------------*/
-void Test( GLdouble * obj, GLdouble * inv )
-{  
-  GLdouble Mat[16];
-  int i,j;
-  
-  glPushMatrix();
-  glLoadIdentity();
-  glMultMatrixd( (GLdouble *) obj );
-  glMultMatrixd( (GLdouble *) inv );
-  glGetDoublev(GL_MODELVIEW_MATRIX, (GLdouble *)Mat);
-  for( i = 0; i < 4; i ++ ){
-    for( j = 0; j < 4; j ++ ) fprintf(stderr,"%f  ", *(Mat+i*4+j));
-    fprintf(stderr,"\n");
-  }
-  fprintf(stderr,"\n\n");
-} 
-
 /*-------------------------------------------------------------------------*/
 
 matrix4  matInverse(matrix4 in)
@@ -127,7 +109,7 @@ matrix4  matInverse(matrix4 in)
 
 
 
-void mat2GL(matrix4 m, GLdouble *g){
+void mat2GL(matrix4 m, double *g){
   int i,j;
   for( i = 0; i < 4; i ++ )
     for( j = 0; j < 4; j ++ ) 
@@ -135,14 +117,14 @@ void mat2GL(matrix4 m, GLdouble *g){
 }
 
 
-void   GL2matPP(GLdouble *g, matrix4 * out){
+void   GL2matPP(double *g, matrix4 * out){
   int i,j;
   for( i = 0; i < 4; i ++ )
     for( j = 0; j < 4; j ++ ) 
       out->element[j][i] = *( g + i*4 + j );
 
 }
-matrix4  GL2mat(GLdouble *g){
+matrix4  GL2mat(double *g){
   matrix4 out;
   int i,j;
   for( i = 0; i < 4; i ++ )
@@ -382,3 +364,55 @@ void matCoords3Mulppp(matrix4 *m, double x, double y, double z, coords3 * out){
     m->element[2][3] ; 
 
 }
+
+
+matrix4  scale2mat(double s){
+  matrix4 out;
+
+  out = ident();
+  out.element[0][0] = s;
+  out.element[1][1] = s;
+  out.element[2][2] = s;
+  return out;
+}
+
+matrix4  trans2mat(coords3 t){
+  matrix4 out;
+
+  out = ident();
+  out.element[0][3] = t.x;
+  out.element[1][3] = t.y;
+  out.element[2][3] = t.z;
+  return out;
+}
+
+
+/*--------------------------------------------------------------------------
+
+  Affine transform of n points stored as structure of arrays, x, y, z.
+  The twelve matrix entries are loaded once into locals and the loop
+  body has no calls and no branches, so the compiler vectorizes it;
+  large batches are split between threads. Every point is read before
+  it is written, the output may be the input.
+
+--------------------------------------------------------------------------*/
+void matPointsMulOut(matrix4 *m, int n, const double *x, const double *y, const double *z,
+		     double *ox, double *oy, double *oz){
+  const double m00 = m->element[0][0], m01 = m->element[0][1], m02 = m->element[0][2], m03 = m->element[0][3];
+  const double m10 = m->element[1][0], m11 = m->element[1][1], m12 = m->element[1][2], m13 = m->element[1][3];
+  const double m20 = m->element[2][0], m21 = m->element[2][1], m22 = m->element[2][2], m23 = m->element[2][3];
+  int i;
+
+#pragma omp parallel for if( n > 65536 )
+  for( i = 0; i < n; i ++ ){
+    double px = x[i], py = y[i], pz = z[i];
+    ox[i] = m00 * px + m01 * py + m02 * pz + m03;
+    oy[i] = m10 * px + m11 * py + m12 * pz + m13;
+    oz[i] = m20 * px + m21 * py + m22 * pz + m23;
+  }
+}
+
+/* in place */
+void matPointsMul(matrix4 *m, int n, double *x, double *y, double *z){
+  matPointsMulOut( m, n, x, y, z, x, y, z );
+}
@@ -15,7 +15,6 @@
 #ifndef __MAT4_H
 #define __MAT4_H
 
-#include "GL/glut.h"
 #include <stdio.h>
 #include <math.h>
 #include "coords3.h"
@@ -30,7 +29,6 @@ typedef struct matrix4{	/* 4-by-4 matrix */
   double element[4][4];
 } matrix4;
 
-void Test( GLdouble * obj, GLdouble * inv );
 
 
 
@@ -44,8 +42,8 @@ coords3 matCoords3Mul(matrix4 m, coords3 c);
 
 matrix4 matInverse(matrix4 a);
 
-void mat2GL(matrix4 m, GLdouble *g);
-matrix4  GL2mat(GLdouble *a);
+void mat2GL(matrix4 m, double *g);
+matrix4  GL2mat(double *a);
 
 matrix4  rotx2mat(double deg);
 matrix4  roty2mat(double deg);
@@ -53,9 +51,16 @@ matrix4  roty2mat(double deg);
 matrix4  transpose_mat(matrix4 in);
 void printMat(matrix4 a);
 void matCoords3Mulppp(matrix4 *m, double x, double y, double z, coords3 * out);
-void GL2matPP(GLdouble *, matrix4 *);
+void GL2matPP(double *, matrix4 *);
 int affine_matrix4_inverse (matrix4 * in, matrix4 * out);
 
+/********************* point batches *************************/
+matrix4  scale2mat(double s);
+matrix4  trans2mat(coords3 t);
+void matPointsMul(matrix4 *m, int n, double *x, double *y, double *z);
+void matPointsMulOut(matrix4 *m, int n, const double *x, const double *y, const double *z,
+		     double *ox, double *oy, double *oz);
+
 #endif /* __MAT_H */
 
 
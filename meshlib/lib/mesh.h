@@ -55,6 +55,7 @@ typedef struct halfedge   HalfEdge;
 typedef struct vertex     Vertex;
 typedef struct edge       Edge;
 typedef struct node       Node;
+typedef struct meshbuffer MeshBuffer;
 
 struct node{
 
@@ -88,6 +89,7 @@ struct face{
    Face      * prev;
 
    int       alivef;
+   int       packno;   /* index in the packed arrays of a MeshBuffer */
 };
 
 struct edge{
@@ -100,6 +102,7 @@ struct edge{
 	Edge      *prev;
 
 	int      alive;
+	int      packno;
 
 };
 
@@ -130,6 +133,7 @@ struct vertex{
 	Vertex    *prev;
 
 	int      alivev;
+	int      packno;
 };
 
 
@@ -143,6 +147,52 @@ struct loop{
 };
 
 
+/*-------------------------------------------------------------------------
+
+  Retained drawing arrays of a solid, packed once and then updated for
+  the faces and edges marked dirty by the edits
+
+  verts : normal and position of each vertex, GL_N3F_V3F
+  faces : three vertex indices of each face, 0 0 0 for a dead face
+  edges : color and position of both ends of each edge, GL_C3F_V3F,
+          a dead edge has both ends at the origin
+
+  MeshBufferFlush repacks the dirty entries and leaves the runs it
+  rewrote in franges / eranges as (first, count) pairs, in faces and
+  edges, for a viewer keeping copies of the arrays in buffer objects
+
+-------------------------------------------------------------------------*/
+struct meshbuffer{
+
+   int       nverts;
+   int       nfaces;
+   int       nedges;
+
+   float    *verts;
+   unsigned *faces;
+   float    *edges;
+
+   Face    **ftable;      /* face and edge of each packno */
+   Edge    **etable;
+
+   float     edge_rgb[3];
+   Edge     *highlight;   /* edge drawn in red */
+
+   char     *fdirty;
+   int      *fqueue;
+   int       nfqueue;
+
+   char     *edirty;
+   int      *equeue;
+   int       nequeue;
+
+   int      *franges;
+   int       nfranges;
+   int      *eranges;
+   int       neranges;
+};
+
+
 
 
 
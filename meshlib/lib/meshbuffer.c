@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "mesh.h"
+#include "funcs.h"
+
+/* dirty entries closer than this are uploaded in one run */
+#define MESHBUFFER_GAP 16
+
+
+/*--------------------------------------------------------------------------
+
+  Pack one vertex, face or edge into its slot
+
+--------------------------------------------------------------------------*/
+static void MeshBufferPackVertex( MeshBuffer * mb, Vertex * v ){
+
+  float * p = mb->verts + 6 * v->packno;
+
+  p[0] = (float) v->ncoord[0];
+  p[1] = (float) v->ncoord[1];
+  p[2] = (float) v->ncoord[2];
+  p[3] = (float) v->vcoord[0];
+  p[4] = (float) v->vcoord[1];
+  p[5] = (float) v->vcoord[2];
+}
+
+static void MeshBufferPackFace( MeshBuffer * mb, Face * f ){
+
+  unsigned * p = mb->faces + 3 * f->packno;
+  HalfEdge * he;
+  int        i = 0;
+
+  if( !f->alivef ){
+    p[0] = p[1] = p[2] = 0;
+    return;
+  }
+
+  he = f->floop->ledges;
+  do{
+    assert( i < 3 );
+    p[i++] = (unsigned) he->hvert->packno;
+    he = he->next;
+  }while( he != f->floop->ledges );
+}
+
+static void MeshBufferPackEdge( MeshBuffer * mb, Edge * e ){
+
+  float  * p = mb->edges + 12 * e->packno;
+  float  * rgb = mb->edge_rgb;
+  float    red[3] = { 1, 0, 0 };
+  Vertex * tv1, * tv2;
+  int      i;
+
+  /* the halfedges of a dead edge may be reused by live edges */
+  if( !e->alive ){
+    memset( p, 0, sizeof(float) * 12 );
+    return;
+  }
+
+  tv1 = e->he1->hvert;
+  tv2 = e->he2->hvert;
+
+  if( e->alive < 0 || e == mb->highlight ) rgb = red;
+
+  for( i = 0; i < 3; i ++ ){
+    p[i]     = rgb[i];
+    p[i + 3] = (float) tv1->vcoord[i];
+    p[i + 6] = rgb[i];
+    p[i + 9] = (float) tv2->vcoord[i];
+  }
+}
+
+
+/*--------------------------------------------------------------------------
+
+  Number the vertices, faces and edges in list order and pack all of them
+
+--------------------------------------------------------------------------*/
+void MeshBufferConstruct( MeshBuffer ** mbuffer, Solid * solid,
+			  float r, float g, float b ){
+
+  MeshBuffer * mb;
+  Vertex     * tv;
+  Face       * tf;
+  Edge       * te;
+
+  NEW(mb,MeshBuffer);
+  memset( mb, 0, sizeof(MeshBuffer) );
+  mb->edge_rgb[0] = r;
+  mb->edge_rgb[1] = g;
+  mb->edge_rgb[2] = b;
+
+  if( (tv = solid->sverts) ) do{ tv->packno = mb->nverts ++; tv = tv->next; }while( tv != solid->sverts );
+  if( (tf = solid->sfaces) ) do{ tf->packno = mb->nfaces ++; tf = tf->next; }while( tf != solid->sfaces );
+  if( (te = solid->sedges) ) do{ te->packno = mb->nedges ++; te = te->next; }while( te != solid->sedges );
+
+  mb->verts   = (float *)    malloc( sizeof(float) * 6 * ( mb->nverts + 1 ) );
+  mb->faces   = (unsigned *) malloc( sizeof(unsigned) * 3 * ( mb->nfaces + 1 ) );
+  mb->edges   = (float *)    malloc( sizeof(float) * 12 * ( mb->nedges + 1 ) );
+  mb->ftable  = (Face **)    malloc( sizeof(Face *) * ( mb->nfaces + 1 ) );
+  mb->etable  = (Edge **)    malloc( sizeof(Edge *) * ( mb->nedges + 1 ) );
+  mb->fdirty  = (char *)     calloc( mb->nfaces + 1, 1 );
+  mb->fqueue  = (int *)      malloc( sizeof(int) * ( mb->nfaces + 1 ) );
+  mb->franges = (int *)      malloc( sizeof(int) * 2 * ( mb->nfaces + 1 ) );
+  mb->edirty  = (char *)     calloc( mb->nedges + 1, 1 );
+  mb->equeue  = (int *)      malloc( sizeof(int) * ( mb->nedges + 1 ) );
+  mb->eranges = (int *)      malloc( sizeof(int) * 2 * ( mb->nedges + 1 ) );
+  if( !mb->verts || !mb->faces || !mb->edges || !mb->ftable || !mb->etable ||
+      !mb->fdirty || !mb->fqueue ||
+      !mb->franges || !mb->edirty || !mb->equeue || !mb->eranges ){
+    printf ("Out of Memory!\n");
+    exit(0);
+  }
+
+  if( (tv = solid->sverts) ) do{ MeshBufferPackVertex( mb, tv ); tv = tv->next; }while( tv != solid->sverts );
+  if( (tf = solid->sfaces) ) do{ mb->ftable[tf->packno] = tf; MeshBufferPackFace( mb, tf ); tf = tf->next; }while( tf != solid->sfaces );
+  if( (te = solid->sedges) ) do{ mb->etable[te->packno] = te; MeshBufferPackEdge( mb, te ); te = te->next; }while( te != solid->sedges );
+
+  *mbuffer = mb;
+}
+
+
+void MeshBufferDestruct( MeshBuffer ** mbuffer ){
+
+  MeshBuffer * mb = *mbuffer;
+
+  if( !mb ) return;
+  FREE( mb->verts );
+  FREE( mb->faces );
+  FREE( mb->edges );
+  FREE( mb->ftable );
+  FREE( mb->etable );
+  FREE( mb->fdirty );
+  FREE( mb->fqueue );
+  FREE( mb->franges );
+  FREE( mb->edirty );
+  FREE( mb->equeue );
+  FREE( mb->eranges );
+  FREE( *mbuffer );
+}
+
+
+/*--------------------------------------------------------------------------
+
+  Mark entries for repacking by the next MeshBufferFlush
+
+--------------------------------------------------------------------------*/
+void MeshBufferDirtyFace( MeshBuffer * mb, Face * f ){
+
+  if( mb->fdirty[f->packno] ) return;
+  mb->fdirty[f->packno] = 1;
+  mb->fqueue[mb->nfqueue++] = f->packno;
+}
+
+void MeshBufferDirtyEdge( MeshBuffer * mb, Edge * e ){
+
+  if( mb->edirty[e->packno] ) return;
+  mb->edirty[e->packno] = 1;
+  mb->equeue[mb->nequeue++] = e->packno;
+}
+
+/*--------------------------------------------------------------------------
+
+  Faces around v and their edges, which covers every edge incident to v;
+  call it after a merge for the end vertex, after an extension for both
+  vertices of the halfedge
+
+--------------------------------------------------------------------------*/
+void MeshBufferDirtyVertex( MeshBuffer * mb, Vertex * v ){
+
+  Face     * f, * hf;
+  HalfEdge * he;
+
+  hf = VertexFirstFace( v );
+  f  = hf;
+  do{
+    MeshBufferDirtyFace( mb, f );
+    he = f->floop->ledges;
+    do{
+      MeshBufferDirtyEdge( mb, he->hedge );
+      he = he->next;
+    }while( he != f->floop->ledges );
+    f = VertexNextFace( v, f );
+  }while( f != hf );
+}
+
+void MeshBufferHighlight( MeshBuffer * mb, Edge * e ){
+
+  if( mb->highlight == e ) return;
+  if( mb->highlight ) MeshBufferDirtyEdge( mb, mb->highlight );
+  mb->highlight = e;
+  if( e ) MeshBufferDirtyEdge( mb, e );
+}
+
+
+static int MeshBufferCompare( const void * a, const void * b ){
+
+  return *(const int *) a - *(const int *) b;
+}
+
+/*--------------------------------------------------------------------------
+
+  Sort the queue, and cover it by runs which do not leave a gap longer
+  than MESHBUFFER_GAP; returns the number of runs
+
+--------------------------------------------------------------------------*/
+static int MeshBufferRanges( int * queue, int n, char * dirty, int * ranges ){
+
+  int i, k = 0;
+
+  qsort( queue, n, sizeof(int), MeshBufferCompare );
+  for( i = 0; i < n; i ++ ){
+    dirty[queue[i]] = 0;
+    if( k && queue[i] - ( ranges[2*k-2] + ranges[2*k-1] ) <= MESHBUFFER_GAP ){
+      ranges[2*k-1] = queue[i] + 1 - ranges[2*k-2];
+      continue;
+    }
+    ranges[2*k]   = queue[i];
+    ranges[2*k+1] = 1;
+    k ++;
+  }
+  return k;
+}
+
+/*--------------------------------------------------------------------------
+
+  Repack the dirty faces and edges, and replace the runs by the ones
+  repacked; returns the number of entries repacked
+
+--------------------------------------------------------------------------*/
+int MeshBufferFlush( MeshBuffer * mb ){
+
+  int i, count = mb->nfqueue + mb->nequeue;
+
+  for( i = 0; i < mb->nfqueue; i ++ ) MeshBufferPackFace( mb, mb->ftable[mb->fqueue[i]] );
+  for( i = 0; i < mb->nequeue; i ++ ) MeshBufferPackEdge( mb, mb->etable[mb->equeue[i]] );
+
+  mb->nfranges = MeshBufferRanges( mb->fqueue, mb->nfqueue, mb->fdirty, mb->franges );
+  mb->neranges = MeshBufferRanges( mb->equeue, mb->nequeue, mb->edirty, mb->eranges );
+  mb->nfqueue = 0;
+  mb->nequeue = 0;
+
+  return count;
+}
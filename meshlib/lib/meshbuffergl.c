@@ -0,0 +1,79 @@
+#include <stdio.h>
+#ifdef MESHBUFFER_USE_VBO
+#define GL_GLEXT_PROTOTYPES
+#endif
+#include "GL/glut.h"
+#include "mesh.h"
+#include "funcs.h"
+#include "meshbuffergl.h"
+
+#ifdef MESHBUFFER_USE_VBO
+static GLuint  vbo[3];     /* vertices, face indices, edges */
+#define bindBuffer( target, id )   glBindBuffer( target, id )
+#define bufferData( p )            ( (GLvoid *) 0 )
+#else
+#define bindBuffer( target, id )
+#define bufferData( p )            ( (GLvoid *) (p) )
+#endif
+
+void uploadMeshBuffer( MeshBuffer * mb ){
+
+#ifdef MESHBUFFER_USE_VBO
+  int i, * r;
+#endif
+
+  MeshBufferFlush( mb );
+
+#ifdef MESHBUFFER_USE_VBO
+  if( !vbo[0] ){
+    glGenBuffers( 3, vbo );
+    glBindBuffer( GL_ARRAY_BUFFER, vbo[0] );
+    glBufferData( GL_ARRAY_BUFFER, sizeof(float) * 6 * mb->nverts, 
+		  mb->verts, GL_STATIC_DRAW );
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, vbo[1] );
+    glBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned) * 3 * mb->nfaces, 
+		  mb->faces, GL_DYNAMIC_DRAW );
+    glBindBuffer( GL_ARRAY_BUFFER, vbo[2] );
+    glBufferData( GL_ARRAY_BUFFER, sizeof(float) * 12 * mb->nedges, 
+		  mb->edges, GL_DYNAMIC_DRAW );
+  }
+  else{
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, vbo[1] );
+    for( i = 0, r = mb->franges; i < mb->nfranges; i ++, r += 2 )
+      glBufferSubData( GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned) * 3 * r[0],
+		       sizeof(unsigned) * 3 * r[1], mb->faces + 3 * r[0] );
+    glBindBuffer( GL_ARRAY_BUFFER, vbo[2] );
+    for( i = 0, r = mb->eranges; i < mb->neranges; i ++, r += 2 )
+      glBufferSubData( GL_ARRAY_BUFFER, sizeof(float) * 12 * r[0],
+		       sizeof(float) * 12 * r[1], mb->edges + 12 * r[0] );
+  }
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+#endif
+}
+
+void displayEdge( MeshBuffer * mb ){
+
+  bindBuffer( GL_ARRAY_BUFFER, vbo[2] );
+  glInterleavedArrays( GL_C3F_V3F, 0, bufferData( mb->edges ) );
+  glDrawArrays( GL_LINES, 0, 2 * mb->nedges );
+  glDisableClientState( GL_COLOR_ARRAY );
+  glDisableClientState( GL_VERTEX_ARRAY );
+  bindBuffer( GL_ARRAY_BUFFER, 0 );
+
+}
+
+void displayFace( MeshBuffer * mb ){
+
+  glColor3f(0,0.8,0);
+  bindBuffer( GL_ARRAY_BUFFER, vbo[0] );
+  bindBuffer( GL_ELEMENT_ARRAY_BUFFER, vbo[1] );
+  glInterleavedArrays( GL_N3F_V3F, 0, bufferData( mb->verts ) );
+  glDrawElements( GL_TRIANGLES, 3 * mb->nfaces, GL_UNSIGNED_INT, 
+		  bufferData( mb->faces ) );
+  glDisableClientState( GL_NORMAL_ARRAY );
+  glDisableClientState( GL_VERTEX_ARRAY );
+  bindBuffer( GL_ARRAY_BUFFER, 0 );
+  bindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+ 
+}
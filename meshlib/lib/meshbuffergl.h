@@ -0,0 +1,14 @@
+#ifndef __MESHBUFFERGL_H
+#define __MESHBUFFERGL_H
+
+/*--------------------------------------------------------------------------
+  Drawing of a MeshBuffer with vertex arrays, shared by the viewers and
+  only built with them since it needs GL. Compiled with
+  -DMESHBUFFER_USE_VBO the arrays are copied into buffer objects, and only
+  the runs repacked by MeshBufferFlush are uploaded again
+  --------------------------------------------------------------------------*/
+void uploadMeshBuffer( MeshBuffer * mb );
+void displayEdge( MeshBuffer * mb );
+void displayFace( MeshBuffer * mb );
+
+#endif
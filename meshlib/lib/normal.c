@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "mesh.h"
+#include "funcs.h"
+
+
+/*--------------------------------------------------------------------------
+
+  Unit normal of the ccw triangle a b c, zero if it is degenerate;
+  returns the area
+
+--------------------------------------------------------------------------*/
+double TriangleNormal( double * a, double * b, double * c, double * n ){
+
+  double e[2][3];
+  double l, inv;
+  int    j;
+
+  for( j = 0; j < 3; j ++ ){
+    e[0][j] = b[j] - a[j];
+    e[1][j] = c[j] - a[j];
+  }
+
+  n[0] = e[0][1] * e[1][2] - e[0][2] * e[1][1];
+  n[1] = e[0][2] * e[1][0] - e[0][0] * e[1][2];
+  n[2] = e[0][0] * e[1][1] - e[0][1] * e[1][0];
+
+  l   = sqrt( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+  inv = ( l > 0 ) ? 1.0 / l : 0.0;
+  for( j = 0; j < 3; j ++ ) n[j] *= inv;
+
+  return 0.5 * l;
+}
+
+
+/*--------------------------------------------------------------------------
+
+  Face normals and area weighted vertex normals of the live faces, in
+  f->normal and v->ncoord. The coordinates are copied into arrays indexed
+  by vertexno, the faces are swept once, then every vertex sums its faces
+  in face order through a vertex to face table in compressed rows; no two
+  iterations of either loop write the same entry. Vertices without live
+  faces get a zero normal.
+
+--------------------------------------------------------------------------*/
+void SolidNormal( Solid * s ){
+
+  Vertex   * tv;
+  Face     * tf;
+  HalfEdge * he;
+  Face    ** face;
+  Vertex  ** vert;
+  double   * x, * y, * z, * fn, * fa;
+  int      * fv, * offset, * corner, * next;
+  int        nv = 0, nf = 0, i, j, c;
+
+  if( !s->sverts || !s->sfaces ) return;
+
+  tv = s->sverts;
+  do{ if( tv->vertexno + 1 > nv ) nv = tv->vertexno + 1; tv = tv->next; }while( tv != s->sverts );
+  tf = s->sfaces;
+  do{ if( tf->alivef ) nf ++; tf = tf->next; }while( tf != s->sfaces );
+
+  vert   = (Vertex **) calloc( nv, sizeof(Vertex *) );
+  x      = (double *)  malloc( sizeof(double) * 3 * nv );
+  face   = (Face **)   malloc( sizeof(Face *) * ( nf + 1 ) );
+  fv     = (int *)     malloc( sizeof(int) * 3 * ( nf + 1 ) );
+  fn     = (double *)  malloc( sizeof(double) * 3 * ( nf + 1 ) );
+  fa     = (double *)  malloc( sizeof(double) * ( nf + 1 ) );
+  offset = (int *)     calloc( nv + 1, sizeof(int) );
+  next   = (int *)     malloc( sizeof(int) * ( nv + 1 ) );
+  corner = (int *)     malloc( sizeof(int) * 3 * ( nf + 1 ) );
+  if( !vert || !x || !face || !fv || !fn || !fa || !offset || !next || !corner ){
+    printf ("Out of Memory!\n");
+    exit(0);
+  }
+  y = x + nv;
+  z = y + nv;
+
+  /* structure of arrays */
+  tv = s->sverts;
+  do{
+    vert[tv->vertexno] = tv;
+    x[tv->vertexno] = tv->vcoord[0];
+    y[tv->vertexno] = tv->vcoord[1];
+    z[tv->vertexno] = tv->vcoord[2];
+    tv = tv->next;
+  }while( tv != s->sverts );
+
+  i  = 0;
+  tf = s->sfaces;
+  do{
+    if( tf->alivef ){
+      face[i] = tf;
+      he = tf->floop->ledges;
+      for( j = 0; j < 3; j ++, he = he->next ) fv[3*i+j] = he->hvert->vertexno;
+      i ++;
+    }
+    tf = tf->next;
+  }while( tf != s->sfaces );
+
+  /* face sweep, branch free so that it vectorizes */
+#pragma omp parallel for
+  for( i = 0; i < nf; i ++ ){
+    int    i0 = fv[3*i], i1 = fv[3*i+1], i2 = fv[3*i+2];
+    double ux = x[i1] - x[i0], uy = y[i1] - y[i0], uz = z[i1] - z[i0];
+    double wx = x[i2] - x[i0], wy = y[i2] - y[i0], wz = z[i2] - z[i0];
+    double nx = uy * wz - uz * wy;
+    double ny = uz * wx - ux * wz;
+    double nz = ux * wy - uy * wx;
+    double l   = sqrt( nx * nx + ny * ny + nz * nz );
+    double inv = ( l > 0 ) ? 1.0 / l : 0.0;
+
+    fn[3*i]   = nx * inv;
+    fn[3*i+1] = ny * inv;
+    fn[3*i+2] = nz * inv;
+    fa[i]     = 0.5 * l;
+  }
+
+  /* vertex to face table, counting sort of the corners */
+  for( c = 0; c < 3 * nf; c ++ ) offset[ fv[c] + 1 ] ++;
+  for( i = 0; i < nv; i ++ ) offset[i+1] += offset[i];
+  for( i = 0; i < nv; i ++ ) next[i] = offset[i];
+  for( c = 0; c < 3 * nf; c ++ ) corner[ next[ fv[c] ] ++ ] = c;
+
+  /* gather, each vertex is written by one thread */
+#pragma omp parallel for
+  for( i = 0; i < nv; i ++ ){
+    double n[3] = { 0, 0, 0 }, l, inv;
+    int    k, f;
+
+    if( !vert[i] ) continue;
+    for( k = offset[i]; k < offset[i+1]; k ++ ){
+      f = corner[k] / 3;
+      n[0] += fn[3*f]   * fa[f];
+      n[1] += fn[3*f+1] * fa[f];
+      n[2] += fn[3*f+2] * fa[f];
+    }
+    l   = sqrt( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+    inv = ( l > 0 ) ? 1.0 / l : 0.0;
+    vert[i]->ncoord[0] = n[0] * inv;
+    vert[i]->ncoord[1] = n[1] * inv;
+    vert[i]->ncoord[2] = n[2] * inv;
+  }
+
+  for( i = 0; i < nf; i ++ )
+    for( j = 0; j < 3; j ++ ) face[i]->normal[j] = fn[3*i+j];
+
+  FREE( vert );
+  FREE( x );
+  FREE( face );
+  FREE( fv );
+  FREE( fn );
+  FREE( fa );
+  FREE( offset );
+  FREE( next );
+  FREE( corner );
+}
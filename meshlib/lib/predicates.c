@@ -0,0 +1,178 @@
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include "mesh.h"
+#include "funcs.h"
+
+/*
+ *  Robust orientation test.
+ *
+ *  The determinant is first evaluated in floating point together with a
+ *  bound of its rounding error. Only when the value is within the bound the
+ *  determinant is recomputed exactly with floating point expansions, see
+ *  J. R. Shewchuk, Adaptive precision floating-point arithmetic and fast
+ *  robust geometric predicates, 1997.
+ */
+
+#define PRED_EPSILON   ( DBL_EPSILON / 2.0 )
+#define PRED_SPLITTER  134217729.0
+#define PRED_O3D_BOUND ( ( 12.0 + 128.0 * PRED_EPSILON ) * PRED_EPSILON )
+
+static void TwoSum( double a, double b, double *x, double *y ){
+  double av, bv;
+
+  *x = a + b;
+  bv = *x - a;
+  av = *x - bv;
+  *y = ( a - av ) + ( b - bv );
+}
+
+static void Split( double a, double *hi, double *lo ){
+  double c, big;
+
+  c   = PRED_SPLITTER * a;
+  big = c - a;
+  *hi = c - big;
+  *lo = a - *hi;
+}
+
+static void TwoProduct( double a, double b, double *x, double *y ){
+  double ahi, alo, bhi, blo, err;
+
+  *x = a * b;
+  Split( a, &ahi, &alo );
+  Split( b, &bhi, &blo );
+  err = *x - ahi * bhi;
+  err = err - alo * bhi;
+  err = err - ahi * blo;
+  *y = alo * blo - err;
+}
+
+/* h = e + b, zero components eliminated, h may be e */
+static int Grow( int elen, double *e, double b, double *h ){
+  int i, hlen = 0;
+  double q = b, x, y;
+
+  for( i = 0; i < elen; i ++ ){
+    TwoSum( q, e[i], &x, &y );
+    if( y != 0 ) h[hlen++] = y;
+    q = x;
+  }
+  if( q != 0 ) h[hlen++] = q;
+  return hlen;
+}
+
+/* h = e + s f, s = +1 or -1 */
+static int Sum( int elen, double *e, int flen, double *f, double s, double *h ){
+  int i, hlen = elen;
+
+  for( i = 0; i < elen; i ++ ) h[i] = e[i];
+  for( i = 0; i < flen; i ++ ) hlen = Grow( hlen, h, s * f[i], h );
+  return hlen;
+}
+
+/* h = b e */
+static int Scale( int elen, double *e, double b, double *h ){
+  int i, hlen = 0;
+  double q, hh, p1, p0, sum;
+
+  if( elen == 0 || b == 0 ) return 0;
+
+  TwoProduct( e[0], b, &q, &hh );
+  if( hh != 0 ) h[hlen++] = hh;
+
+  for( i = 1; i < elen; i ++ ){
+    TwoProduct( e[i], b, &p1, &p0 );
+    TwoSum( q, p0, &sum, &hh );
+    if( hh != 0 ) h[hlen++] = hh;
+    q  = p1 + sum;
+    hh = sum - ( q - p1 );
+    if( hh != 0 ) h[hlen++] = hh;
+  }
+  if( q != 0 ) h[hlen++] = q;
+  return hlen;
+}
+
+/* h = e f, f has at most two components */
+static int Product( int elen, double *e, int flen, double *f, double *h ){
+  double t[2][64];
+  int    tlen[2] = { 0, 0 };
+  int    i;
+
+  for( i = 0; i < flen; i ++ )
+    tlen[i] = Scale( elen, e, f[i], t[i] );
+  return Sum( tlen[0], t[0], tlen[1], t[1], 1.0, h );
+}
+
+static int Diff( double a, double b, double *h ){
+  double x, y;
+  int hlen = 0;
+
+  TwoSum( a, -b, &x, &y );
+  if( y != 0 ) h[hlen++] = y;
+  if( x != 0 ) h[hlen++] = x;
+  return hlen;
+}
+
+/* exact minor u[i] v[j] - u[j] v[i] */
+static int Minor( double u[3][2], int *ulen, double v[3][2], int *vlen, int i, int j, double *h ){
+  double p[8], q[8];
+  int plen, qlen;
+
+  plen = Product( ulen[i], u[i], vlen[j], v[j], p );
+  qlen = Product( ulen[j], u[j], vlen[i], v[i], q );
+  return Sum( plen, p, qlen, q, -1.0, h );
+}
+
+static double Orient3dExact( double *a, double *b, double *c, double *d ){
+  double A[3][2], B[3][2], C[3][2];
+  int    alen[3], blen[3], clen[3];
+  double m[16], t[64], det[192], tmp[192];
+  int    mlen, tlen, dlen = 0, i, j;
+  double s;
+
+  for( j = 0; j < 3; j ++ ){
+    alen[j] = Diff( a[j], d[j], A[j] );
+    blen[j] = Diff( b[j], d[j], B[j] );
+    clen[j] = Diff( c[j], d[j], C[j] );
+  }
+
+  for( j = 0; j < 3; j ++ ){
+    mlen = Minor( B, blen, C, clen, (j+1)%3, (j+2)%3, m );
+    tlen = Product( mlen, m, alen[j], A[j], t );
+    dlen = Sum( dlen, det, tlen, t, 1.0, tmp );
+    for( i = 0; i < dlen; i ++ ) det[i] = tmp[i];
+  }
+
+  s = 0;
+  for( i = 0; i < dlen; i ++ ) s += det[i];
+  return s;
+}
+
+/*
+ *  Oriented volume of the tetrahedron, det[ a-d, b-d, c-d ]. The sign is
+ *  exact; the value is the floating point one unless it is too close to
+ *  zero to be trusted, then it is the rounded exact value.
+ */
+double Orient3d( double *a, double *b, double *c, double *d ){
+  double m[3][3];
+  double c0, c1, c2, det, permanent;
+  int    i, j;
+
+  for( i = 0; i < 3; i ++ )
+    for( j = 0; j < 3; j ++ )
+      m[i][j] = ( i == 0 ? a[j] : ( i == 1 ? b[j] : c[j] ) ) - d[j];
+
+  c0 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+  c1 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+  c2 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+  det = m[0][0] * c0 + m[0][1] * c1 + m[0][2] * c2;
+
+  permanent = fabs( m[0][0] ) * ( fabs( m[1][1] * m[2][2] ) + fabs( m[1][2] * m[2][1] ) )
+            + fabs( m[0][1] ) * ( fabs( m[1][2] * m[2][0] ) + fabs( m[1][0] * m[2][2] ) )
+            + fabs( m[0][2] ) * ( fabs( m[1][0] * m[2][1] ) + fabs( m[1][1] * m[2][0] ) );
+
+  if( fabs( det ) > PRED_O3D_BOUND * permanent ) return det;
+
+  return Orient3dExact( a, b, c, d );
+}
@@ -102,37 +102,42 @@ qrot qrotInv(qrot  a){
 
 
 
+/* Hamilton product ab, the rotation b followed by a */
 qrot qrotCompose(qrot a, qrot  b){
   qrot qres;
-  double sa,sb,sres;
-  coords3 va,vb,vres;
-
-  sa = a.w;
-  va = setCoords(a.x, a.y, a.z);
-  sb = b.w;
-  vb = setCoords(b.x, b.y, b.z);
-  sres = sa*sb - coordDot(va,vb);
-  
-  vres =   coordAdd(
-		   coordAdd(
-			   scalarCoordMul(sa,vb), 
-			   scalarCoordMul(sb,va)),
-		   coordCross(va,vb));
-  qres = setQrot(sres,vres.x, vres.y, vres.z);
+
+  qres.w = a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z;
+  qres.x = a.w*b.x + b.w*a.x + a.y*b.z - a.z*b.y;
+  qres.y = a.w*b.y + b.w*a.y + a.z*b.x - a.x*b.z;
+  qres.z = a.w*b.z + b.w*a.z + a.x*b.y - a.y*b.x;
   return qres;
 }
 
 
+/* q p q^-1 expanded, ( (w^2 - v.v) p + 2 (v.p) v + 2 w v x p ) / |q|^2 */
 coords3 qrotApply(qrot q, coords3 p){
-  qrot tt,pq;
-  pq= setQrot(0,p.x, p.y, p.z);
-  tt =     qrotCompose(q,
-		       qrotCompose(pq, qrotInv(q)));
-  
-  return setCoords(tt.x,tt.y, tt.z);
+  double n  = 1. / quatDot(q, q);
+  double vv = q.x*q.x + q.y*q.y + q.z*q.z;
+  double vp = q.x*p.x + q.y*p.y + q.z*p.z;
+  double s  = ( q.w*q.w - vv ) * n;
+  double t  = 2 * vp * n;
+  double u  = 2 * q.w * n;
+  coords3 res;
+
+  res.x = s*p.x + t*q.x + u*( q.y*p.z - q.z*p.y );
+  res.y = s*p.y + t*q.y + u*( q.z*p.x - q.x*p.z );
+  res.z = s*p.z + t*q.z + u*( q.x*p.y - q.y*p.x );
+  return res;
 }
 
 
+/* rotate n points stored as structure of arrays, in place */
+void qrotPointsApply(qrot q, int n, double *x, double *y, double *z){
+  matrix4 m;
+
+  m = putInMatrix(q);
+  matPointsMul( &m, n, x, y, z );
+}
 
 
 
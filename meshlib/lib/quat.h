@@ -18,6 +18,7 @@ typedef struct qrot{
 
 
 coords3  qrotApply(qrot q, coords3 p);
+void  qrotPointsApply(qrot q, int n, double *x, double *y, double *z);
 qrot  setQrot(double a, double b, double c, double d);
 qrot  qrotInv(qrot  a);
 qrot  quatAdd(qrot  a, qrot b);
@@ -3,6 +3,7 @@
 #include <assert.h>
 #include "mesh.h"
 #include "funcs.h"
+#include "matrix4.h"
 
 Solid *SolidNew(){
   Solid * s;
@@ -54,6 +55,9 @@ void SolidConstruct( Solid * * solid , char *FileName){
      FaceListConstruct(&s,face_number,fp);
      EdgeListConstruct(&s);
 
+     /* plain OFF carries no normals */
+     SolidNormal(s);
+
      *solid = s;
      
      fclose(fp);
@@ -162,28 +166,121 @@ int SolidConvexity( Solid * s )
 
 
 
+/*--------------------------------------------------------------------------
+
+  Vertex coordinates of the solid copied into structure of arrays x, y,
+  z, in list order; returns the number of vertices. The arrays are
+  allocated here, x holds all three.
+
+--------------------------------------------------------------------------*/
+static int SolidGather( Solid * s, double ** x, double ** y, double ** z ){
+
+  Vertex * v;
+  int      n = 0, i;
+
+  if( !s->sverts ) return 0;
+  v = s->sverts;
+  do{ n ++; v = v->next; }while( v != s->sverts );
+
+  *x = (double *) malloc( sizeof(double) * 3 * n );
+  if( !*x ){
+    printf ("Out of Memory!\n");
+    exit(0);
+  }
+  *y = *x + n;
+  *z = *y + n;
+
+  i = 0;
+  v = s->sverts;
+  do{
+    (*x)[i] = v->vcoord[0];
+    (*y)[i] = v->vcoord[1];
+    (*z)[i] = v->vcoord[2];
+    i ++;
+    v = v->next;
+  }while( v != s->sverts );
+
+  return n;
+}
+
+
+/*--------------------------------------------------------------------------
+
+  Center of mass of the vertices, in s->center. The coordinates are
+  summed in fixed blocks and the block sums added in order, which loses
+  less precision than one running sum on large meshes.
+
+--------------------------------------------------------------------------*/
+#define SOLID_BLOCK 1024
+
 void SolidCenter( Solid * s ){
 
+  double * x, * y, * z;
+  double   c[3] = { 0, 0, 0 };
+  int      n, i, j;
+
+  n = SolidGather( s, &x, &y, &z );
+  if( !n ) return;
+
+  for( i = 0; i < n; i += SOLID_BLOCK ){
+    double bx = 0, by = 0, bz = 0;
+    int    e = ( i + SOLID_BLOCK < n ) ? i + SOLID_BLOCK : n;
+    for( j = i; j < e; j ++ ){
+      bx += x[j];
+      by += y[j];
+      bz += z[j];
+    }
+    c[0] += bx;
+    c[1] += by;
+    c[2] += bz;
+  }
+
+  s->center[0] = c[0]/(double)n;
+  s->center[1] = c[1]/(double)n;
+  s->center[2] = c[2]/(double)n;
+
+  FREE( x );
+}
+
+
+/*--------------------------------------------------------------------------
+
+  Apply the affine transform m to every vertex of the solid: the
+  coordinates are gathered into arrays, transformed in one batch by
+  matPointsMul and written back. Normals are not updated.
+
+--------------------------------------------------------------------------*/
+void SolidTransform( Solid * s, matrix4 * m ){
+
   Vertex * v;
-  int    count;
-  double  x,y,z;
+  double * x, * y, * z;
+  int      n, i;
+
+  n = SolidGather( s, &x, &y, &z );
+  if( !n ) return;
 
-  x = y = 0;
-  count = 0;
+  matPointsMul( m, n, x, y, z );
 
+  i = 0;
   v = s->sverts;
   do{
-  count ++;
-  x += v->vcoord[0];  
-  y += v->vcoord[1];  
-  z += v->vcoord[2];  
-  v = v->next;
-  }while( v!=s->sverts);
+    v->vcoord[0] = x[i];
+    v->vcoord[1] = y[i];
+    v->vcoord[2] = z[i];
+    i ++;
+    v = v->next;
+  }while( v != s->sverts );
+
+  FREE( x );
+}
+
+
+void SolidScale( Solid * s, double factor ){
 
-  s->center[0] = x/(double)count;
-  s->center[1] = y/(double)count;
-  s->center[2] = z/(double)count;
+  matrix4 m;
 
+  m = scale2mat( factor );
+  SolidTransform( s, &m );
 }
 
 
@@ -16,7 +16,7 @@
 #include <string.h>
 #include "GL/glut.h"
 
-void drawFace()
+static void drawFace()
 {
   glColor3f(1.0,1.0,0); /* face */
   glPushMatrix();
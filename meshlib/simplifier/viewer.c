@@ -255,9 +255,7 @@ void MenuFunc( int value ){
 }
 
 void SetMenu( void ){
-  int menu;
-
-  menu =  glutCreateMenu( MenuFunc );
+  glutCreateMenu( MenuFunc );
   glutAddMenuEntry("Show faces", 0);
   glutAddMenuEntry("Show edges", 1);
   glutAddMenuEntry("Debug", 2);
@@ -373,46 +371,11 @@ void displayNextMergedHalfEdge(float r, float g, float b){
    displayStructure( 1, 0, 0,2, tv2);  
    */
 }
-void displayEdge(Solid * solid,float r, float g, float b){
-  
-  
-  Edge * te;
-  Edge * head = solid->sedges;
-  Vertex *tv1, *tv2;
-  int i = 0;
-  
-  if(! head ) return;
-  te = head;
-  
-  
-  do{
-    if( te->alive ){
-      i++;
-      if( te->he1 != nextMergedHalfEdge && te->he2 != nextMergedHalfEdge )
-	glColor3f( r , g, b );
-      else
-	glColor3f( 1, 0 , 0 );
-	
-	tv1 =  te->he1->hvert;
-	tv2 =  te->he2->hvert;
-	
-	glBegin(GL_LINES);
-	
-	glVertex3f(tv1->vcoord[0],
-		   tv1->vcoord[1],
-		   tv1->vcoord[2]);
-	
-	glVertex3f(tv2->vcoord[0],
-		   tv2->vcoord[1],
-		   tv2->vcoord[2]);
-	glEnd();
-      }
-    te = te->next;
-  }while( te != head );
-  
-  
-  
-}
+/*--------------------------------------------------------------------------
+  Retained arrays of the solid, packed once after loading and drawn by
+  ../lib/meshbuffergl.c
+  --------------------------------------------------------------------------*/
+MeshBuffer * mbuffer;
 
 
 void drawFace(Vertex * vert ){
@@ -451,82 +414,11 @@ void drawFace(Vertex * vert ){
  
 }
 
-void displayFace( Solid * solid ){
-  
-  
-  Face * tf;
-  HalfEdge *he;
-  Face * head = solid->sfaces;
-  
-  
-  if(! head ) return;
-  tf = head;
-  glColor3f(0,0.8,0);
-  glBegin(GL_TRIANGLES);
-
-  do{
-      he =  tf->floop->ledges;
+void displayVisibleFace( MeshBuffer * mb ){
 
-      do{
-	
-		
-	glNormal3f(he->hvert->ncoord[0],
-		   he->hvert->ncoord[1],
-		   he->hvert->ncoord[2]);
-
-	glVertex3f(he->hvert->vcoord[0],
-		   he->hvert->vcoord[1],
-		   he->hvert->vcoord[2]);
-	
-	
-	he = he->next;
-      }while( he != tf->floop->ledges); 
-
-      tf = tf->next;
-  }while( tf != head );
-  
-  glEnd();
- 
-}
-void displayVisibleFace( Solid * solid ){
-  
-  
-  Face * tf;
-  HalfEdge *he;
-  Face * head = solid->sfaces;
-  
-  
-  if(! head ) return;
-  tf = head;
-  glColor3f(0,0.8,0);
   glPolygonMode( GL_FRONT, GL_LINE );
   glCullFace( GL_BACK );
-  glBegin(GL_TRIANGLES);
-
-  do{
-    if( tf->alivef ) {
-      he =  tf->floop->ledges;
-
-      do{
-	
-		
-	glNormal3f(he->hvert->ncoord[0],
-		   he->hvert->ncoord[1],
-		   he->hvert->ncoord[2]);
-
-	glVertex3f(he->hvert->vcoord[0],
-		   he->hvert->vcoord[1],
-		   he->hvert->vcoord[2]);
-	
-	
-	he = he->next;
-      }while( he != tf->floop->ledges); 
-    }
-      tf = tf->next;
-  }while( tf != head );
-  
-  glEnd();
-
+  displayFace( mb );
   glPolygonMode( GL_FRONT, GL_FILL );
  
 }
@@ -563,6 +455,34 @@ void checkManifold( Solid * solid ){
  
 }
 
+/*-------------------------------------------------------------------------
+
+  Mark the faces and edges changed by merging or extending he: the two
+  faces of he, and the faces and edges around its vertices
+
+--------------------------------------------------------------------------*/
+void dirtyHalfEdge( HalfEdge * he ){
+
+  HalfEdge * mate = HalfEdgeMate( he );
+  HalfEdge * the;
+  Face     * f[2];
+  int        i;
+
+  f[0] = he->hloop->lface;
+  f[1] = mate->hloop->lface;
+  for( i = 0; i < 2; i ++ ){
+    MeshBufferDirtyFace( mbuffer, f[i] );
+    the = f[i]->floop->ledges;
+    do{
+      MeshBufferDirtyEdge( mbuffer, the->hedge );
+      the = the->next;
+    }while( the != f[i]->floop->ledges );
+  }
+
+  if( he->hvert->alivev ) MeshBufferDirtyVertex( mbuffer, he->hvert );
+  MeshBufferDirtyVertex( mbuffer, mate->hvert );
+}
+
 /*-------------------------------------------------------------------------
 
   Give halfedge list in merged halfedge list, extend halfedges
@@ -581,6 +501,7 @@ void Recover(){
  he = (HalfEdge * ) node->p;
  
  HalfEdgeExtend( he );
+ dirtyHalfEdge( he );
 
  ListDeleteNode( &merged_halfedge_list, (void*)he, HALFEDGE);
 
@@ -618,16 +539,18 @@ void display(void)
   
   
   setupObjG();
+  MeshBufferHighlight( mbuffer, nextMergedHalfEdge ? nextMergedHalfEdge->hedge : NIL );
+  uploadMeshBuffer( mbuffer );
 
   switch( display_mode ){
   case 0:
-    displayFace( solid );
+    displayFace( mbuffer );
     break;
   case 2:
-    displayVisibleFace( solid );
+    displayVisibleFace( mbuffer );
     break;
    case 1:
-    displayEdge( solid, 1,1,1 );
+    displayEdge( mbuffer );
     break;
   }
 
@@ -1086,6 +1009,7 @@ Vertex * end;
        /* merge halfedge with minimum cost */
        
        HalfEdgeMerge( te );
+       dirtyHalfEdge( te );
        
        /* update neighborhood of the halfedge removed */
        HeapUpdate( end );
@@ -1171,10 +1095,7 @@ void HalfEdgeHeapInitialize(Solid * solid){
 
 void KeyFunc(unsigned char key, int x, int y){
   
-  int posx,posy;
   int i;
-  posx = x;
-  posy = y;
 
   switch(key){
 
@@ -1403,24 +1324,6 @@ void mouseMove(int x, int y)
 
 
 
-void SolidScale( Solid * solid , double factor ){
-
-  Vertex * tv, * head;
-  
-  head = solid->sverts;
-  if( !head ) return;
-  tv = head;
-  do{
-
-    tv->vcoord[0] *= factor;
-    tv->vcoord[1] *= factor;
-    tv->vcoord[2] *= factor;
-
-    tv = tv->next;
-
-  }while( tv != head );
-
-}
 
 
 /*****************************************************************************
@@ -1444,6 +1347,7 @@ int main(int argc, char **argv)
   */
   
   SolidScale( solid , factor );
+  MeshBufferConstruct( &mbuffer, solid, 1, 1, 1 );
   HalfEdgeHeapInitialize( solid );
 
 
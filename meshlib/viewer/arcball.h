@@ -1,9 +0,0 @@
-#if !defined (_ARCBALL_H)
-#define _ARCBALL_H
-#include "quat.h"
-void setWinArc(int xsz, int ysz, int ox, int oy);
-qrot  winArcTform(int nx, int ny);
-
-
-#endif
-
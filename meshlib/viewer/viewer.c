@@ -85,9 +85,7 @@ void MenuFunc( int value ){
 }
 
 void SetMenu( void ){
-  int menu;
-
-  menu =  glutCreateMenu( MenuFunc );
+  glutCreateMenu( MenuFunc );
   glutAddMenuEntry("Show faces", 0);
   glutAddMenuEntry("Show edges", 1);
   glutAttachMenu(GLUT_MIDDLE_BUTTON);
@@ -169,106 +167,14 @@ void setupEye(void)
   Function
   --------------------------------------------------------------------------*/
 
-void displayEdge(Solid * solid,float r, float g, float b){
-  
-  
-  Edge * te;
-  Edge * head = solid->sedges;
-  Vertex *tv1, *tv2;
-  int i = 0;
-  
-  if(! head ) return;
-  te = head;
-  
-  
-  do{
-    if( te->alive >0 ){
-      i++;
-      glColor3f( r , g, b );
-
-      tv1 =  te->he1->hvert;
-      tv2 =  te->he2->hvert;
-      
-      glBegin(GL_LINES);
-      
-      glVertex3f(tv1->vcoord[0],
-		 tv1->vcoord[1],
-		 tv1->vcoord[2]);
-      
-      glVertex3f(tv2->vcoord[0],
-		 tv2->vcoord[1],
-		 tv2->vcoord[2]);
-      glEnd();
-    }
-    else{
-      if( te->alive < 0 ){
-	glColor3f( 1,0,0);
-	
-	
-	tv1 =  te->he1->hvert;
-	tv2 =  te->he2->hvert;
-	
-	glBegin(GL_LINES);
-	
-	glVertex3f(tv1->vcoord[0],
-		   tv1->vcoord[1],
-		   tv1->vcoord[2]);
-	
-	glVertex3f(tv2->vcoord[0],
-		   tv2->vcoord[1],
-		   tv2->vcoord[2]);
-	glEnd();
-	
-
-      }
-    }
-    
-    te = te->next;
-  }while( te != head );
-  
-  
-  
-}
-
-
-
-void displayFace( Solid * solid ){
-  
-  
-  Face * tf;
-  HalfEdge *he;
-  Face * head = solid->sfaces;
-  
-  
-  if(! head ) return;
-  tf = head;
-  glColor3f(0,0.8,0);
-  glBegin(GL_TRIANGLES);
-
-  do{
-      he =  tf->floop->ledges;
+/*--------------------------------------------------------------------------
+  Retained arrays of the solid, packed once after loading and drawn by
+  ../lib/meshbuffergl.c
+  --------------------------------------------------------------------------*/
+MeshBuffer * mbuffer;
 
-      do{
-	
-		
-	glNormal3f(he->hvert->ncoord[0],
-		   he->hvert->ncoord[1],
-		   he->hvert->ncoord[2]);
 
-	glVertex3f(he->hvert->vcoord[0],
-		   he->hvert->vcoord[1],
-		   he->hvert->vcoord[2]);
-	
-	
-	he = he->next;
-      }while( he != tf->floop->ledges); 
 
-      tf = tf->next;
-  }while( tf != head );
-  
-  glEnd();
- 
-}
 
 
 
@@ -303,13 +209,14 @@ void display(void)
   
   
   setupObjG();
+  uploadMeshBuffer( mbuffer );
 
   switch( display_mode ){
   case 0:
-    displayFace( solid );
+    displayFace( mbuffer );
     break;
   case 1:
-    displayEdge( solid , 0,0, 1 );
+    displayEdge( mbuffer );
     break;
   }
   glPopMatrix();
@@ -617,11 +524,6 @@ void mouse(int button, int state, int x, int y)
 
 void KeyFunc(unsigned char key, int x, int y){
   
-  int posx,posy;
-
-  posx = x;
-  posy = y;
-
   switch(key){
 
   case 'g':
@@ -651,7 +553,7 @@ void KeyFunc(unsigned char key, int x, int y){
 
  if( Object == SKYCAM )  Coordnate = SKYCAM_COORD;
  else
-
+ {
   switch(Mode){
     case RELATIVE_TO_LOCAL:
       switch(Object){
@@ -663,6 +565,7 @@ void KeyFunc(unsigned char key, int x, int y){
 	break;
       
   }
+ }
       
   glutPostRedisplay();
 }
@@ -817,24 +720,6 @@ void mouseMove(int x, int y)
 
 
 
-void SolidScale( Solid * solid , double factor ){
-
-  Vertex * tv, * head;
-  
-  head = solid->sverts;
-  if( !head ) return;
-  tv = head;
-  do{
-
-    tv->vcoord[0] *= factor;
-    tv->vcoord[1] *= factor;
-    tv->vcoord[2] *= factor;
-
-    tv = tv->next;
-
-  }while( tv != head );
-
-}
 
 
 /*****************************************************************************
@@ -858,6 +743,7 @@ int main(int argc, char **argv)
   */
   
   SolidScale( solid , factor );
+  MeshBufferConstruct( &mbuffer, solid, 0, 0, 1 );
   
 
 
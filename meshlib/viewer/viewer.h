@@ -15,11 +15,15 @@
 #ifndef __ASST3_H
 #define __ASST3_H
 #include <stdio.h>
+#ifdef MESHBUFFER_USE_VBO
+#define GL_GLEXT_PROTOTYPES
+#endif
 #include "GL/glut.h"
-#include "matrix4.h"
-#include "arcball.h"
+#include "../lib/matrix4.h"
+#include "../lib/arcball.h"
 #include "../lib/mesh.h"
 #include "../lib/funcs.h"
+#include "../lib/meshbuffergl.h"
 #include "draw.h"
 
 